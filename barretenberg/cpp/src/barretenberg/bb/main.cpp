@@ -18,6 +18,7 @@
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
 #include "barretenberg/serialize/cbind.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/stdlib/client_ivc_verifier/client_ivc_recursive_verifier.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
@@ -1093,6 +1094,30 @@ void prove_honk_output_all(const std::string& bytecodePath,
     vinfo("vk as fields written to: ", vkFieldsOutputPath);
 }
 
+/**
+ * @brief Writes the pippenger point table of an SRS transcript directory, from which the provers that load the SRS from
+ * this directory (FileCrsFactory) map the prover CRS instead of reading and preprocessing the transcripts.
+ *
+ * Communication:
+ * - Filesystem: The table is written to <srsDir>/monomial/point_table.dat
+ *
+ * @param srsDir Path to the directory of the SRS transcripts, e.g. srs_db/ignition
+ * @param curve The curve of the SRS, bn254 or grumpkin
+ * @param numPoints The number of points of the table, which is the largest circuit size it serves
+ * @return true if the table was written
+ */
+bool writePointTable(const std::string& srsDir, const std::string& curve, const size_t numPoints)
+{
+    if (curve == "bn254") {
+        return srs::factories::FileCrsFactory<curve::BN254>(srsDir).write_point_table(numPoints);
+    }
+    if (curve == "grumpkin") {
+        return srs::factories::FileCrsFactory<curve::Grumpkin>(srsDir).write_point_table(numPoints);
+    }
+    std::cerr << "Unknown curve: " << curve << "\n";
+    return false;
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -1171,6 +1196,13 @@ int main(int argc, char* argv[])
             return 0;
         }
 
+        if (command == "write_point_table") {
+            const std::string srs_dir = get_option(args, "--srs_dir", "../srs_db/ignition");
+            const std::string curve = get_option(args, "--curve", "bn254");
+            const size_t num_points = std::stoul(get_option(args, "-n", std::to_string(1UL << 20)));
+            return writePointTable(srs_dir, curve, num_points) ? 0 : 1;
+        }
+
         if (proof_system == "client_ivc") {
             ClientIVCAPI api;
             execute_command(command, flags, api);
@@ -0,0 +1,123 @@
+#include "barretenberg/common/utils.hpp"
+#include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/deserialization.hpp"
+#include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/execution_hints.hpp"
+#include "barretenberg/vm/avm/trace/helper.hpp"
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+#include "barretenberg/vm/avm/trace/trace.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::avm_trace;
+
+namespace {
+
+// Position of the SUB at the head of the loop, after the two SETs
+constexpr uint32_t LOOP_PC = 12;
+
+/**
+ * Bytecode that decrements a counter from num_iterations down to zero, so that the SUB and JUMPI at the head of the
+ * loop are executed num_iterations times each
+ */
+std::vector<uint8_t> counting_loop_bytecode(uint16_t num_iterations)
+{
+    std::string bytecode_hex = to_hex(OpCode::SET_16) +      // opcode SET
+                               "00"                          // Indirect flag
+                               "0000"                        // dst_offset 0
+                               + to_hex(AvmMemoryTag::U32) + //
+                               to_hex(num_iterations)        // val
+                               + to_hex(OpCode::SET_8) +     // opcode SET
+                               "00"                          // Indirect flag
+                               "01"                          // dst_offset 1
+                               + to_hex(AvmMemoryTag::U32) + //
+                               "01"                          // val 1
+                               + to_hex(OpCode::SUB_8) +     // opcode SUB
+                               "00"                          // Indirect flag
+                               "00"                          // addr a 0
+                               "01"                          // addr b 1
+                               "00"                          // addr c 0
+                               + to_hex(OpCode::JUMPI_32) +  // opcode JUMPI
+                               "00"                          // Indirect flag
+                               "0000"                        // cond_offset 0
+                               + to_hex(LOOP_PC) +           // jmp_dest (SUB)
+                               to_hex(OpCode::SET_8) +       // opcode SET (for return size)
+                               "00"                          // Indirect flag
+                               "FF"                          // dst_offset=255
+                               + to_hex(AvmMemoryTag::U32) + //
+                               "00"                          // val: 0
+                               + to_hex(OpCode::RETURN) +    // opcode RETURN
+                               "00"                          // Indirect flag
+                               "0000"                        // ret offset 0
+                               "00FF";                       // ret size offset 255
+    return bb::utils::hex_to_bytes(bytecode_hex);
+}
+
+/**
+ * Executes the loop as an enqueued call, the trace is not finalized
+ */
+void execute_loop(State& state) noexcept
+{
+    const auto num_iterations = static_cast<uint16_t>(state.range(0));
+    const FF contract_address = 0xdeadbeef;
+
+    AvmPublicInputs public_inputs;
+    public_inputs.gas_settings.gas_limits.l2_gas = std::numeric_limits<uint32_t>::max() / 2;
+    public_inputs.gas_settings.gas_limits.da_gas = std::numeric_limits<uint32_t>::max() / 2;
+    AvmContractBytecode contract_bytecode(counting_loop_bytecode(num_iterations));
+    contract_bytecode.contract_instance.address = contract_address;
+    ExecutionHints execution_hints = ExecutionHints().with_avm_contract_bytecode({ contract_bytecode });
+    AvmEnqueuedCallHint enqueued_call_hint{ .contract_address = contract_address, .calldata = {} };
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        AvmTraceBuilder trace_builder = AvmTraceBuilder(public_inputs, execution_hints)
+                                            .set_full_precomputed_tables(false)
+                                            .set_range_check_required(false);
+        std::vector<FF> returndata;
+        state.ResumeTiming();
+
+        AvmError error = Execution::execute_enqueued_call(
+            trace_builder, enqueued_call_hint, returndata, /*check_bytecode_membership=*/false);
+        DoNotOptimize(error);
+    }
+    state.counters["instructions_per_sec"] = Counter(
+        static_cast<double>(state.iterations()) * 2 * static_cast<double>(num_iterations), Counter::kIsRate);
+}
+
+/**
+ * Decoding cost alone: the instructions of the loop fetched by pc as they are executed, either parsed from the raw
+ * bytecode each time or looked up in the pre-decoded bytecode
+ */
+template <bool PRE_DECODED> void decode_loop(State& state) noexcept
+{
+    const auto num_iterations = static_cast<uint16_t>(state.range(0));
+    const std::vector<uint8_t> bytecode = counting_loop_bytecode(num_iterations);
+    const DecodedBytecode decoded(bytecode);
+    const uint32_t jumpi_pc = LOOP_PC + Deserialization::get_pc_increment(OpCode::SUB_8);
+
+    for (auto _ : state) {
+        for (uint16_t i = 0; i < num_iterations; i++) {
+            for (const uint32_t pc : { LOOP_PC, jumpi_pc }) {
+                if constexpr (PRE_DECODED) {
+                    DoNotOptimize(decoded.get_instruction(pc));
+                } else {
+                    DoNotOptimize(Deserialization::parse(bytecode, pc));
+                }
+            }
+        }
+    }
+    state.counters["instructions_per_sec"] = Counter(
+        static_cast<double>(state.iterations()) * 2 * static_cast<double>(num_iterations), Counter::kIsRate);
+}
+} // namespace
+
+BENCHMARK(execute_loop)->Unit(kMillisecond)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK_TEMPLATE(decode_loop, false)->Unit(kMicrosecond)->RangeMultiplier(4)->Range(256, 16384);
+BENCHMARK_TEMPLATE(decode_loop, true)->Unit(kMicrosecond)->RangeMultiplier(4)->Range(256, 16384);
+
+BENCHMARK_MAIN();
@@ -22,6 +22,7 @@
  */
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/task_group.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -31,6 +32,17 @@
 
 using namespace benchmark;
 using namespace bb;
+
+#ifndef NO_MULTITHREADING
+// The parallel_for backends (see common/thread.cpp)
+namespace bb {
+void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+#endif
+
 namespace {
 using Curve = curve::BN254;
 using Fr = Curve::ScalarField;
@@ -69,6 +81,61 @@ void parallel_for_field_element_addition(State& state)
     }
 }
 
+#ifndef NO_MULTITHREADING
+using ParallelForBackend = void (*)(size_t, const std::function<void(size_t)>&);
+
+/**
+ * @brief Fork/join overhead of a parallel_for backend: one empty iteration per cpu
+ */
+template <ParallelForBackend parallel_for_backend> void parallel_for_fork_join(State& state)
+{
+    const size_t num_cpus = get_num_cpus();
+    for (auto _ : state) {
+        parallel_for_backend(num_cpus, [](size_t index) { benchmark::DoNotOptimize(index); });
+    }
+}
+
+/**
+ * @brief Load balance of a parallel_for backend on irregular iterations
+ *
+ * @details Iteration i costs 64 * i field multiplications, so backends that hand out fixed chunks leave the threads
+ * that got the cheap iterations idle, while the dynamic backends keep every thread busy.
+ */
+template <ParallelForBackend parallel_for_backend> void parallel_for_irregular_workload(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const auto num_iterations = static_cast<size_t>(state.range(0));
+    std::vector<Fr> elements(num_iterations);
+    for (auto& element : elements) {
+        element = Fr::random_element(&engine);
+    }
+    for (auto _ : state) {
+        parallel_for_backend(num_iterations, [&](size_t index) {
+            Fr accumulator = elements[index];
+            for (size_t i = 0; i < 64 * index; i++) {
+                accumulator *= elements[index];
+            }
+            benchmark::DoNotOptimize(accumulator);
+        });
+    }
+}
+
+/**
+ * @brief A parallel_for nested in every iteration of a parallel_for, which only the work-stealing backend supports
+ * without aborting or spawning extra threads
+ */
+void parallel_for_work_stealing_nested(State& state)
+{
+    const size_t num_cpus = get_num_cpus();
+    const auto inner_iterations = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        parallel_for_work_stealing(num_cpus, [&](size_t) {
+            parallel_for_work_stealing(inner_iterations, [](size_t index) { benchmark::DoNotOptimize(index); });
+        });
+    }
+}
+#endif
+
 /**
  * @brief Evaluate how much finite addition costs (in cache)
  *
@@ -483,6 +550,19 @@ void bn254fr_random(State& state)
 } // namespace
 
 BENCHMARK(parallel_for_field_element_addition)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG);
+#ifndef NO_MULTITHREADING
+BENCHMARK(parallel_for_fork_join<parallel_for_spawning>)->Unit(kMicrosecond);
+BENCHMARK(parallel_for_fork_join<parallel_for_queued>)->Unit(kMicrosecond);
+BENCHMARK(parallel_for_fork_join<parallel_for_atomic_pool>)->Unit(kMicrosecond);
+BENCHMARK(parallel_for_fork_join<parallel_for_mutex_pool>)->Unit(kMicrosecond);
+BENCHMARK(parallel_for_fork_join<parallel_for_work_stealing>)->Unit(kMicrosecond);
+BENCHMARK(parallel_for_irregular_workload<parallel_for_spawning>)->Unit(kMicrosecond)->Arg(64)->Arg(512);
+BENCHMARK(parallel_for_irregular_workload<parallel_for_queued>)->Unit(kMicrosecond)->Arg(64)->Arg(512);
+BENCHMARK(parallel_for_irregular_workload<parallel_for_atomic_pool>)->Unit(kMicrosecond)->Arg(64)->Arg(512);
+BENCHMARK(parallel_for_irregular_workload<parallel_for_mutex_pool>)->Unit(kMicrosecond)->Arg(64)->Arg(512);
+BENCHMARK(parallel_for_irregular_workload<parallel_for_work_stealing>)->Unit(kMicrosecond)->Arg(64)->Arg(512);
+BENCHMARK(parallel_for_work_stealing_nested)->Unit(kMicrosecond)->Arg(16)->Arg(256);
+#endif
 BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
@@ -3,6 +3,9 @@
 #include "barretenberg/eccvm/eccvm_circuit_builder.hpp"
 #include "barretenberg/eccvm/eccvm_prover.hpp"
 #include "barretenberg/eccvm/eccvm_verifier.hpp"
+#include "barretenberg/goblin/goblin.hpp"
+
+#include <chrono>
 
 using namespace benchmark;
 using namespace bb;
@@ -12,9 +15,8 @@ using Builder = ECCVMCircuitBuilder;
 
 namespace {
 
-Builder generate_trace(size_t target_num_gates)
+void add_ecc_ops(const std::shared_ptr<ECCOpQueue>& op_queue, size_t num_iterations)
 {
-    std::shared_ptr<ECCOpQueue> op_queue = std::make_shared<ECCOpQueue>();
     using G1 = typename Flavor::CycleGroup;
     using Fr = typename G1::Fr;
 
@@ -25,9 +27,6 @@ Builder generate_trace(size_t target_num_gates)
     Fr x = Fr::random_element();
     Fr y = Fr::random_element();
 
-    // Each loop adds 163 gates. Note: builder.get_estimated_num_finalized_gates() is very expensive here (bug?) and
-    // it's actually painful to use a `while` loop
-    size_t num_iterations = target_num_gates / 163;
     for (size_t _ = 0; _ < num_iterations; _++) {
         op_queue->add_accumulate(a);
         op_queue->mul_accumulate(a, x);
@@ -37,6 +36,15 @@ Builder generate_trace(size_t target_num_gates)
         op_queue->mul_accumulate(b, x);
         op_queue->eq_and_reset();
     }
+}
+
+Builder generate_trace(size_t target_num_gates)
+{
+    std::shared_ptr<ECCOpQueue> op_queue = std::make_shared<ECCOpQueue>();
+
+    // Each loop adds 163 gates. Note: builder.get_estimated_num_finalized_gates() is very expensive here (bug?) and
+    // it's actually painful to use a `while` loop
+    add_ecc_ops(op_queue, target_num_gates / 163);
 
     Builder builder{ op_queue };
     return builder;
@@ -65,8 +73,43 @@ void eccvm_prove(State& state) noexcept
     };
 }
 
+/**
+ * @brief Construct the Goblin ECCVM and Translator proofs sequentially and pipelined, on the same ops
+ * @details The reported time is that of the pipelined prover. The counters give the sequential time and the wall clock
+ * saved by overlapping the Translator with the ECCVM opening proof. The argument is the number of rounds of 7 ECC ops;
+ * the Translator bounds the op queue to fewer than 1024 ops.
+ */
+void goblin_eccvm_translator_overlap(State& state) noexcept
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    bb::srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
+
+    const auto num_iterations = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        double sequential_ms = 0;
+        double pipelined_ms = 0;
+        for (bool pipelined : { false, true }) {
+            GoblinProver goblin;
+            add_ecc_ops(goblin.op_queue, num_iterations);
+            goblin.pipeline_eccvm_and_translator = pipelined;
+
+            auto start = std::chrono::steady_clock::now();
+            GoblinProof proof = goblin.prove();
+            auto end = std::chrono::steady_clock::now();
+            DoNotOptimize(proof);
+
+            double elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+            (pipelined ? pipelined_ms : sequential_ms) = elapsed_ms;
+        }
+        state.SetIterationTime(pipelined_ms / 1000);
+        state.counters["sequential_ms"] = sequential_ms;
+        state.counters["overlap_ms"] = sequential_ms - pipelined_ms;
+    }
+}
+
 BENCHMARK(eccvm_generate_prover)->Unit(kMillisecond)->DenseRange(12, 18);
 BENCHMARK(eccvm_prove)->Unit(kMillisecond)->DenseRange(12, 18);
+BENCHMARK(goblin_eccvm_translator_overlap)->Unit(kMillisecond)->UseManualTime()->Arg(16)->Arg(64)->Arg(128);
 } // namespace
 
 BENCHMARK_MAIN();
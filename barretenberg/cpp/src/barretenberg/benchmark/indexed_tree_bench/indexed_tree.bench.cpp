@@ -8,9 +8,11 @@
 #include "barretenberg/crypto/merkle_tree/node_store/cached_content_addressed_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <atomic>
 #include <benchmark/benchmark.h>
 #include <filesystem>
 #include <memory>
+#include <thread>
 #include <vector>
 
 using namespace benchmark;
@@ -97,6 +99,24 @@ void add_values_sequentially_with_witness(TreeType& tree, const std::vector<Null
     }
 }
 
+template <typename TreeType> void find_low_leaf(TreeType& tree, const fr& key)
+{
+    Signal signal(1);
+    bool success = true;
+    std::string error_message;
+    typename TreeType::FindLowLeafCallback completion = [&](const auto& result) -> void {
+        success = result.success;
+        error_message = result.message;
+        signal.signal_level(0);
+    };
+
+    tree.find_low_leaf(key, true, completion);
+    signal.wait_for_level(0);
+    if (!success) {
+        throw std::runtime_error(format("Failed to find low leaf: ", error_message));
+    }
+}
+
 enum InsertionStrategy { SEQUENTIAL, BATCH };
 
 template <typename TreeType, InsertionStrategy strategy> void multi_thread_indexed_tree_bench(State& state) noexcept
@@ -265,6 +285,81 @@ void single_thread_indexed_tree_with_witness_bench(State& state) noexcept
     }
 }
 
+/**
+ * @brief Measures the rate of uncommitted low leaf reads from N reader threads while a single writer keeps inserting
+ * batches into the same tree
+ * @details The writer stops once the readers are done, so the number of batches it got through is reported alongside
+ * the reads to tell whether the readers were contending with it
+ */
+template <typename TreeType> void concurrent_reads_with_writer_indexed_tree_bench(State& state) noexcept
+{
+    const size_t num_readers = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+    const size_t reads_per_reader = 1024;
+    const size_t writer_batch_size = 64;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    // one worker per reader plus one for the writer
+    auto num_threads = static_cast<uint32_t>(num_readers + 1);
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    TreeType tree = TreeType(std::move(store), workers, writer_batch_size);
+
+    const size_t initial_size = 1024 * 16;
+    std::vector<NullifierLeafValue> initial_batch(initial_size);
+    for (size_t i = 0; i < initial_size; ++i) {
+        initial_batch[i] = fr(random_engine.get_random_uint256());
+    }
+    add_values(tree, initial_batch);
+
+    std::vector<fr> keys(reads_per_reader);
+    for (auto& key : keys) {
+        key = fr(random_engine.get_random_uint256());
+    }
+    std::vector<std::vector<NullifierLeafValue>> writer_batches(16, std::vector<NullifierLeafValue>(writer_batch_size));
+    size_t total_reads = 0;
+    size_t total_writes = 0;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto& batch : writer_batches) {
+            for (auto& value : batch) {
+                value = fr(random_engine.get_random_uint256());
+            }
+        }
+        state.ResumeTiming();
+
+        std::atomic_bool reading = true;
+        size_t writes = 0;
+        std::thread writer([&]() {
+            for (; writes < writer_batches.size() && reading; ++writes) {
+                add_values(tree, writer_batches[writes]);
+            }
+        });
+        std::vector<std::thread> readers;
+        for (size_t r = 0; r < num_readers; ++r) {
+            readers.emplace_back([&]() {
+                for (const auto& key : keys) {
+                    find_low_leaf(tree, key);
+                }
+            });
+        }
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        reading = false;
+        writer.join();
+        total_reads += num_readers * reads_per_reader;
+        total_writes += writes * writer_batch_size;
+    }
+    state.counters["reads_per_sec"] = Counter(static_cast<double>(total_reads), Counter::kIsRate);
+    state.counters["writes_per_sec"] = Counter(static_cast<double>(total_writes), Counter::kIsRate);
+}
+
 BENCHMARK(single_thread_indexed_tree_with_witness_bench<Poseidon2, BATCH>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -361,4 +456,11 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2, SEQUENTIAL>)
     ->Range(512, 8192)
     ->Iterations(100);
 
+BENCHMARK(concurrent_reads_with_writer_indexed_tree_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Iterations(10);
+
 BENCHMARK_MAIN();
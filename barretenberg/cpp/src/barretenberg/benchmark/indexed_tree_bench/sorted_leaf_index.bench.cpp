@@ -0,0 +1,78 @@
+#include "barretenberg/crypto/merkle_tree/node_store/sorted_leaf_index.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <benchmark/benchmark.h>
+#include <map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& random_engine = bb::numeric::get_randomness();
+
+const size_t BATCH_SIZE = 1024;
+
+/**
+ * @brief The std::map the uncommitted leaf indices were previously held in, with the same low leaf search
+ */
+struct MapLeafIndex {
+    std::map<uint256_t, index_t> indices;
+
+    void insert(const uint256_t& key, const index_t& index) { indices.insert({ key, index }); }
+
+    std::optional<std::pair<uint256_t, index_t>> find_lower_or_equal(const uint256_t& key) const
+    {
+        auto it = indices.upper_bound(key);
+        if (it == indices.begin()) {
+            return std::nullopt;
+        }
+        --it;
+        return *it;
+    }
+};
+
+/**
+ * @brief Measures the access pattern of a batch insertion, a low leaf search followed by an insert for every key,
+ * against an index holding state.range(0) uncommitted leaves
+ */
+template <typename IndexType> void low_leaf_search_and_insert_bench(State& state) noexcept
+{
+    const auto initial_size = static_cast<size_t>(state.range(0));
+    IndexType initial_index;
+    for (size_t i = 0; i < initial_size; ++i) {
+        initial_index.insert(random_engine.get_random_uint256(), i);
+    }
+
+    IndexType leaf_index;
+    std::vector<uint256_t> keys(BATCH_SIZE);
+    for (auto _ : state) {
+        state.PauseTiming();
+        // start every batch from the same size so the iteration count doesn't change what is measured
+        leaf_index = initial_index;
+        index_t next_index = initial_size;
+        for (auto& key : keys) {
+            key = random_engine.get_random_uint256();
+        }
+        state.ResumeTiming();
+        for (const auto& key : keys) {
+            DoNotOptimize(leaf_index.find_lower_or_equal(key));
+            leaf_index.insert(key, next_index++);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BATCH_SIZE));
+}
+} // namespace
+
+BENCHMARK(low_leaf_search_and_insert_bench<MapLeafIndex>)
+    ->Unit(benchmark::kMicrosecond)
+    ->RangeMultiplier(4)
+    ->Range(1024 * 16, 1024 * 1024)
+    ->Iterations(64);
+
+BENCHMARK(low_leaf_search_and_insert_bench<SortedLeafIndex>)
+    ->Unit(benchmark::kMicrosecond)
+    ->RangeMultiplier(4)
+    ->Range(1024 * 16, 1024 * 1024)
+    ->Iterations(64);
+
+BENCHMARK_MAIN();
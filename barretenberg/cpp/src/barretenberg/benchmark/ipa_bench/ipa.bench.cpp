@@ -18,6 +18,12 @@ std::shared_ptr<VerifierCommitmentKey<Curve>> vk;
 std::vector<std::shared_ptr<NativeTranscript>> prover_transcripts(MAX_POLYNOMIAL_DEGREE_LOG2 -
                                                                   MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
 std::vector<OpeningClaim<Curve>> opening_claims(MAX_POLYNOMIAL_DEGREE_LOG2 - MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
+
+// Proofs for the comparison of batch verification with verifying one proof after the other
+constexpr size_t BATCHED_POLYNOMIAL_DEGREE_LOG2 = 14;
+constexpr size_t MAX_NUM_BATCHED_PROOFS = 16;
+std::vector<HonkProof> batched_proofs;
+std::vector<OpeningClaim<Curve>> batched_opening_claims;
 static void DoSetup(const benchmark::State&)
 {
     srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
@@ -26,6 +32,37 @@ static void DoSetup(const benchmark::State&)
                                                         srs::get_grumpkin_crs_factory());
 }
 
+static void DoBatchSetup(const benchmark::State& state)
+{
+    DoSetup(state);
+    if (!batched_proofs.empty()) {
+        return;
+    }
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << BATCHED_POLYNOMIAL_DEGREE_LOG2;
+    for (size_t k = 0; k < MAX_NUM_BATCHED_PROOFS; k++) {
+        Polynomial poly(n);
+        for (size_t i = 0; i < n; ++i) {
+            poly.at(i) = Fr::random_element(&engine);
+        }
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        batched_proofs.push_back(prover_transcript->proof_data);
+        batched_opening_claims.push_back({ opening_pair, ck->commit(poly) });
+    }
+}
+
+std::vector<std::shared_ptr<NativeTranscript>> batched_verifier_transcripts(size_t num_proofs)
+{
+    std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+    for (size_t k = 0; k < num_proofs; k++) {
+        transcripts.push_back(std::make_shared<NativeTranscript>(batched_proofs[k]));
+    }
+    return transcripts;
+}
+
 void ipa_open(State& state) noexcept
 {
     numeric::RNG& engine = numeric::get_debug_randomness();
@@ -66,6 +103,41 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+/**
+ * @brief Verify state.range(0) proofs one after the other, each with its own MSM over the SRS.
+ */
+void ipa_verify_one_by_one(State& state) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto verifier_transcripts = batched_verifier_transcripts(num_proofs);
+        state.ResumeTiming();
+        for (size_t k = 0; k < num_proofs; k++) {
+            auto result = IPA<Curve>::reduce_verify(vk, batched_opening_claims[k], verifier_transcripts[k]);
+            ASSERT(result);
+        }
+    }
+}
+
+/**
+ * @brief Verify state.range(0) proofs at once, with a single MSM over the SRS.
+ */
+void ipa_batch_verify(State& state) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    const std::vector<OpeningClaim<Curve>> claims(batched_opening_claims.begin(),
+                                                  batched_opening_claims.begin() +
+                                                      static_cast<std::ptrdiff_t>(num_proofs));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto verifier_transcripts = batched_verifier_transcripts(num_proofs);
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify(vk, claims, verifier_transcripts);
+        ASSERT(result);
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +147,14 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_verify_one_by_one)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_NUM_BATCHED_PROOFS)
+    ->Setup(DoBatchSetup);
+BENCHMARK(ipa_batch_verify)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_NUM_BATCHED_PROOFS)
+    ->Setup(DoBatchSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
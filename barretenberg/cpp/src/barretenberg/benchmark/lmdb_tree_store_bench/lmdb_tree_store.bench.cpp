@@ -0,0 +1,104 @@
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_db_transaction.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+
+enum RecordEncoding { MSGPACK, FIXED_LAYOUT };
+
+const std::string STORE_NAME = "bench";
+
+/**
+ * Writes the given number of nodes to a new store in the given directory and returns their hashes in a random order.
+ * MSGPACK writes the records as they were written before the fixed layout was introduced.
+ */
+std::vector<bb::fr> write_nodes(const std::string& directory, size_t numNodes, RecordEncoding encoding)
+{
+    std::vector<bb::fr> hashes(numNodes);
+    std::vector<NodePayload> nodes(numNodes);
+    for (size_t i = 0; i < numNodes; ++i) {
+        hashes[i] = bb::fr(random_engine.get_random_uint256());
+        nodes[i] = NodePayload{ .left = bb::fr(random_engine.get_random_uint256()),
+                                .right = bb::fr(random_engine.get_random_uint256()),
+                                .ref = 1 };
+    }
+
+    if (encoding == FIXED_LAYOUT) {
+        LMDBTreeStore store(directory, STORE_NAME, 1024 * 1024, 1);
+        LMDBTreeWriteTransaction::Ptr tx = store.create_write_transaction();
+        for (size_t i = 0; i < numNodes; ++i) {
+            store.write_node(hashes[i], nodes[i], *tx);
+        }
+        tx->commit();
+    } else {
+        LMDBEnvironment::SharedPtr env = std::make_shared<LMDBEnvironment>(directory, 1024 * 1024, 5, 1);
+        LMDBDatabaseCreationTransaction createTx(env);
+        LMDBDatabase db(env, createTx, STORE_NAME + NODES_DB, false, false, fr_key_cmp);
+        createTx.commit();
+        LMDBTreeWriteTransaction tx(env);
+        for (size_t i = 0; i < numNodes; ++i) {
+            msgpack::sbuffer buffer;
+            msgpack::pack(buffer, nodes[i]);
+            std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+            FrKeyType key(hashes[i]);
+            tx.put_value<FrKeyType>(key, encoded, db);
+        }
+        tx.commit();
+    }
+
+    std::shuffle(hashes.begin(), hashes.end(), std::mt19937_64(random_engine.get_random_uint64()));
+    return hashes;
+}
+
+/**
+ * Reads every committed node once per iteration, in a random order, through a single read transaction. The read
+ * cache is disabled so that every read is served from LMDB and decoded.
+ */
+template <RecordEncoding encoding> void read_committed_nodes_bench(State& state) noexcept
+{
+    const size_t numNodes = static_cast<size_t>(state.range(0));
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+
+    std::vector<bb::fr> hashes = write_nodes(directory, numNodes, encoding);
+    {
+        LMDBTreeStore store(directory, STORE_NAME, 1024 * 1024, 1, 0);
+        for (auto _ : state) {
+            LMDBTreeReadTransaction::Ptr tx = store.create_read_transaction();
+            NodePayload node;
+            for (const bb::fr& hash : hashes) {
+                store.read_node(hash, node, *tx);
+                DoNotOptimize(node);
+            }
+        }
+    }
+    state.counters["reads_per_sec"] =
+        Counter(static_cast<double>(state.iterations()) * static_cast<double>(numNodes), Counter::kIsRate);
+    std::filesystem::remove_all(directory);
+}
+} // namespace
+
+BENCHMARK(read_committed_nodes_bench<MSGPACK>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1024, 256 * 1024);
+
+BENCHMARK(read_committed_nodes_bench<FIXED_LAYOUT>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(1024, 256 * 1024);
+
+BENCHMARK_MAIN();
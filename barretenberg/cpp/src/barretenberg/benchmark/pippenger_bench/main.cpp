@@ -8,6 +8,8 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <string>
 
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
@@ -82,6 +84,73 @@ int pippenger()
     return 0;
 }
 
+// Peak resident set size of the process in KiB, 0 if it can not be read
+size_t get_peak_rss_kib()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoul(line.substr(6));
+        }
+    }
+    return 0;
+}
+
+// Reset the peak resident set size to the current one (Linux only, a no-op elsewhere)
+void reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+/**
+ * @brief Compare the full and the chunked (fixed memory budget) pippenger on the same input, reporting throughput and
+ * the growth in peak RSS over the inputs, which are already resident
+ */
+int pippenger_modes(const size_t chunk_size)
+{
+    PolynomialSpan<const curve::BN254::ScalarField> scalar_span{ 0, { &scalars[0], NUM_POINTS } };
+    auto report = [](const char* mode, std::chrono::microseconds time, size_t rss_before, size_t rss_after) {
+        const double points_per_second = static_cast<double>(NUM_POINTS) * 1e6 / static_cast<double>(time.count());
+        std::cout << mode << ": run time: " << time.count() << "us, throughput: " << points_per_second
+                  << " points/s, peak RSS growth: " << (rss_after - rss_before) << "KiB" << std::endl;
+    };
+
+    g1::element full_result;
+    {
+        reset_peak_rss();
+        const size_t rss_before = get_peak_rss_kib();
+        auto time_start = std::chrono::steady_clock::now();
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+        full_result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            scalar_span, reference_string->get_monomial_points(), state);
+        auto time_end = std::chrono::steady_clock::now();
+        report("full",
+               std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start),
+               rss_before,
+               get_peak_rss_kib());
+    }
+
+    g1::element chunked_result;
+    {
+        reset_peak_rss();
+        const size_t rss_before = get_peak_rss_kib();
+        auto time_start = std::chrono::steady_clock::now();
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(chunk_size);
+        chunked_result = scalar_multiplication::pippenger_chunked<curve::BN254>(
+            scalar_span, reference_string->get_monomial_points(), state, false);
+        auto time_end = std::chrono::steady_clock::now();
+        report("chunked",
+               std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start),
+               rss_before,
+               get_peak_rss_kib());
+    }
+
+    ASSERT(g1::affine_element(full_result) == g1::affine_element(chunked_result));
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -117,5 +186,13 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+
+    // Give the chunked mode an eighth of the scratch memory of the full one
+    const size_t memory_budget =
+        scalar_multiplication::pippenger_runtime_state<curve::BN254>::get_memory_footprint(NUM_POINTS / 8);
+    const size_t chunk_size = scalar_multiplication::get_pippenger_chunk_size<curve::BN254>(memory_budget);
+    std::cout << "comparing full and chunked pippenger (chunks of " << chunk_size << " points, scratch budget "
+              << memory_budget / 1024 << "KiB)" << std::endl;
+    pippenger_modes(chunk_size);
     return 0;
 }
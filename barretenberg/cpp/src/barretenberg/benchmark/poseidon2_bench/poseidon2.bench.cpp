@@ -41,4 +41,48 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+/**
+ * @brief Hashes one level of a Merkle tree (2^n children into 2^(n-1) parents) one pair at a time
+ */
+void poseidon2_merkle_level_per_pair_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> children(2 * num_pairs);
+    for (auto& child : children) {
+        child = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> parents(num_pairs);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_pairs; ++i) {
+            parents[i] = poseiden_hash_impl(children[2 * i], children[2 * i + 1]);
+        }
+        DoNotOptimize(parents.data());
+    }
+    state.counters["nodes/s"] =
+        Counter(static_cast<double>(num_pairs) * static_cast<double>(state.iterations()), Counter::kIsRate);
+}
+BENCHMARK(poseidon2_merkle_level_per_pair_bench)->RangeMultiplier(16)->Range(1 << 4, 1 << 12);
+
+/**
+ * @brief Hashes one level of a Merkle tree with the batched multi-lane permutation
+ */
+void poseidon2_merkle_level_batched_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<grumpkin::fq> left(num_pairs);
+    std::vector<grumpkin::fq> right(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        left[i] = grumpkin::fq::random_element();
+        right[i] = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> parents(num_pairs);
+    for (auto _ : state) {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(left, right, parents);
+        DoNotOptimize(parents.data());
+    }
+    state.counters["nodes/s"] =
+        Counter(static_cast<double>(num_pairs) * static_cast<double>(state.iterations()), Counter::kIsRate);
+}
+BENCHMARK(poseidon2_merkle_level_batched_bench)->RangeMultiplier(16)->Range(1 << 4, 1 << 12);
+
 BENCHMARK_MAIN();
\ No newline at end of file
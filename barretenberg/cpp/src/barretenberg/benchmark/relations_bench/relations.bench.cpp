@@ -1,10 +1,16 @@
+#include "barretenberg/ecc/fields/field_pack.hpp"
 #include "barretenberg/eccvm/eccvm_flavor.hpp"
 #include "barretenberg/protogalaxy/protogalaxy_prover_internal.hpp" // just for an alias; should perhaps move to prover
+#include "barretenberg/relations/nested_containers.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/translator_vm/translator_flavor.hpp"
 #include "barretenberg/ultra_honk/decider_keys.hpp"
+#include <array>
 #include <benchmark/benchmark.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace {
 auto& engine = bb::numeric::get_debug_randomness();
@@ -15,7 +21,41 @@ namespace bb::benchmark::relations {
 using Fr = bb::fr;
 using Fq = grumpkin::fr;
 
-// Generic helper for executing Relation::accumulate for the template specified input type
+// Inputs with random values in all entities, so that no relation is skipped and no arithmetic is trivial
+template <typename Input> Input random_input()
+{
+    Input input{};
+    for (auto& entity : input.get_all()) {
+        using Entity = std::remove_cvref_t<decltype(entity)>;
+        if constexpr (requires { Entity::get_random(); }) {
+            entity = Entity::get_random();
+        } else {
+            entity = Entity::random_element(&engine);
+        }
+    }
+    return input;
+}
+
+// Inputs over packs of field elements with random values in all lanes
+template <typename Input> Input random_packed_input()
+{
+    Input input{};
+    for (auto& entity : input.get_all()) {
+        for (auto& evaluation : entity.evaluations) {
+            using PackedFF = std::remove_cvref_t<decltype(evaluation)>;
+            std::array<typename PackedFF::field, PackedFF::NUM_LANES> lanes;
+            for (auto& lane : lanes) {
+                lane = PackedFF::field::random_element(&engine);
+            }
+            evaluation = PackedFF::load(lanes);
+        }
+    }
+    return input;
+}
+
+// Generic helper for executing Relation::accumulate for the template specified input type. The items processed are
+// the rows (or edges) on which the relation is executed, so that the reported items per second are the throughput of
+// the relation.
 template <typename Flavor, typename Relation, typename Input, typename Accumulator>
 void execute_relation(::benchmark::State& state)
 {
@@ -23,13 +63,34 @@ void execute_relation(::benchmark::State& state)
 
     auto params = bb::RelationParameters<FF>::get_random();
 
-    // Instantiate zero-initialized inputs and accumulator
-    Input input{};
+    // Instantiate random inputs and a zero-initialized accumulator
+    const auto input = random_input<Input>();
     Accumulator accumulator;
 
     for (auto _ : state) {
         Relation::accumulate(accumulator, input, params, 1);
     }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Execution of all relations of the Flavor on one edge, i.e. the Sumcheck prover work per edge once it is extended
+template <typename Flavor> void execute_all_relations_for_univariates(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using Relations = typename Flavor::Relations;
+
+    auto params = bb::RelationParameters<FF>::get_random();
+    const auto input = random_input<typename Flavor::ExtendedEdges>();
+    typename Flavor::SumcheckTupleOfTuplesOfUnivariates accumulators;
+
+    for (auto _ : state) {
+        [&]<size_t... relation_idx>(std::index_sequence<relation_idx...>) {
+            (std::tuple_element_t<relation_idx, Relations>::accumulate(
+                 std::get<relation_idx>(accumulators), input, params, 1),
+             ...);
+        }(std::make_index_sequence<Flavor::NUM_RELATIONS>());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
 }
 
 // Single execution of relation on values (FF), e.g. Sumcheck verifier / PG perturbator work
@@ -50,6 +111,26 @@ template <typename Flavor, typename Relation> void execute_relation_for_univaria
     execute_relation<Flavor, Relation, Input, Accumulator>(state);
 }
 
+// Single execution of relation on Sumcheck univariates over packs of field elements, i.e. Sumcheck prover work on
+// field_pack::NUM_LANES edges at once. The items processed are the edges, so that the throughput compares with the one
+// of execute_relation_for_univariates.
+template <typename Flavor, typename Relation> void execute_relation_for_packed_univariates(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using PackedFF = field_pack<typename FF::Params>;
+    using Accumulator =
+        typename RebindUnivariates<typename Relation::SumcheckTupleOfUnivariatesOverSubrelations, PackedFF>::type;
+
+    auto params = bb::RelationParameters<FF>::get_random();
+    const auto input = random_packed_input<typename Flavor::PackedExtendedEdges>();
+    Accumulator accumulator{};
+
+    for (auto _ : state) {
+        Relation::accumulate(accumulator, input, params, 1);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(PackedFF::NUM_LANES));
+}
+
 // Single execution of relation on PG univariates, i.e. PG combiner work
 template <typename Flavor, typename Relation> void execute_relation_for_pg_univariates(::benchmark::State& state)
 {
@@ -89,6 +170,24 @@ BENCHMARK(execute_relation_for_univariates<MegaFlavor, DatabusLookupRelation<Fr>
 BENCHMARK(execute_relation_for_univariates<MegaFlavor, Poseidon2ExternalRelation<Fr>>);
 BENCHMARK(execute_relation_for_univariates<MegaFlavor, Poseidon2InternalRelation<Fr>>);
 
+// Ultra relations on packs of edges (Sumcheck prover work)
+BENCHMARK(execute_relation_for_packed_univariates<UltraFlavor, UltraArithmeticRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<UltraFlavor, DeltaRangeConstraintRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<UltraFlavor, EllipticRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<UltraFlavor, AuxiliaryRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<UltraFlavor, LogDerivLookupRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<UltraFlavor, UltraPermutationRelation<Fr>>);
+
+// Goblin-Ultra only relations on packs of edges (Sumcheck prover work)
+BENCHMARK(execute_relation_for_packed_univariates<MegaFlavor, EccOpQueueRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<MegaFlavor, DatabusLookupRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<MegaFlavor, Poseidon2ExternalRelation<Fr>>);
+BENCHMARK(execute_relation_for_packed_univariates<MegaFlavor, Poseidon2InternalRelation<Fr>>);
+
+// All relations on one edge (Sumcheck prover work)
+BENCHMARK(execute_all_relations_for_univariates<UltraFlavor>);
+BENCHMARK(execute_all_relations_for_univariates<MegaFlavor>);
+
 // Ultra relations (verifier work)
 BENCHMARK(execute_relation_for_values<UltraFlavor, UltraArithmeticRelation<Fr>>);
 BENCHMARK(execute_relation_for_values<UltraFlavor, DeltaRangeConstraintRelation<Fr>>);
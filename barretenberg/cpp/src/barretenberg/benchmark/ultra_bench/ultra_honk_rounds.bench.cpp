@@ -46,6 +46,11 @@ BB_PROFILE static void test_round_inner(State& state, MegaProver& prover, size_t
             BB_REPORT_OP_COUNT_BENCH_CANCEL();
         }
     };
+    // The commitment key is otherwise created by OinkProver::prove, which the rounds are run without
+    auto& commitment_key = prover.proving_key->proving_key.commitment_key;
+    if (commitment_key == nullptr) {
+        commitment_key = std::make_shared<MegaFlavor::CommitmentKey>(prover.proving_key->proving_key.circuit_size);
+    }
     OinkProver<MegaFlavor> oink_prover(prover.proving_key, prover.transcript);
     time_if_index(PREAMBLE, [&] { oink_prover.execute_preamble_round(); });
     time_if_index(WIRE_COMMITMENTS, [&] { oink_prover.execute_wire_commitments_round(); });
@@ -60,6 +65,21 @@ BB_PROFILE static void test_round_inner(State& state, MegaProver& prover, size_t
     time_if_index(RELATION_CHECK, [&] { decider_prover.execute_relation_check_rounds(); });
     time_if_index(ZEROMORPH, [&] { decider_prover.execute_pcs_rounds(); });
 }
+/**
+ * @brief Upper bound on the bytes of prover polynomials and sumcheck book-keeping table moved by a sumcheck round.
+ * @details Round 0 reads the full polynomials. Each following round reads the rows of the previous round and writes
+ * them folded, i.e. half as many, to the book-keeping table. The folded rows are then read again to extend the edges,
+ * unless the fold is fused with the round univariate (see SumcheckProverRound::fuse_fold).
+ */
+static size_t sumcheck_round_bytes(size_t circuit_size, size_t round_idx, bool fuse_fold)
+{
+    const size_t row_bytes = MegaFlavor::NUM_ALL_ENTITIES * sizeof(MegaFlavor::FF);
+    if (round_idx == 0) {
+        return circuit_size * row_bytes;
+    }
+    return (fuse_fold ? 3 : 4) * (circuit_size >> round_idx) * row_bytes;
+}
+
 BB_PROFILE static void test_round(State& state, size_t index) noexcept
 {
     auto log2_num_gates = static_cast<size_t>(state.range(0));
@@ -74,6 +94,21 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
         state.ResumeTiming();
         // NOTE: google bench is very finnicky, must end in ResumeTiming() for correctness
     }
+    if (index == RELATION_CHECK) {
+        // The bytes moved by the default path, and by the fused one for comparison
+        const size_t circuit_size = prover.proving_key->proving_key.circuit_size;
+        const bool fuse_fold = SumcheckProverRound<MegaFlavor>(circuit_size).fuse_fold;
+        size_t total_bytes = 0;
+        size_t total_fused_bytes = 0;
+        for (size_t round_idx = 0; (circuit_size >> round_idx) > 1; round_idx++) {
+            total_bytes += sumcheck_round_bytes(circuit_size, round_idx, fuse_fold);
+            total_fused_bytes += sumcheck_round_bytes(circuit_size, round_idx, true);
+        }
+        state.counters["round_0_bytes"] = static_cast<double>(sumcheck_round_bytes(circuit_size, 0, fuse_fold));
+        state.counters["round_1_bytes"] = static_cast<double>(sumcheck_round_bytes(circuit_size, 1, fuse_fold));
+        state.counters["sumcheck_bytes"] = static_cast<double>(total_bytes);
+        state.counters["sumcheck_bytes_fused"] = static_cast<double>(total_fused_bytes);
+    }
 }
 #define ROUND_BENCHMARK(round)                                                                                         \
     static void ROUND_##round(State& state) noexcept                                                                   \
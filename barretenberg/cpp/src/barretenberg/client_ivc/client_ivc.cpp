@@ -311,6 +311,9 @@ ClientIVC::Proof ClientIVC::prove()
     }
 
     MergeProof& merge_proof = merge_verification_queue[0];
+    // The Translator proof only depends on the ECCVM transcript up to its opening, so it is proven concurrently with
+    // the ECCVM IPA proof; the proof is unchanged
+    goblin.pipeline_eccvm_and_translator = true;
     return { mega_proof, goblin.prove(merge_proof) };
 };
 
@@ -350,7 +353,8 @@ HonkProof ClientIVC::decider_prove() const
 {
     vinfo("prove decider...");
     fold_output.accumulator->proving_key.commitment_key = bn254_commitment_key;
-    MegaDeciderProver decider_prover(fold_output.accumulator);
+    MegaDeciderProver decider_prover(
+        fold_output.accumulator, std::make_shared<Flavor::Transcript>(), trace_usage_tracker);
     vinfo("finished decider proving.");
     return decider_prover.construct_proof();
 }
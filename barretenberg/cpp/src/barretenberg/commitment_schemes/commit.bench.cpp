@@ -247,6 +247,111 @@ template <typename Curve> void bench_commit_mock_z_perm_preprocessed(::benchmark
     }
 }
 
+// Mock the polynomials committed to in the wire commitment round: the four wires of an Ultra circuit, plus for Mega the
+// four ecc op wires and the databus columns, which are only populated over a short prefix of the trace
+template <typename FF> std::vector<Polynomial<FF>> mock_wire_set(const size_t num_points, const bool is_mega)
+{
+    constexpr size_t NUM_WIRES = 4;
+    constexpr size_t NUM_ECC_OP_WIRES = 4;
+    constexpr size_t NUM_DATABUS_COLUMNS = 6;
+    const size_t num_ecc_op_gates = num_points / 64;
+    const size_t databus_size = num_points / 256;
+
+    std::vector<Polynomial<FF>> polynomials;
+    for (size_t i = 0; i < NUM_WIRES; ++i) {
+        polynomials.emplace_back(Polynomial<FF>::random(num_points - 1, num_points, /*start_index=*/1));
+    }
+    if (is_mega) {
+        for (size_t i = 0; i < NUM_ECC_OP_WIRES; ++i) {
+            polynomials.emplace_back(Polynomial<FF>::random(num_ecc_op_gates, num_points, /*start_index=*/1));
+        }
+        for (size_t i = 0; i < NUM_DATABUS_COLUMNS; ++i) {
+            polynomials.emplace_back(Polynomial<FF>::random(databus_size, num_points, /*start_index=*/0));
+        }
+    }
+    return polynomials;
+}
+
+// Commit to a wire set one polynomial at a time
+template <typename Curve> void bench_commit_wire_set(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomials = mock_wire_set<Fr>(num_points, /*is_mega=*/state.range(1) != 0);
+    for (auto _ : state) {
+        for (const auto& polynomial : polynomials) {
+            benchmark::DoNotOptimize(key->commit(polynomial));
+        }
+    }
+}
+
+// Commit to a wire set with a single call to commit_batch
+template <typename Curve> void bench_commit_wire_set_batched(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomials = mock_wire_set<Fr>(num_points, /*is_mega=*/state.range(1) != 0);
+    const std::vector<PolynomialSpan<const Fr>> spans(polynomials.begin(), polynomials.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->commit_batch(spans));
+    }
+}
+
+// Generate a polynomial whose coefficients are drawn uniformly from {0, 1, ..., num_values - 1}. (Mimics a selector
+// for num_values = 2 or the lookup read counts for a small num_values).
+template <typename FF> Polynomial<FF> small_value_set_poly(const size_t size, const size_t num_values)
+{
+    auto& engine = numeric::get_debug_randomness();
+    auto polynomial = Polynomial<FF>(size);
+    for (size_t i = 0; i < size; i++) {
+        polynomial.at(i) = engine.get_random_uint32() % num_values;
+    }
+    return polynomial;
+}
+
+// Commit to a polynomial with few distinct values using the basic commit method
+template <typename Curve> void bench_commit_small_value_set(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = small_value_set_poly<Fr>(num_points, static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
+// Commit to a polynomial with few distinct values using commit_auto (which picks commit_small_value_set)
+template <typename Curve> void bench_commit_small_value_set_auto(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    const auto polynomial = small_value_set_poly<Fr>(num_points, static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        key->commit_auto(polynomial);
+    }
+}
+
+// Commit to a dense random polynomial using commit_auto, to measure the cost of the structure scan
+template <typename Curve> void bench_commit_random_auto(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    Polynomial<Fr> polynomial = Polynomial<Fr>::random(num_points);
+    for (auto _ : state) {
+        key->commit_auto(polynomial);
+    }
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -272,6 +377,23 @@ BENCHMARK(bench_commit_structured_random_poly<curve::BN254>)->Unit(benchmark::kM
 BENCHMARK(bench_commit_structured_random_poly_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
+// Args: { log2 of the number of points, number of distinct values }
+BENCHMARK(bench_commit_small_value_set<curve::BN254>)
+    ->ArgsProduct({ benchmark::CreateDenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2), { 2, 8 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_value_set_auto<curve::BN254>)
+    ->ArgsProduct({ benchmark::CreateDenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2), { 2, 8 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_random_auto<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+// Args: { log2 of the circuit size, 0 for the Ultra wire set / 1 for the Mega wire set }
+BENCHMARK(bench_commit_wire_set<curve::BN254>)
+    ->ArgsProduct({ benchmark::CreateDenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2), { 0, 1 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_wire_set_batched<curve::BN254>)
+    ->ArgsProduct({ benchmark::CreateDenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS, 2), { 0, 1 } })
+    ->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
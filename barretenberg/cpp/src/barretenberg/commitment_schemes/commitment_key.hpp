@@ -20,9 +20,13 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -121,6 +125,96 @@ template <class Curve> class CommitmentKey {
         return point;
     };
 
+    /**
+     * @brief Commit to several polynomials in one call, e.g. a set of wires or the Gemini fold polynomials
+     * @details Returns the same commitments as calling commit() on each polynomial in turn; the polynomials may have
+     * arbitrary start indices and sizes. The work shared across the batch is:
+     *  - the SRS is fetched and bounds-checked once, for the largest window of points any polynomial needs,
+     *  - the polynomials long enough for pippenger go through pippenger_batch, which reads each point once per round
+     *    for a batch of polynomials and adds it into the buckets of every polynomial of the batch,
+     *  - polynomials too short for pippenger, which would each run a tiny parallel_for of scalar multiplications, are
+     *    committed together in a single parallel pass over all of their terms,
+     *  - the commitments are converted to affine form with one shared field inversion instead of one per polynomial.
+     *
+     * @param polynomials univariate polynomials p_k(X) = ∑ᵢ aₖᵢ⋅Xⁱ
+     * @return Commitments C_k = [p_k(x)], in the order of the input
+     */
+    std::vector<Commitment> commit_batch(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        PROFILE_THIS_NAME("commit_batch");
+        using Element = typename Curve::Element;
+
+        // Bound the points used exactly as commit() does: by the smallest power-of-2 window that ends at or after the
+        // end of the polynomial and does not start below 0
+        size_t consumed_srs = 0;
+        for (const PolynomialSpan<const Fr>& polynomial : polynomials) {
+            const size_t dyadic_poly_size = numeric::round_up_power_2(polynomial.size());
+            const size_t end_index = polynomial.end_index();
+            consumed_srs = std::max(consumed_srs, std::max(end_index, dyadic_poly_size));
+        }
+        auto srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
+        if (consumed_srs > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  consumed_srs,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+        std::span<G1> point_table = srs->get_monomial_points();
+
+        // Below this many points pippenger falls back to one scalar multiplication per point (see
+        // pippenger_unsafe_optimized_for_non_dyadic_polys); collect those terms from every short polynomial instead
+        const size_t pippenger_threshold = get_num_cpus_pow2() * 8;
+        std::vector<std::pair<size_t, size_t>> short_poly_terms; // (polynomial index, coefficient index)
+
+        std::vector<size_t> long_poly_indices;
+        std::vector<PolynomialSpan<const Fr>> long_polys;
+        std::vector<Element> results(polynomials.size());
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            const PolynomialSpan<const Fr>& polynomial = polynomials[i];
+            results[i].self_set_infinity();
+            if (polynomial.size() <= pippenger_threshold) {
+                for (size_t j = 0; j < polynomial.size(); ++j) {
+                    short_poly_terms.emplace_back(i, j);
+                }
+                continue;
+            }
+            long_poly_indices.push_back(i);
+            long_polys.push_back(polynomial);
+        }
+
+        const std::vector<Element> long_poly_results =
+            scalar_multiplication::pippenger_batch<Curve>(long_polys, point_table);
+        for (size_t k = 0; k < long_poly_indices.size(); ++k) {
+            results[long_poly_indices[k]] = long_poly_results[k];
+        }
+
+        std::vector<Element> short_poly_products(short_poly_terms.size());
+        parallel_for(short_poly_terms.size(), [&](size_t k) {
+            const auto [poly_idx, coeff_idx] = short_poly_terms[k];
+            const PolynomialSpan<const Fr>& polynomial = polynomials[poly_idx];
+            short_poly_products[k] =
+                Element(point_table[(polynomial.start_index + coeff_idx) * 2]) * polynomial.span[coeff_idx];
+        });
+        for (size_t k = 0; k < short_poly_terms.size(); ++k) {
+            results[short_poly_terms[k].first] += short_poly_products[k];
+        }
+
+        // After batch normalization every z-coordinate is 1, so the affine coordinates can be read off directly
+        if (!results.empty()) {
+            Element::batch_normalize(results.data(), results.size());
+        }
+        std::vector<Commitment> commitments;
+        commitments.reserve(results.size());
+        for (const Element& result : results) {
+            if (result.is_point_at_infinity()) {
+                commitments.emplace_back(Commitment::infinity());
+            } else {
+                commitments.emplace_back(result.x, result.y);
+            }
+        }
+        return commitments;
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
@@ -332,6 +426,236 @@ template <class Curve> class CommitmentKey {
 
         return result;
     }
+
+    /**
+     * @brief Efficiently commit to a polynomial whose nonzero coefficients take only a handful of distinct values
+     * @details This is the shape of most precomputed selectors (0/1 or a few constants), the lookup read tags and
+     * small counters. Grouping the coefficients by value gives [p(x)] = ∑ᵥ v⋅(∑_{i : aᵢ = v} Gᵢ), so the SRS points of
+     * each value's coefficients are copied into one contiguous sequence (the value's "bucket") and each bucket is
+     * summed with BatchedAffineAddition. That costs one affine addition per nonzero coefficient plus one scalar
+     * multiplication per distinct value other than 1, and no MSM at all. Defaults to the conventional commit method if
+     * the polynomial has more than MAX_NUM_SMALL_SET_VALUES distinct nonzero values.
+     * @warning Makes a copy of the SRS points of all nonzero coefficients (but not of the endomorphism points).
+     *
+     * @param polynomial
+     * @return Commitment
+     */
+    Commitment commit_small_value_set(PolynomialSpan<const Fr> polynomial)
+    {
+        return commit_small_value_set(polynomial, compute_value_distribution(polynomial));
+    }
+
+    /**
+     * @brief Commit to a polynomial with the cheapest method its structure allows
+     * @details Computes the number of nonzero coefficients and, if there are few enough, the distinct nonzero values
+     * of the polynomial in one pass, then dispatches to
+     *  - commit_small_value_set if the nonzero coefficients take at most MAX_NUM_SMALL_SET_VALUES distinct values,
+     *  - commit_sparse if at most NONZERO_THRESHOLD percent of the coefficients are nonzero,
+     *  - commit_structured if active ranges are given (which itself falls back to commit when they are dense),
+     *  - commit otherwise.
+     * The scan is linear in the polynomial size and cheap next to any of the commitment methods, so this can be used
+     * for polynomials whose structure is not known up front, e.g. the precomputed selectors or the ECC op wires.
+     *
+     * @param polynomial
+     * @param active_ranges Optional ranges outside of which the polynomial is known to be zero
+     * @param final_active_wire_idx See commit_structured
+     * @return Commitment
+     */
+    Commitment commit_auto(PolynomialSpan<const Fr> polynomial,
+                           const std::vector<std::pair<size_t, size_t>>& active_ranges = {},
+                           size_t final_active_wire_idx = 0)
+    {
+        PROFILE_THIS_NAME("commit_auto");
+        // Percentage of nonzero coefficients beyond which there is nothing to gain from copying the nonzero inputs
+        constexpr size_t NONZERO_THRESHOLD = 75;
+
+        // Pippenger falls back to one scalar multiplication per point for short polynomials anyway
+        if (polynomial.size() <= get_num_cpus_pow2() * 8) {
+            return commit(polynomial);
+        }
+
+        ValueDistribution distribution = compute_value_distribution(polynomial);
+        if (distribution.has_small_value_set) {
+            return commit_small_value_set(polynomial, distribution);
+        }
+        if (distribution.num_nonzero * 100 <= polynomial.size() * NONZERO_THRESHOLD) {
+            return commit_sparse(polynomial);
+        }
+        if (!active_ranges.empty()) {
+            return commit_structured(polynomial, active_ranges, final_active_wire_idx);
+        }
+        return commit(polynomial);
+    }
+
+  private:
+    // The largest number of distinct nonzero values for which commit_small_value_set is used
+    static constexpr size_t MAX_NUM_SMALL_SET_VALUES = 16;
+
+    /**
+     * @brief The nonzero values of a polynomial and how often each occurs in each thread's block of coefficients
+     * @details values and value_counts are only populated if has_small_value_set, i.e. if there are at most
+     * MAX_NUM_SMALL_SET_VALUES distinct nonzero values.
+     */
+    struct ValueDistribution {
+        size_t num_nonzero = 0;
+        bool has_small_value_set = false;
+        size_t block_size = 0;
+        std::vector<Fr> values;
+        std::vector<std::vector<size_t>> value_counts; // [thread][index into values]
+    };
+
+    static ValueDistribution compute_value_distribution(PolynomialSpan<const Fr> polynomial)
+    {
+        PROFILE_THIS_NAME("compute_value_distribution");
+        const size_t poly_size = polynomial.size();
+        const size_t num_threads = calculate_num_threads(poly_size);
+        const size_t block_size = (poly_size + num_threads - 1) / num_threads; // round up
+
+        // Each thread records the distinct values of its block until it has seen more than MAX_NUM_SMALL_SET_VALUES
+        std::vector<size_t> thread_num_nonzero(num_threads, 0);
+        std::vector<uint8_t> thread_has_small_value_set(num_threads, 0);
+        std::vector<std::vector<Fr>> thread_values(num_threads);
+        std::vector<std::vector<size_t>> thread_value_counts(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+            auto& values = thread_values[thread_idx];
+            auto& counts = thread_value_counts[thread_idx];
+            bool tracking_values = true;
+            size_t num_nonzero = 0;
+            for (size_t idx = start; idx < end; ++idx) {
+                const Fr& scalar = polynomial.span[idx];
+                if (scalar.is_zero()) {
+                    continue;
+                }
+                ++num_nonzero;
+                if (!tracking_values) {
+                    continue;
+                }
+                const size_t value_idx = find_value(values, scalar);
+                if (value_idx < values.size()) {
+                    ++counts[value_idx];
+                } else if (values.size() < MAX_NUM_SMALL_SET_VALUES) {
+                    values.emplace_back(scalar);
+                    counts.emplace_back(1);
+                } else {
+                    tracking_values = false;
+                    values.clear();
+                    counts.clear();
+                }
+            }
+            thread_num_nonzero[thread_idx] = num_nonzero;
+            thread_has_small_value_set[thread_idx] = static_cast<uint8_t>(tracking_values);
+        });
+
+        ValueDistribution distribution;
+        distribution.block_size = block_size;
+        distribution.has_small_value_set = true;
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            distribution.num_nonzero += thread_num_nonzero[thread_idx];
+            if (thread_has_small_value_set[thread_idx] == 0) {
+                distribution.has_small_value_set = false;
+            }
+        }
+        if (!distribution.has_small_value_set) {
+            return distribution;
+        }
+
+        // Merge the values found by each thread and re-index the per-thread counts by the merged values
+        distribution.value_counts.resize(num_threads);
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            for (const Fr& value : thread_values[thread_idx]) {
+                if (find_value(distribution.values, value) == distribution.values.size()) {
+                    distribution.values.emplace_back(value);
+                }
+            }
+            if (distribution.values.size() > MAX_NUM_SMALL_SET_VALUES) {
+                distribution.has_small_value_set = false;
+                distribution.values.clear();
+                distribution.value_counts.clear();
+                return distribution;
+            }
+        }
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            auto& counts = distribution.value_counts[thread_idx];
+            counts.resize(distribution.values.size(), 0);
+            for (auto [value, count] : zip_view(thread_values[thread_idx], thread_value_counts[thread_idx])) {
+                counts[find_value(distribution.values, value)] = count;
+            }
+        }
+        return distribution;
+    }
+
+    // Index of value in values, or values.size() if it is not present
+    static size_t find_value(const std::vector<Fr>& values, const Fr& value)
+    {
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (values[i] == value) {
+                return i;
+            }
+        }
+        return values.size();
+    }
+
+    Commitment commit_small_value_set(PolynomialSpan<const Fr> polynomial, const ValueDistribution& distribution)
+    {
+        PROFILE_THIS_NAME("commit_small_value_set");
+        using Element = typename Curve::Element;
+
+        if (!distribution.has_small_value_set) {
+            return commit(polynomial);
+        }
+        ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+
+        const size_t poly_size = polynomial.size();
+        const size_t num_values = distribution.values.size();
+        const size_t num_threads = distribution.value_counts.size();
+        const size_t block_size = distribution.block_size;
+
+        // The buckets are laid out one after the other in order of value. Within a bucket, each thread writes the
+        // points of its block to its own contiguous slice, so the buckets can be filled in parallel.
+        std::vector<size_t> sequence_counts(num_values, 0);
+        std::vector<std::vector<size_t>> thread_offsets(num_threads, std::vector<size_t>(num_values));
+        size_t offset = 0;
+        for (size_t value_idx = 0; value_idx < num_values; ++value_idx) {
+            for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+                thread_offsets[thread_idx][value_idx] = offset;
+                offset += distribution.value_counts[thread_idx][value_idx];
+                sequence_counts[value_idx] += distribution.value_counts[thread_idx][value_idx];
+            }
+        }
+
+        // Extract the raw SRS points (at the even indices of the point table) of the nonzero coefficients
+        std::span<G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
+        std::vector<G1> points(distribution.num_nonzero);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+            std::vector<size_t> offsets = thread_offsets[thread_idx];
+            for (size_t idx = start; idx < end; ++idx) {
+                const Fr& scalar = polynomial.span[idx];
+                if (!scalar.is_zero()) {
+                    points[offsets[find_value(distribution.values, scalar)]++] = point_table[idx * 2];
+                }
+            }
+        });
+
+        // Reduce each bucket to a single point, then weight the buckets by their values
+        Element result;
+        result.self_set_infinity();
+        if (points.empty()) {
+            return result;
+        }
+        auto bucket_sums = BatchedAffineAddition<Curve>::add_in_place(points, sequence_counts);
+        for (auto [value, bucket_sum] : zip_view(distribution.values, bucket_sums)) {
+            if (value == Fr::one()) {
+                result += bucket_sum;
+            } else {
+                result += Element(bucket_sum) * value;
+            }
+        }
+        return result;
+    }
 };
 
 } // namespace bb
@@ -248,6 +248,62 @@ TYPED_TEST(GeminiTest, DoubleWithShift)
                                            RefVector(multilinear_commitments_to_be_shifted));
 }
 
+TYPED_TEST(GeminiTest, DoubleWithShiftAndZeroTails)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Commitment = typename TypeParam::AffineElement;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t n = 16;
+    const size_t log_n = 4;
+
+    auto u = this->random_evaluation_point(log_n);
+
+    // Polynomials backed on a prefix of the hypercube, so that A₀ = F + G↺ vanishes from index 5 on
+    Polynomial poly1(5, n);
+    Polynomial poly2(4, n, 1); // make 'shiftable'
+    for (size_t i = 0; i < 5; ++i) {
+        poly1.at(i) = Fr::random_element();
+    }
+    for (size_t i = 1; i < 5; ++i) {
+        poly2.at(i) = Fr::random_element();
+    }
+
+    auto commitment1 = this->commit(poly1);
+    auto commitment2 = this->commit(poly2);
+
+    auto eval1 = poly1.evaluate_mle(u);
+    auto eval2 = poly2.evaluate_mle(u);
+    auto eval2_shift = poly2.evaluate_mle(u, true);
+
+    // The folds are only backed on the part of the hypercube where they can be non-zero, the second one on an odd
+    // number of coefficients
+    Polynomial batched_unshifted(n);
+    batched_unshifted += poly1;
+    auto fold_polynomials = GeminiProver_<TypeParam>::compute_fold_polynomials(
+        log_n, u, std::move(batched_unshifted), Polynomial::shiftable(n));
+    EXPECT_EQ(fold_polynomials[2].size(), 3);
+    EXPECT_EQ(fold_polynomials[3].size(), 2);
+    EXPECT_EQ(fold_polynomials[4].size(), 1);
+    EXPECT_EQ(fold_polynomials[4].virtual_size(), 2);
+
+    // Collect multilinear polynomials evaluations, and commitments for input to prover/verifier
+    std::vector<Fr> multilinear_evaluations_unshifted = { eval1, eval2 };
+    std::vector<Fr> multilinear_evaluations_shifted = { eval2_shift };
+    std::vector<Polynomial> multilinear_polynomials = { poly1.share(), poly2.share() };
+    std::vector<Polynomial> multilinear_polynomials_to_be_shifted = { poly2.share() };
+    std::vector<Commitment> multilinear_commitments = { commitment1, commitment2 };
+    std::vector<Commitment> multilinear_commitments_to_be_shifted = { commitment2 };
+
+    this->execute_gemini_and_verify_claims(u,
+                                           RefVector(multilinear_evaluations_unshifted),
+                                           RefVector(multilinear_evaluations_shifted),
+                                           RefVector(multilinear_polynomials),
+                                           RefVector(multilinear_polynomials_to_be_shifted),
+                                           RefVector(multilinear_commitments),
+                                           RefVector(multilinear_commitments_to_be_shifted));
+}
+
 TYPED_TEST(GeminiTest, DoubleWithShiftAndConcatenation)
 {
     using Fr = typename TypeParam::ScalarField;
@@ -113,11 +113,14 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
                                                      std::move(batched_to_be_shifted),
                                                      std::move(batched_concatenated));
 
+    // Commit to the folds Aₗ, l = 1, ..., m-1, in one batch (the first two entries of fold_polynomials are F and G)
+    std::vector<PolynomialSpan<const Fr>> folds_to_commit(fold_polynomials.begin() + 2, fold_polynomials.end());
+    const auto fold_commitments = commitment_key->commit_batch(folds_to_commit);
+
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1159): Decouple constants from primitives.
     for (size_t l = 0; l < CONST_PROOF_SIZE_LOG_N - 1; l++) {
         if (l < log_n - 1) {
-            transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1),
-                                         commitment_key->commit(fold_polynomials[l + 2]));
+            transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1), fold_commitments[l]);
         } else {
             transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1), Commitment::one());
         }
@@ -179,49 +182,62 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
 
     A_0 += batched_G.shifted();
 
+    // Aₗ vanishes beyond the last non-zero coefficient of A₀ halved l times, which is well below the dyadic size when
+    // the batched polynomials have zero tails (e.g. short or structured traces). Each fold is therefore only backed up
+    // to that point, so that the folding and the commitments to the folds skip the zero tails.
+    size_t A_l_end = A_0.end_index();
+    while (A_l_end > 1 && A_0[A_l_end - 1].is_zero()) {
+        A_l_end--;
+    }
+
     // Allocate everything before parallel computation
     for (size_t l = 0; l < num_variables - 1; ++l) {
         // size of the previous polynomial/2
         const size_t n_l = 1 << (num_variables - l - 1);
+        A_l_end = (A_l_end + 1) >> 1;
 
         // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
+        fold_polynomials.emplace_back(Polynomial(A_l_end, n_l));
     }
 
     // A_l = Aₗ(X) is the polynomial being folded
     // in the first iteration, we take the batched polynomial
     // in the next iteration, it is the previously folded one
     auto A_l = A_0.data();
+    size_t A_l_size = A_0.size();
     for (size_t l = 0; l < num_variables - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
+        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
+        auto A_l_fold = fold_polynomials[l + offset_to_folded].data();
+        const size_t fold_size = fold_polynomials[l + offset_to_folded].size();
+        // The coefficients of Aₗ beyond 2 * fold_size are zero. If Aₗ is backed on an odd number of coefficients, the
+        // odd coefficient of its last pair is zero and that pair is folded separately.
+        const size_t num_full_pairs = std::min(fold_size, A_l_size >> 1);
 
         // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
         // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
+        size_t num_used_threads = std::min(num_full_pairs / efficient_operations_per_thread, num_threads);
         num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
+        const size_t chunk_size = num_full_pairs / num_used_threads;
 
         // Openning point is the same for all
         const Fr u_l = mle_opening_point[l];
 
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = fold_polynomials[l + offset_to_folded].data();
-
         parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
+            const size_t start = i * chunk_size;
+            const size_t end = (i == num_used_threads - 1) ? num_full_pairs : start + chunk_size;
+            for (size_t j = start; j < end; j++) {
                 // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
                 //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
                 //            = Aₗ₊₁[j]
                 A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
             }
         });
+        if (num_full_pairs < fold_size) {
+            A_l_fold[num_full_pairs] = A_l[num_full_pairs << 1] * (Fr(1) - u_l);
+        }
         // set Aₗ₊₁ = Aₗ for the next iteration
         A_l = A_l_fold;
+        A_l_size = fold_size;
     }
 
     return fold_polynomials;
@@ -11,6 +11,7 @@
 #include "barretenberg/stdlib/honk_verifier/ipa_accumulator.hpp"
 #include "barretenberg/stdlib/transcript/transcript.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <string>
@@ -293,6 +294,20 @@ template <typename Curve_> class IPA {
         transcript->send_to_verifier("IPA:a_0", a_vec[0]);
     }
 
+    /**
+     * @brief The data of a natively verified IPA proof that remains once its rounds are reduced.
+     */
+    struct NativeReducedProof {
+        size_t poly_length;
+        size_t log_poly_length;
+        std::vector<Fr> round_challenges_inv;
+        Commitment aux_generator;
+        GroupElement C_zero;
+        Fr b_zero;
+        Commitment G_zero_sent;
+        Fr a_zero;
+    };
+
     /**
      * @brief Natively verify the correctness of a Proof
      *
@@ -323,6 +338,40 @@ template <typename Curve_> class IPA {
                                                       auto& transcript)
         requires(!Curve::is_stdlib_type)
     {
+        // Steps 1 to 6, receiving G₀ and a₀ along the way
+        NativeReducedProof proof = reduce_rounds_native(vk, opening_claim, transcript);
+
+        // Step 7.
+        // Construct vector s
+        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(proof.log_poly_length, std::span(proof.round_challenges_inv).subspan(0, proof.log_poly_length)));
+
+        std::vector<Commitment> G_vec_local = get_G_vector(vk, proof.poly_length);
+
+        // Step 8.
+        // Compute G₀
+        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+           s_poly, {&G_vec_local[0], /*size*/ proof.poly_length}, vk->pippenger_runtime_state);
+        ASSERT(G_zero == proof.G_zero_sent && "G_0 should be equal to G_0 sent in transcript.");
+
+        // Step 10.
+        // Compute C_right
+        GroupElement right_hand_side = G_zero * proof.a_zero + proof.aux_generator * proof.a_zero * proof.b_zero;
+        // Step 11.
+        // Check if C_right == C₀
+        return (proof.C_zero.normalize() == right_hand_side.normalize());
+    }
+
+    /**
+     * @brief Perform the steps of the native verification of an IPA proof that are linear in the number of rounds, see
+     * \link IPA::reduce_verify_internal_native reduce_verify_internal_native \endlink, and receive the \f$G_0\f$ and
+     * \f$a_0\f$ sent by the prover.
+     */
+    static NativeReducedProof reduce_rounds_native(const std::shared_ptr<VK>& vk,
+                                                   const OpeningClaim<Curve>& opening_claim,
+                                                   auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        NativeReducedProof proof;
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
         auto poly_length = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
@@ -344,6 +393,9 @@ template <typename Curve_> class IPA {
         if (log_poly_length > CONST_ECCVM_LOG_N) {
             throw_or_abort("IPA log_poly_length is too large " + std::to_string(log_poly_length));
         }
+        if (static_cast<size_t>(poly_length) * 2 > vk->get_monomial_points().size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
         // Step 3.
         // Compute C' = C + f(\beta) ⋅ U
         GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
@@ -379,7 +431,7 @@ template <typename Curve_> class IPA {
         // Compute C₀ = C' + ∑_{j ∈ [k]} u_j^{-1}L_j + ∑_{j ∈ [k]} u_jR_j
         GroupElement LR_sums = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
             {0, {&msm_scalars[0], /*size*/ pippenger_size}}, {&msm_elements[0], /*size*/ pippenger_size}, vk->pippenger_runtime_state);
-        GroupElement C_zero = C_prime + LR_sums;
+        proof.C_zero = C_prime + LR_sums;
 
         //  Step 6.
         // Compute b_zero where b_zero can be computed using the polynomial:
@@ -391,15 +443,25 @@ template <typename Curve_> class IPA {
                                    opening_claim.opening_pair.challenge.pow(1 << i));
         }
 
-        // Step 7.
-        // Construct vector s
-        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(log_poly_length, std::span(round_challenges_inv).subspan(0, log_poly_length)));
+        // Receive G₀ and a₀ from the prover
+        proof.G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+        proof.a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+
+        proof.poly_length = poly_length;
+        proof.log_poly_length = log_poly_length;
+        proof.round_challenges_inv = std::move(round_challenges_inv);
+        proof.aux_generator = aux_generator;
+        proof.b_zero = b_zero;
+        return proof;
+    }
 
+    /**
+     * @brief Copy the first poly_length points of the SRS to local memory.
+     */
+    static std::vector<Commitment> get_G_vector(const std::shared_ptr<VK>& vk, const size_t poly_length)
+        requires(!Curve::is_stdlib_type)
+    {
         std::span<const Commitment> srs_elements = vk->get_monomial_points();
-        if (poly_length * 2 > srs_elements.size()) {
-            throw_or_abort("potential bug: Not enough SRS points for IPA!");
-        }
-        // Copy the G_vector to local memory.
         std::vector<Commitment> G_vec_local(poly_length);
 
         // The SRS stored in the commitment key is the result after applying the pippenger point table so the
@@ -410,24 +472,59 @@ template <typename Curve_> class IPA {
             [&](size_t i) {
                 G_vec_local[i] = srs_elements[i * 2];
             }, thread_heuristics::FF_COPY_COST * 2);
+        return G_vec_local;
+    }
 
-        // Step 8.
-        // Compute G₀
-        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-           s_poly, {&G_vec_local[0], /*size*/ poly_length}, vk->pippenger_runtime_state);
-        Commitment G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
-        ASSERT(G_zero == G_zero_sent && "G_0 should be equal to G_0 sent in transcript.");
+    /**
+     * @brief Natively verify many IPA proofs at the cost of about one MSM of the size of the longest of them.
+     * @details Verifying the proofs one by one computes \f$G_0=\langle \vec{s},\vec{G}\rangle\f$ with an MSM of
+     * size \f$d\f$ for each proof. Instead, the final equation \f$C_0 = a_0 G_0 + a_0 b_0 U\f$ of each proof is
+     * checked against the \f$G_0\f$ sent by the prover, which only costs the MSM over the \f$L_j, R_j\f$ and a few
+     * scalar multiplications. The sent \f$G_0^{(k)}\f$ are then all checked at once by sampling random
+     * \f$\rho_k\f$ and checking
+     * \f$\sum_k \rho_k G_0^{(k)} = \langle \sum_k \rho_k \vec{s}^{(k)}, \vec{G}\rangle\f$, whose right hand side is a
+     * single MSM. If one of the \f$G_0^{(k)}\f$ is wrong, this check passes with probability at most
+     * \f$1/|\mathbb{F}_r|\f$.
+     */
+    static bool batch_reduce_verify_internal_native(const std::shared_ptr<VK>& vk,
+                                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                                    const auto& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        ASSERT(opening_claims.size() == transcripts.size());
+
+        std::vector<NativeReducedProof> proofs;
+        proofs.reserve(opening_claims.size());
+        size_t max_poly_length = 0;
+        for (size_t k = 0; k < opening_claims.size(); k++) {
+            proofs.emplace_back(reduce_rounds_native(vk, opening_claims[k], transcripts[k]));
+            max_poly_length = std::max(max_poly_length, size_t{ 1 } << proofs.back().log_poly_length);
+        }
 
-        // Step 9.
-        // Receive a₀ from the prover
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        // Check C₀ = a₀G₀ + a₀b₀U for each proof, with G₀ as sent by the prover
+        for (const auto& proof : proofs) {
+            GroupElement right_hand_side =
+                proof.G_zero_sent * proof.a_zero + proof.aux_generator * proof.a_zero * proof.b_zero;
+            if (proof.C_zero.normalize() != right_hand_side.normalize()) {
+                return false;
+            }
+        }
+        if (proofs.empty()) {
+            return true;
+        }
 
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+        // Check ∑ ρ_k G₀⁽ᵏ⁾ = ⟨∑ ρ_k s⁽ᵏ⁾, G⟩
+        Polynomial<Fr> batched_s_poly(max_poly_length);
+        GroupElement batched_G_zero = GroupElement::infinity();
+        for (const auto& proof : proofs) {
+            const Fr batching_scalar = Fr::random_element();
+            batched_s_poly.add_scaled(construct_poly_from_u_challenges_inv(proof.log_poly_length, std::span(proof.round_challenges_inv).subspan(0, proof.log_poly_length)), batching_scalar);
+            batched_G_zero += proof.G_zero_sent * batching_scalar;
+        }
+        std::vector<Commitment> G_vec_local = get_G_vector(vk, max_poly_length);
+        Commitment expected_G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+           batched_s_poly, {&G_vec_local[0], /*size*/ max_poly_length}, vk->pippenger_runtime_state);
+        return expected_G_zero == Commitment(batched_G_zero);
     }
     /**
      * @brief  Recursively verify the correctness of an IPA proof, without computing G_zero. Unlike native verification, there is no
@@ -573,6 +670,26 @@ template <typename Curve_> class IPA {
         return reduce_verify_internal_native(vk, opening_claim, transcript);
     }
 
+    /**
+     * @brief Natively verify the correctness of many IPA proofs at once, with a single MSM over the SRS.
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The opening claims of the proofs
+     * @param transcripts The transcripts of the proofs, in the same order as the claims
+     *
+     * @return true/false depending on if all the proofs verify
+     *
+     *@remark The batching is documented in \link IPA::batch_reduce_verify_internal_native
+     *batch_reduce_verify_internal_native \endlink.
+     */
+    static bool batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                    const std::vector<std::shared_ptr<NativeTranscript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        return batch_reduce_verify_internal_native(vk, opening_claims, transcripts);
+    }
+
     /**
      * @brief Recursively verify the correctness of a proof
      *
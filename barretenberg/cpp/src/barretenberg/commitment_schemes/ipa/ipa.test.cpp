@@ -225,6 +225,57 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    // Proofs of polynomials of different sizes
+    const std::vector<size_t> sizes = { 128, 64, 128, 32 };
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (const size_t n : sizes) {
+        auto poly = Polynomial::random(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+        proofs.push_back(prover_transcript->proof_data);
+    }
+    const auto verifier_transcripts = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (const auto& proof : proofs) {
+            transcripts.push_back(std::make_shared<NativeTranscript>(proof));
+        }
+        return transcripts;
+    };
+
+    EXPECT_TRUE(IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts()));
+
+    // A single wrong claim makes the batch fail
+    opening_claims[1].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts()));
+    opening_claims[1].opening_pair.evaluation -= Fr::one();
+
+    // A wrong G₀ sent along with the commitment C + a₀Δ still satisfies C₀ = a₀G₀ + a₀b₀U, as nothing after G₀ is
+    // hashed, so only the batched MSM over the s polynomials can catch it
+    constexpr size_t COMMITMENT_SIZE = bb::field_conversion::calc_num_bn254_frs<Commitment>();
+    constexpr size_t SCALAR_SIZE = bb::field_conversion::calc_num_bn254_frs<Fr>();
+    auto& tampered_proof = proofs[2];
+    const size_t G_zero_index = tampered_proof.size() - COMMITMENT_SIZE - SCALAR_SIZE;
+    const auto G_zero = bb::field_conversion::convert_from_bn254_frs<Commitment>(
+        std::span<const bb::fr>(tampered_proof).subspan(G_zero_index, COMMITMENT_SIZE));
+    const auto a_zero = bb::field_conversion::convert_from_bn254_frs<Fr>(
+        std::span<const bb::fr>(tampered_proof).subspan(G_zero_index + COMMITMENT_SIZE, SCALAR_SIZE));
+    const Commitment delta = Commitment::one() * Fr::random_element();
+    const auto tampered_G_zero = bb::field_conversion::convert_to_bn254_frs(Commitment(G_zero + delta));
+    std::copy(tampered_G_zero.begin(),
+              tampered_G_zero.end(),
+              tampered_proof.begin() + static_cast<std::ptrdiff_t>(G_zero_index));
+    opening_claims[2].commitment = opening_claims[2].commitment + delta * a_zero;
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts()));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -354,4 +354,106 @@ TYPED_TEST(CommitmentKeyTest, CommitStructuredNonzeroComplement)
     EXPECT_EQ(result, expected_result);
 }
 
+/**
+ * @brief Test that commit_batch agrees with committing to each polynomial separately, for a batch mixing full, offset,
+ * short (below the pippenger threshold), zero and empty polynomials
+ */
+TYPED_TEST(CommitmentKeyTest, CommitBatch)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+
+    std::vector<Polynomial> polynomials;
+    polynomials.emplace_back(Polynomial::random(num_points));
+    polynomials.emplace_back(Polynomial::random(num_points - 1));
+    polynomials.emplace_back(Polynomial::random(1000, num_points, /*start_index=*/1 << 10));
+    polynomials.emplace_back(Polynomial::random(3, num_points, /*start_index=*/1 << 11));
+    polynomials.emplace_back(Polynomial::random(5));
+    polynomials.emplace_back(Polynomial(num_points));
+    polynomials.emplace_back(Polynomial(0, num_points));
+    std::vector<PolynomialSpan<const Fr>> spans(polynomials.begin(), polynomials.end());
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    auto results = key->commit_batch(spans);
+
+    ASSERT_EQ(results.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(results[i], key->commit(polynomials[i]));
+    }
+}
+
+/**
+ * @brief Test commit_small_value_set on polynomials resembling a 0/1 selector and a small counter column
+ */
+TYPED_TEST(CommitmentKeyTest, CommitSmallValueSet)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t start_index = 1;
+    auto& engine = numeric::get_debug_randomness();
+
+    Polynomial selector(num_points - start_index, num_points, start_index);
+    Polynomial counts(num_points - start_index, num_points, start_index);
+    for (size_t i = start_index; i < num_points; ++i) {
+        selector.at(i) = engine.get_random_uint8() & 1;
+        counts.at(i) = engine.get_random_uint8() % 5;
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 selector_result = key->commit_small_value_set(selector);
+    G1 counts_result = key->commit_small_value_set(counts);
+
+    EXPECT_EQ(selector_result, key->commit(selector));
+    EXPECT_EQ(counts_result, key->commit(counts));
+}
+
+/**
+ * @brief Test that commit_auto agrees with commit whichever method it picks
+ */
+TYPED_TEST(CommitmentKeyTest, CommitAuto)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    auto& engine = numeric::get_debug_randomness();
+
+    std::vector<Polynomial> polynomials;
+    // Dense
+    polynomials.emplace_back(Polynomial::random(num_points));
+    // Sparse with random values
+    polynomials.emplace_back(Polynomial(num_points));
+    for (size_t i = 0; i < num_points; i += 7) {
+        polynomials.back().at(i) = Fr::random_element();
+    }
+    // Dense with more values than the small value set path allows, but few enough to track for a while
+    polynomials.emplace_back(Polynomial(num_points));
+    for (size_t i = 0; i < num_points; ++i) {
+        polynomials.back().at(i) = engine.get_random_uint8() % 32;
+    }
+    // Dense with a single value, e.g. a constant selector
+    polynomials.emplace_back(Polynomial(num_points - 1, num_points, 1));
+    for (size_t i = 1; i < num_points; ++i) {
+        polynomials.back().at(i) = Fr(-3);
+    }
+    // Zero
+    polynomials.emplace_back(Polynomial(num_points));
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    for (auto& polynomial : polynomials) {
+        EXPECT_EQ(key->commit_auto(polynomial), key->commit(polynomial));
+    }
+}
+
 } // namespace bb
@@ -99,8 +99,12 @@ ThreadPool::~ThreadPool()
     }
 }
 
+// Set on every thread that is currently executing parallel_for iterations (the pool workers and the caller)
+thread_local bool inside_parallel_for = false;
+
 void ThreadPool::worker_loop(size_t /*unused*/)
 {
+    inside_parallel_for = true;
     // info("created worker ", worker_num);
     while (true) {
         {
@@ -121,22 +125,31 @@ namespace bb {
 /**
  * A thread pooled strategy that uses std::mutex for protection. Each worker increments the "iteration" and processes.
  * The main thread acts as a worker also, and when it completes, it spins until thread workers are done.
+ *
+ * The pool runs one job at a time. Nesting parallel_for inside a job is an error. Two independent threads may however
+ * call parallel_for at the same time (e.g. when the Goblin ECCVM and Translator provers overlap), in which case the
+ * caller that does not get the pool runs its iterations on its own thread.
  */
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func)
 {
     static ThreadPool pool(get_num_cpus() - 1);
-    // Note that if this is used safely, we don't need the std::atomic_bool (can use bool), but if we are catching the
-    // mess up case of nesting parallel_for this should be atomic
-    static std::atomic_bool nested = false;
+    static std::atomic_bool pool_in_use = false;
     // Check if we are already in a nested parallel_for_mutex_pool call
-    bool expected = false;
-    if (!nested.compare_exchange_strong(expected, true)) {
+    if (inside_parallel_for) {
         throw_or_abort("Error: Nested parallel_for_mutex_pool calls are not allowed.");
     }
-    // info("starting job with iterations: ", num_iterations);
-    pool.start_tasks(num_iterations, func);
-    // info("done");
-    nested = false;
+    inside_parallel_for = true;
+    if (pool_in_use.exchange(true)) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+    } else {
+        // info("starting job with iterations: ", num_iterations);
+        pool.start_tasks(num_iterations, func);
+        // info("done");
+        pool_in_use = false;
+    }
+    inside_parallel_for = false;
 }
 } // namespace bb
 #endif
\ No newline at end of file
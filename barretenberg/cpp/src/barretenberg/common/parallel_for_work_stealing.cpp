@@ -0,0 +1,443 @@
+#include "task_group.hpp"
+#include "thread.hpp"
+
+#ifdef NO_MULTITHREADING
+namespace bb {
+TaskGroup::~TaskGroup() = default;
+
+void TaskGroup::spawn(std::function<void()> task)
+{
+    task();
+}
+
+void TaskGroup::sync() {}
+
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+}
+} // namespace bb
+#else
+#include "barretenberg/common/compiler_hints.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace {
+constexpr size_t NOT_A_WORKER = std::numeric_limits<size_t>::max();
+
+// Index of the pool worker running on this thread, or NOT_A_WORKER for threads outside the pool
+thread_local size_t worker_index = NOT_A_WORKER;
+
+struct Task {
+    std::function<void()> func;
+    bb::TaskGroup* group = nullptr;
+};
+
+/**
+ * A double-ended task queue. The owning thread pushes and pops at the back (LIFO, so it keeps working on the most
+ * recently split, cache-hot piece) while thieves take from the front (FIFO, so they take the oldest and typically
+ * largest piece). A plain mutex is used rather than a lock-free Chase-Lev deque; tasks are coarse enough that it is
+ * rarely contended. The atomic size lets thieves skip empty deques without taking the lock.
+ */
+class alignas(64) TaskDeque {
+  public:
+    void push_back(Task&& task)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+        size.store(tasks.size(), std::memory_order_relaxed);
+    }
+
+    bool pop_back(Task& task) { return pop(task, /*from_front=*/false); }
+
+    bool pop_front(Task& task) { return pop(task, /*from_front=*/true); }
+
+  private:
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::atomic<size_t> size = 0;
+
+    bool pop(Task& task, bool from_front)
+    {
+        if (size.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return false;
+        }
+        if (from_front) {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        } else {
+            task = std::move(tasks.back());
+            tasks.pop_back();
+        }
+        size.store(tasks.size(), std::memory_order_relaxed);
+        return true;
+    }
+};
+
+/**
+ * @brief Returns the NUMA node of each of the given cpus, all zero if the topology is not available
+ */
+std::vector<size_t> get_numa_nodes(const std::vector<size_t>& cpus)
+{
+    std::vector<size_t> nodes(cpus.size(), 0);
+#ifdef __linux__
+    constexpr size_t MAX_NUMA_NODES = 64;
+    for (size_t node = 0; node < MAX_NUMA_NODES; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file) {
+            continue;
+        }
+        // The list has the form "0-3,8-11"
+        std::string range;
+        while (std::getline(file, range, ',')) {
+            size_t first = 0;
+            size_t last = 0;
+            char dash = 0;
+            std::istringstream range_stream(range);
+            range_stream >> first;
+            last = (range_stream >> dash >> last) ? last : first;
+            for (size_t i = 0; i < cpus.size(); ++i) {
+                if (cpus[i] >= first && cpus[i] <= last) {
+                    nodes[i] = node;
+                }
+            }
+        }
+    }
+#endif
+    return nodes;
+}
+
+/**
+ * @brief Returns the cpus this process may run on
+ */
+std::vector<size_t> get_allowed_cpus()
+{
+    std::vector<size_t> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+bool pinning_enabled()
+{
+    const char* pin = std::getenv("BB_PIN_THREADS");
+    return pin != nullptr && std::string(pin) == "1";
+}
+} // namespace
+
+namespace bb {
+
+/**
+ * A persistent work-stealing pool. Every worker owns a TaskDeque; threads outside the pool (e.g. the main thread)
+ * share one extra deque. A thread that runs out of work steals from the other deques, trying workers on its own NUMA
+ * node first. Idle workers, and threads waiting in TaskGroup::sync() with nothing to steal, spin briefly and then sleep
+ * on a single condition variable, which is signalled when work is queued or a group completes.
+ *
+ * Independent jobs may run at the same time, e.g. the Goblin Translator prover spawned as a task while the spawning
+ * thread computes the ECCVM opening proof. Each job queues the pieces of its parallel_for calls on the deque of the
+ * thread running it, and idle threads steal from whichever job has pieces left, so the threads of the pool are split
+ * between the jobs according to their remaining work, and never exceed get_num_cpus().
+ *
+ * With BB_PIN_THREADS=1 the workers are pinned to the cpus the process is allowed to run on, filling one NUMA node
+ * before moving to the next, so that stealing from a neighbour mostly stays on the local node.
+ */
+class WorkStealingPool {
+  public:
+    static WorkStealingPool& get()
+    {
+        static WorkStealingPool pool(get_num_cpus() - 1);
+        return pool;
+    }
+
+    explicit WorkStealingPool(size_t num_workers);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    size_t num_workers() const { return num_workers_; }
+
+    void push(Task&& task);
+    bool try_run_one();
+    void wait_for_work(const TaskGroup* group);
+
+  private:
+    static constexpr size_t SPIN_ROUNDS = 64;
+
+    const size_t num_workers_;
+    // deques[i] belongs to worker i, deques[num_workers_] is shared by all threads outside the pool
+    std::vector<std::unique_ptr<TaskDeque>> deques;
+    // The order in which thread i (or num_workers_ for outside threads) visits the other deques when stealing
+    std::vector<std::vector<size_t>> steal_orders;
+    // The cpu each worker is pinned to, empty if pinning is disabled
+    std::vector<size_t> worker_cpus;
+    std::vector<std::thread> workers;
+
+    // Signed, since a task can be popped (and the count decremented) before its push has incremented it
+    std::atomic<ptrdiff_t> num_queued = 0;
+    std::atomic<size_t> num_sleeping = 0;
+    std::atomic_bool stop = false;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+
+    void run(Task& task);
+    void wake_one();
+    BB_NO_PROFILE void worker_loop(size_t index);
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_workers)
+    : num_workers_(num_workers)
+{
+    std::vector<size_t> nodes(num_workers, 0);
+    if (pinning_enabled()) {
+        std::vector<size_t> cpus = get_allowed_cpus();
+        if (!cpus.empty()) {
+            std::vector<size_t> cpu_nodes = get_numa_nodes(cpus);
+            std::vector<size_t> order(cpus.size());
+            for (size_t i = 0; i < order.size(); ++i) {
+                order[i] = i;
+            }
+            std::stable_sort(
+                order.begin(), order.end(), [&](size_t a, size_t b) { return cpu_nodes[a] < cpu_nodes[b]; });
+            // Leave the first cpu to the thread that created the pool
+            for (size_t i = 0; i < num_workers; ++i) {
+                const size_t slot = order[(i + 1) % order.size()];
+                worker_cpus.push_back(cpus[slot]);
+                nodes[i] = cpu_nodes[slot];
+            }
+        }
+    }
+
+    deques.reserve(num_workers + 1);
+    for (size_t i = 0; i <= num_workers; ++i) {
+        deques.push_back(std::make_unique<TaskDeque>());
+    }
+
+    // Workers visit the other workers in ring order starting from their neighbour, those on their own node first, and
+    // the outside deque last. Outside threads visit the workers in ring order.
+    steal_orders.resize(num_workers + 1);
+    for (size_t i = 0; i < num_workers; ++i) {
+        for (size_t offset = 1; offset < num_workers; ++offset) {
+            steal_orders[i].push_back((i + offset) % num_workers);
+        }
+        std::stable_sort(steal_orders[i].begin(), steal_orders[i].end(), [&](size_t a, size_t b) {
+            return (nodes[a] != nodes[i]) < (nodes[b] != nodes[i]);
+        });
+        steal_orders[i].push_back(num_workers);
+    }
+    for (size_t i = 0; i < num_workers; ++i) {
+        steal_orders[num_workers].push_back(i);
+    }
+
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::push(Task&& task)
+{
+    const size_t self = worker_index == NOT_A_WORKER ? num_workers_ : worker_index;
+    deques[self]->push_back(std::move(task));
+    num_queued.fetch_add(1);
+    wake_one();
+}
+
+void WorkStealingPool::wake_one()
+{
+    if (num_sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        sleep_condition.notify_one();
+    }
+}
+
+bool WorkStealingPool::try_run_one()
+{
+    const size_t self = worker_index == NOT_A_WORKER ? num_workers_ : worker_index;
+    Task task;
+    bool found = deques[self]->pop_back(task);
+    if (!found && num_queued.load(std::memory_order_relaxed) > 0) {
+        for (size_t victim : steal_orders[self]) {
+            if (deques[victim]->pop_front(task)) {
+                found = true;
+                break;
+            }
+        }
+    }
+    if (!found) {
+        return false;
+    }
+    num_queued.fetch_sub(1);
+    run(task);
+    return true;
+}
+
+void WorkStealingPool::run(Task& task)
+{
+    TaskGroup& group = *task.group;
+#ifndef __wasm__
+    try {
+#endif
+        task.func();
+#ifndef __wasm__
+    } catch (...) {
+        if (!group.has_exception_.exchange(true)) {
+            group.exception_ = std::current_exception();
+        }
+    }
+#endif
+    // Release whatever the task captured before the group can be observed as complete
+    task.func = nullptr;
+    // The group may be destroyed by its owner as soon as pending_ reaches zero, so it must not be touched afterwards
+    if (group.pending_.fetch_sub(1) == 1 && num_sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        sleep_condition.notify_all();
+    }
+}
+
+/**
+ * @brief Block until there may be work to steal or, if group is given, until the group has completed
+ */
+void WorkStealingPool::wait_for_work(const TaskGroup* group)
+{
+    auto done = [&] { return group != nullptr ? group->pending_.load() == 0 : stop.load(); };
+    for (size_t i = 0; i < SPIN_ROUNDS; ++i) {
+        if (done() || num_queued.load() > 0) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    num_sleeping.fetch_add(1);
+    sleep_condition.wait(lock, [&] { return done() || num_queued.load() > 0; });
+    num_sleeping.fetch_sub(1);
+    // If we were woken for queued work but are leaving because our group is done, pass the wake-up on
+    if (group != nullptr && num_queued.load() > 0 && num_sleeping.load() > 0) {
+        sleep_condition.notify_one();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t index)
+{
+    worker_index = index;
+#ifdef __linux__
+    if (!worker_cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(worker_cpus[index], &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+#endif
+    while (true) {
+        if (try_run_one()) {
+            continue;
+        }
+        if (stop) {
+            break;
+        }
+        wait_for_work(nullptr);
+    }
+}
+
+TaskGroup::~TaskGroup()
+{
+    // Wait for outstanding tasks, as they may refer to the group; any exception is dropped
+    while (pending_.load() != 0) {
+        if (!WorkStealingPool::get().try_run_one()) {
+            WorkStealingPool::get().wait_for_work(this);
+        }
+    }
+}
+
+void TaskGroup::spawn(std::function<void()> task)
+{
+    pending_.fetch_add(1);
+    WorkStealingPool::get().push({ std::move(task), this });
+}
+
+void TaskGroup::sync()
+{
+    auto& pool = WorkStealingPool::get();
+    while (pending_.load() != 0) {
+        if (!pool.try_run_one()) {
+            pool.wait_for_work(this);
+        }
+    }
+    if (has_exception_.exchange(false)) {
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+}
+
+/**
+ * A work-stealing strategy. The iteration range is split in halves recursively: the calling thread spawns the upper
+ * half and carries on with the lower half, until a single iteration is left. Thieves take the oldest, i.e. largest,
+ * remaining range and split it further themselves, which balances irregular iterations without a shared counter.
+ * Unlike the other backends, a parallel_for nested inside an iteration simply adds tasks to the pool.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations <= 1 || WorkStealingPool::get().num_workers() == 0) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+    TaskGroup group;
+    std::function<void(size_t, size_t)> run_range = [&](size_t start, size_t end) {
+        while (end - start > 1) {
+            const size_t mid = start + (end - start) / 2;
+            group.spawn([&run_range, mid, end] { run_range(mid, end); });
+            end = mid;
+        }
+        func(start);
+    };
+    run_range(0, num_iterations);
+    group.sync();
+}
+} // namespace bb
+#endif
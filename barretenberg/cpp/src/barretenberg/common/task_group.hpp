@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+
+namespace bb {
+
+class WorkStealingPool;
+
+/**
+ * @brief A fork/join scope on the work-stealing thread pool that backs parallel_for
+ *
+ * @details spawn() pushes a task onto the calling thread's deque, from where idle threads can steal it. sync() returns
+ * once every task spawned in the group has finished. While it waits, the syncing thread executes queued tasks (its own
+ * first, then stolen ones), so a task may itself spawn and sync, or call parallel_for, without blocking a thread or
+ * oversubscribing the machine. The first exception thrown by a task is rethrown from sync().
+ *
+ * Example (the destructor syncs as well, but then any exception is lost):
+ *
+ *     TaskGroup group;
+ *     group.spawn([&] { left = compute(lhs); });
+ *     right = compute(rhs);
+ *     group.sync();
+ */
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+    ~TaskGroup();
+
+    void spawn(std::function<void()> task);
+    void sync();
+
+  private:
+    friend class WorkStealingPool;
+
+    std::atomic<size_t> pending_ = 0;
+    std::atomic_bool has_exception_ = false;
+    std::exception_ptr exception_;
+};
+
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
+} // namespace bb
@@ -0,0 +1,109 @@
+#include "thread.hpp"
+#include "task_group.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+using namespace bb;
+
+namespace {
+size_t fibonacci(size_t n)
+{
+    if (n < 2) {
+        return n;
+    }
+    size_t left = 0;
+    TaskGroup group;
+    group.spawn([&] { left = fibonacci(n - 1); });
+    const size_t right = fibonacci(n - 2);
+    group.sync();
+    return left + right;
+}
+} // namespace
+
+TEST(Thread, ParallelForVisitsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> visits(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { visits[i]++; });
+    for (auto& count : visits) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t outer = 16;
+    constexpr size_t inner = 64;
+    std::vector<std::atomic<size_t>> visits(outer * inner);
+    parallel_for(outer, [&](size_t i) {
+        parallel_for_range(inner, [&](size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                visits[i * inner + j]++;
+            }
+        });
+    });
+    for (auto& count : visits) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(Thread, TaskGroupForkJoin)
+{
+    EXPECT_EQ(fibonacci(20), 6765);
+}
+
+TEST(Thread, ConcurrentCallersFromIndependentThreads)
+{
+    constexpr size_t num_iterations = 256;
+    std::vector<size_t> first(num_iterations);
+    std::vector<size_t> second(num_iterations);
+    std::thread other([&] { parallel_for(num_iterations, [&](size_t i) { first[i] = i; }); });
+    parallel_for(num_iterations, [&](size_t i) { second[i] = i; });
+    other.join();
+    for (size_t i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(first[i], i);
+        EXPECT_EQ(second[i], i);
+    }
+}
+
+TEST(Thread, SpawnedTaskAndCallerShareThePool)
+{
+    constexpr size_t num_iterations = 256;
+    std::vector<size_t> first(num_iterations);
+    std::vector<size_t> second(num_iterations);
+    TaskGroup group;
+    group.spawn([&] { parallel_for(num_iterations, [&](size_t i) { first[i] = i; }); });
+    parallel_for(num_iterations, [&](size_t i) { second[i] = i; });
+    group.sync();
+    for (size_t i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(first[i], i);
+        EXPECT_EQ(second[i], i);
+    }
+}
+
+#ifndef __wasm__
+TEST(Thread, TaskGroupWaitsForTasksWhenTheCallerThrows)
+{
+    constexpr size_t num_iterations = 256;
+    std::vector<std::atomic<size_t>> visits(num_iterations);
+    auto spawn_then_throw = [&] {
+        TaskGroup group;
+        group.spawn([&] { parallel_for(num_iterations, [&](size_t i) { visits[i]++; }); });
+        throw std::runtime_error("caller failed");
+    };
+    EXPECT_THROW(spawn_then_throw(), std::runtime_error);
+    // The group is destroyed while the exception propagates, which waits for the task
+    for (auto& count : visits) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(Thread, TaskGroupRethrowsOnSync)
+{
+    TaskGroup group;
+    group.spawn([] { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(group.sync(), std::runtime_error);
+}
+#endif
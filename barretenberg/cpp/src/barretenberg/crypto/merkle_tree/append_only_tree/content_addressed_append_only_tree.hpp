@@ -17,6 +17,7 @@
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -978,28 +979,39 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
 
     // If we have been told to add these leaves to the index then do so now
     if (update_index) {
+        std::vector<std::pair<fr, index_t>> leaves;
+        leaves.reserve(number_to_insert);
         for (uint32_t i = 0; i < number_to_insert; ++i) {
             // We don't store indices of zero leaves
             if (hashes_local[i] == fr::zero()) {
                 continue;
             }
             // std::cout << "Updating index " << index + i << " : " << hashes_local[i] << std::endl;
-            store_->update_index(index + i, hashes_local[i]);
+            leaves.emplace_back(hashes_local[i], index + i);
         }
+        store_->update_indices(leaves);
     }
 
     // Hash the values as a sub tree and insert them
+    // Each level is hashed as one batch, the children are split into left and right halves for the batched hasher
+    std::vector<fr> left(number_to_insert / 2);
+    std::vector<fr> right(number_to_insert / 2);
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
         // std::cout << "To INSERT " << number_to_insert << std::endl;
         for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
+            left[i] = hashes_local[i * 2];
+            right[i] = hashes_local[i * 2 + 1];
+        }
+        HashingPolicy::hash_pairs(std::span<const fr>(left.data(), number_to_insert),
+                                  std::span<const fr>(right.data(), number_to_insert),
+                                  std::span<fr>(hashes_local.data(), number_to_insert));
+        for (uint32_t i = 0; i < number_to_insert; ++i) {
+            // std::cout << "Left: " << left[i] << ", right: " << right[i] << ", parent: " << hashes_local[i] <<
+            // std::endl;
+            store_->put_node_by_hash(hashes_local[i], { .left = left[i], .right = right[i], .ref = 1 });
             store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
             // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
             //           << std::endl;
@@ -8,6 +8,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -17,6 +18,13 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    static void hash_pairs(std::span<const fr> left, std::span<const fr> right, std::span<fr> out)
+    {
+        for (size_t i = 0; i < left.size(); ++i) {
+            out[i] = hash_pair(left[i], right[i]);
+        }
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -28,6 +36,15 @@ struct Poseidon2HashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    /**
+     * @brief Hashes a whole level of node pairs, out[i] = hash_pair(left[i], right[i]), using the multi-lane
+     * permutation
+     */
+    static void hash_pairs(std::span<const fr> left, std::span<const fr> right, std::span<fr> out)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(left, right, out);
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -169,6 +169,29 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
         IndexedLeafValueType updated_leaf, original_leaf;
     };
 
+    /**
+     * @brief The sibling pairs of one level of a sparse update, collected so that all their parents can be hashed in a
+     * single HashingPolicy::hash_pairs call
+     */
+    struct LevelHashes {
+        std::vector<std::optional<fr>> left_options, right_options;
+        std::vector<fr> left, right, parents;
+
+        void add(const std::optional<fr>& left_option, const std::optional<fr>& right_option, const fr& zero_hash)
+        {
+            left_options.push_back(left_option);
+            right_options.push_back(right_option);
+            left.push_back(left_option.has_value() ? left_option.value() : zero_hash);
+            right.push_back(right_option.has_value() ? right_option.value() : zero_hash);
+        }
+
+        void compute()
+        {
+            parents.resize(left.size());
+            HashingPolicy::hash_pairs(left, right, parents);
+        }
+    };
+
     void update_leaf_and_hash_to_root(const index_t& index,
                                       const IndexedLeafValueType& leaf,
                                       Signal& leader,
@@ -1153,6 +1176,7 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
     while (level > 0) {
         std::vector<index_t> next_indices;
         std::unordered_map<index_t, fr> next_hashes;
+        LevelHashes level_hashes;
         for (size_t i = 0; i < indices.size(); ++i) {
             index_t index = indices[i];
             index_t parent_index = index >> 1;
@@ -1165,13 +1189,16 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
             fr new_hash = hashes[index];
             std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
             std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
+            level_hashes.add(new_left_option, new_right_option, zero_hashes_[level]);
+        }
+        // hash every parent at this level in one batch, then write them
+        level_hashes.compute();
+        for (size_t i = 0; i < next_indices.size(); ++i) {
+            const fr& new_hash = level_hashes.parents[i];
+            store_->put_cached_node_by_index(level - 1, next_indices[i], new_hash);
+            store_->put_node_by_hash(
+                new_hash, { .left = level_hashes.left_options[i], .right = level_hashes.right_options[i], .ref = 1 });
+            next_hashes[next_indices[i]] = new_hash;
         }
         indices = std::move(next_indices);
         hashes = std::move(next_hashes);
@@ -1237,6 +1264,7 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
     while (level > root_level) {
         std::vector<index_t> next_indices;
         std::unordered_map<index_t, fr> next_hashes;
+        LevelHashes level_hashes;
         for (size_t i = 0; i < indices.size(); ++i) {
             index_t index = indices[i];
             index_t parent_index = index >> 1;
@@ -1249,15 +1277,19 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
             new_hash = hashes[index];
             std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
             std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-            // std::cout << "Created parent hash at level " << level - 1 << " index " << parent_index << " hash "
-            //           << new_hash << " left " << new_left_value << " right " << new_right_value << std::endl;
+            level_hashes.add(new_left_option, new_right_option, zero_hashes_[level]);
+        }
+        // hash every parent at this level in one batch, then write them
+        level_hashes.compute();
+        for (size_t i = 0; i < next_indices.size(); ++i) {
+            new_hash = level_hashes.parents[i];
+            store_->put_cached_node_by_index(level - 1, next_indices[i], new_hash);
+            store_->put_node_by_hash(
+                new_hash, { .left = level_hashes.left_options[i], .right = level_hashes.right_options[i], .ref = 1 });
+            next_hashes[next_indices[i]] = new_hash;
+            // std::cout << "Created parent hash at level " << level - 1 << " index " << next_indices[i] << " hash "
+            //           << new_hash << " left " << level_hashes.left[i] << " right " << level_hashes.right[i] <<
+            //           std::endl;
         }
         indices = std::move(next_indices);
         hashes = std::move(next_hashes);
@@ -52,6 +52,12 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, index_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Retrieves the value without copying it out of the memory map.
+     * The value is only valid until the transaction ends, or until the next write within a write transaction.
+     */
+    template <typename T> bool get_value(T& key, MDB_val& data, const LMDBDatabase& db) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -66,6 +72,8 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, index_t& data, const LMDBDatabase& db) const;
 
+    bool get_value(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     MDB_txn* _transaction;
@@ -84,6 +92,12 @@ template <typename T> bool LMDBTransaction::get_value(T& key, index_t& data, con
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T> bool LMDBTransaction::get_value(T& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data, db);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
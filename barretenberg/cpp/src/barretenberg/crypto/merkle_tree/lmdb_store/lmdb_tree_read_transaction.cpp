@@ -4,8 +4,9 @@
 #include <cstdint>
 
 namespace bb::crypto::merkle_tree {
-LMDBTreeReadTransaction::LMDBTreeReadTransaction(LMDBEnvironment::SharedPtr env)
+LMDBTreeReadTransaction::LMDBTreeReadTransaction(LMDBEnvironment::SharedPtr env, uint64_t cacheGeneration)
     : LMDBTransaction(env, true)
+    , _cacheGeneration(cacheGeneration)
 {}
 
 LMDBTreeReadTransaction::~LMDBTreeReadTransaction()
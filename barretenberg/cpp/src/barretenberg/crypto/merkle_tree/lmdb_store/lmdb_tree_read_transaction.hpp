@@ -18,12 +18,13 @@ namespace bb::crypto::merkle_tree {
  * RAII wrapper around a read transaction.
  * Contains various methods for retrieving values by their keys.
  * Aborts the transaction upon object destruction.
+ * Records the generation of the store's read cache at the time the snapshot was taken.
  */
 class LMDBTreeReadTransaction : public LMDBTransaction {
   public:
     using Ptr = std::unique_ptr<LMDBTreeReadTransaction>;
 
-    LMDBTreeReadTransaction(LMDBEnvironment::SharedPtr env);
+    LMDBTreeReadTransaction(LMDBEnvironment::SharedPtr env, uint64_t cacheGeneration = 0);
     LMDBTreeReadTransaction(const LMDBTreeReadTransaction& other) = delete;
     LMDBTreeReadTransaction(LMDBTreeReadTransaction&& other) = delete;
     LMDBTreeReadTransaction& operator=(const LMDBTreeReadTransaction& other) = delete;
@@ -32,5 +33,10 @@ class LMDBTreeReadTransaction : public LMDBTransaction {
     ~LMDBTreeReadTransaction() override;
 
     void abort() override;
+
+    uint64_t cache_generation() const { return _cacheGeneration; }
+
+  private:
+    uint64_t _cacheGeneration;
 };
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_db_transaction.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_encoding.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
@@ -47,10 +48,14 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
     return value_cmp<uint64_t>(a, b);
 }
 
-LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
+LMDBTreeStore::LMDBTreeStore(
+    std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders, uint64_t cacheSizeKb)
     : _name(std::move(name))
     , _directory(std::move(directory))
     , _environment(std::make_shared<LMDBEnvironment>(_directory, mapSizeKb, 5, maxNumReaders))
+    // The cache is split evenly between nodes and leaf pre-images
+    , _nodeCache(NODES_DB, cacheSizeKb * 512)
+    , _leafPreImageCache(LEAF_PREIMAGES_DB, cacheSizeKb * 512)
 {
 
     {
@@ -95,7 +100,17 @@ LMDBTreeStore::WriteTransaction::Ptr LMDBTreeStore::create_write_transaction() c
 LMDBTreeStore::ReadTransaction::Ptr LMDBTreeStore::create_read_transaction()
 {
     _environment->wait_for_reader();
-    return std::make_unique<LMDBTreeReadTransaction>(_environment);
+    // The generation must be read before the snapshot is taken. If the cache is invalidated in between, the reader
+    // merely fails to populate it, whereas the other way round a reader of deleted data could re-populate it.
+    uint64_t cacheGeneration = _cacheGeneration.load();
+    return std::make_unique<LMDBTreeReadTransaction>(_environment, cacheGeneration);
+}
+
+void LMDBTreeStore::invalidate_cache()
+{
+    uint64_t cacheGeneration = ++_cacheGeneration;
+    _nodeCache.invalidate(cacheGeneration);
+    _leafPreImageCache.invalidate(cacheGeneration);
 }
 
 void LMDBTreeStore::get_stats(TreeDBStats& stats, ReadTransaction& tx)
@@ -115,15 +130,15 @@ void LMDBTreeStore::get_stats(TreeDBStats& stats, ReadTransaction& tx)
     stats.nodesDBStats = DBStats(NODES_DB, stat);
     call_lmdb_func(mdb_stat, tx.underlying(), _indexToBlockDatabase->underlying(), &stat);
     stats.blockIndicesDBStats = DBStats(BLOCK_INDICES_DB, stat);
+    stats.nodesCacheStats = _nodeCache.get_stats();
+    stats.leafPreimagesCacheStats = _leafPreImageCache.get_stats();
 }
 
 void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
                                      const BlockPayload& blockData,
                                      LMDBTreeStore::WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, blockData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = record_encoding::encode(blockData);
     BlockMetaKeyType key(blockNumber);
     tx.put_value<BlockMetaKeyType>(key, encoded, *_blockDatabase);
 }
@@ -139,10 +154,10 @@ bool LMDBTreeStore::read_block_data(const block_number_t& blockNumber,
                                     LMDBTreeStore::ReadTransaction& tx)
 {
     BlockMetaKeyType key(blockNumber);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.get_value<BlockMetaKeyType>(key, data, *_blockDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(blockData);
+        decode_record(data, blockData);
     }
     return success;
 }
@@ -240,6 +255,50 @@ bool LMDBTreeStore::read_meta_data(TreeMeta& metaData, LMDBTreeStore::ReadTransa
     return success;
 }
 
+bool LMDBTreeStore::read_record_format(uint8_t& version, LMDBTransaction& tx)
+{
+    MetaKeyType key(RECORD_FORMAT_KEY);
+    std::vector<uint8_t> data;
+    bool success = tx.get_value<MetaKeyType>(key, data, *_blockDatabase);
+    if (success && !data.empty()) {
+        version = data[0];
+    }
+    return success;
+}
+
+void LMDBTreeStore::write_record_format(WriteTransaction& tx)
+{
+    MetaKeyType key(RECORD_FORMAT_KEY);
+    std::vector<uint8_t> data{ record_encoding::FORMAT_VERSION };
+    tx.put_value<MetaKeyType>(key, data, *_blockDatabase);
+}
+
+bool LMDBTreeStore::read_migration_progress(uint8_t& database, std::vector<uint8_t>& key, WriteTransaction& tx)
+{
+    MetaKeyType progressKey(RECORD_MIGRATION_KEY);
+    std::vector<uint8_t> data;
+    if (!tx.get_value<MetaKeyType>(progressKey, data, *_blockDatabase) || data.empty()) {
+        return false;
+    }
+    database = data[0];
+    key.assign(data.begin() + 1, data.end());
+    return true;
+}
+
+void LMDBTreeStore::write_migration_progress(uint8_t database, const std::vector<uint8_t>& key, WriteTransaction& tx)
+{
+    MetaKeyType progressKey(RECORD_MIGRATION_KEY);
+    std::vector<uint8_t> data{ database };
+    data.insert(data.end(), key.begin(), key.end());
+    tx.put_value<MetaKeyType>(progressKey, data, *_blockDatabase);
+}
+
+void LMDBTreeStore::delete_migration_progress(WriteTransaction& tx)
+{
+    MetaKeyType progressKey(RECORD_MIGRATION_KEY);
+    tx.delete_value(progressKey, *_blockDatabase);
+}
+
 void LMDBTreeStore::write_leaf_index(const fr& leafValue, const index_t& index, LMDBTreeStore::WriteTransaction& tx)
 {
     FrKeyType key(leafValue);
@@ -288,6 +347,7 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
     if (--nodeData.ref == 0) {
         // std::cout << "Deleting node at " << nodeHash << std::endl;
         tx.delete_value(nodeHash, *_nodeDatabase);
+        _nodeCache.erase(nodeHash);
         return;
     }
     // std::cout << "Updating node at " << nodeHash << " ref is now " << nodeData.ref << std::endl;
@@ -298,6 +358,7 @@ void LMDBTreeStore::delete_leaf_by_hash(const fr& leafHash, WriteTransaction& tx
 {
     FrKeyType key(leafHash);
     tx.delete_value(key, *_leafHashToPreImageDatabase);
+    _leafPreImageCache.erase(leafHash);
 }
 
 fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
@@ -321,22 +382,25 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
+    if (_nodeCache.get(nodeHash, nodeData)) {
+        return true;
+    }
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_record(data, nodeData);
+        _nodeCache.put(nodeHash, nodeData, sizeof(NodePayload), tx.cache_generation());
     }
     return success;
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = record_encoding::encode(nodeData);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
+    _nodeCache.erase(nodeHash);
 }
 
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
@@ -7,17 +7,23 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_environment.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_read_transaction.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_write_transaction.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lru_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_encoding.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
+#include <atomic>
 #include <cstdint>
+#include <exception>
+#include <functional>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
@@ -151,9 +157,24 @@ struct BlockIndexPayload {
         blockNumbers[1] = blockNumber;
     }
 };
+// Key comparison functions of the databases within the store
+int fr_key_cmp(const MDB_val* a, const MDB_val* b);
+int block_key_cmp(const MDB_val* a, const MDB_val* b);
+int index_key_cmp(const MDB_val* a, const MDB_val* b);
+
 /**
  * Creates an abstraction against a collection of LMDB databases within a single environment used to store merkle tree
  * data
+ *
+ * Committed nodes and leaf pre-images are content addressed, so reads of them through a read transaction are served
+ * from a bounded LRU cache shared by every fork of the tree. Writes evict the affected entry. Unwinding or removing
+ * blocks deletes data from the store, after which the owner of the tree must call invalidate_cache().
+ * The cached reference count of a node may lag behind the store if a block is committed while it is being read, only
+ * the children of a node are relied upon by readers. Reference counts are maintained using the write transaction.
+ *
+ * Nodes, blocks and leaf pre-images are stored in the fixed width layout described in record_encoding.hpp and are
+ * decoded directly from the memory map. Meta data and block indices are variable length and remain msgpack encoded.
+ * Databases written before the fixed layout was introduced are upgraded by migrate_records().
  */
 
 class LMDBTreeStore {
@@ -162,7 +183,13 @@ class LMDBTreeStore {
     using SharedPtr = std::shared_ptr<LMDBTreeStore>;
     using ReadTransaction = LMDBTreeReadTransaction;
     using WriteTransaction = LMDBTreeWriteTransaction;
-    LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders);
+    static constexpr uint64_t DEFAULT_CACHE_SIZE_KB = 32 * 1024;
+    static constexpr uint64_t MIGRATION_BATCH_SIZE = 10000;
+    LMDBTreeStore(std::string directory,
+                  std::string name,
+                  uint64_t mapSizeKb,
+                  uint64_t maxNumReaders,
+                  uint64_t cacheSizeKb = DEFAULT_CACHE_SIZE_KB);
     LMDBTreeStore(const LMDBTreeStore& other) = delete;
     LMDBTreeStore(LMDBTreeStore&& other) = delete;
     LMDBTreeStore& operator=(const LMDBTreeStore& other) = delete;
@@ -231,7 +258,30 @@ class LMDBTreeStore {
 
     void delete_all_leaf_keys_before_or_equal_index(const index_t& index, WriteTransaction& tx);
 
+    void invalidate_cache();
+
+    /**
+     * Re-encodes any msgpack encoded nodes, blocks and leaf pre-images in the fixed layout, then records the format
+     * version so that subsequent calls return immediately. LeafType is the type of the stored leaf pre-images.
+     * The records are migrated in batches of recordsPerTransaction, each in its own write transaction, see
+     * migrate_record_batch().
+     */
+    template <typename LeafType> void migrate_records(uint64_t recordsPerTransaction = MIGRATION_BATCH_SIZE);
+
+    /**
+     * Re-encodes at most recordsPerTransaction records in one write transaction, continuing from the progress
+     * recorded by the previous batch, so that an interrupted migration resumes where it stopped. Readers decode
+     * either layout, so they are unaffected by a partial migration. The format version is recorded by the batch which
+     * completes the migration. Returns true if the migration is complete.
+     */
+    template <typename LeafType> bool migrate_record_batch(uint64_t recordsPerTransaction);
+
   private:
+    // The block database holds the tree meta data under the 1 byte key 0, the record format version under key 1 and
+    // the progress of an unfinished record migration under key 2
+    static constexpr MetaKeyType RECORD_FORMAT_KEY = 1;
+    static constexpr MetaKeyType RECORD_MIGRATION_KEY = 2;
+
     std::string _name;
     std::string _directory;
     LMDBEnvironment::SharedPtr _environment;
@@ -240,8 +290,35 @@ class LMDBTreeStore {
     LMDBDatabase::Ptr _leafKeyToIndexDatabase;
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _indexToBlockDatabase;
+    std::atomic<uint64_t> _cacheGeneration = 0;
+    ShardedLRUCache<NodePayload> _nodeCache;
+    ShardedLRUCache<std::vector<uint8_t>> _leafPreImageCache;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
+    bool read_record_format(uint8_t& version, LMDBTransaction& tx);
+
+    void write_record_format(WriteTransaction& tx);
+
+    // The progress of a migration is the database being migrated, in the order nodes, blocks, leaf pre-images, and
+    // the serialised key of the next record to migrate in it
+    bool read_migration_progress(uint8_t& database, std::vector<uint8_t>& key, WriteTransaction& tx);
+
+    void write_migration_progress(uint8_t database, const std::vector<uint8_t>& key, WriteTransaction& tx);
+
+    void delete_migration_progress(WriteTransaction& tx);
+
+    template <typename RecordType>
+    bool upgrade_records(const std::vector<uint8_t>& fromKey,
+                         uint64_t maxRecords,
+                         std::vector<uint8_t>& nextKey,
+                         const LMDBDatabase& db,
+                         WriteTransaction& tx);
+
+    template <typename RecordType> static void decode_record(const MDB_val& data, RecordType& record)
+    {
+        record_encoding::decode(static_cast<const uint8_t*>(data.mv_data), data.mv_size, record);
+    }
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx)
@@ -253,33 +330,126 @@ template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafVal
 template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
+    // Only committed data, read through a read transaction, can be cached
+    constexpr bool isReadTransaction = std::is_same_v<TxType, ReadTransaction>;
+    if constexpr (isReadTransaction) {
+        std::vector<uint8_t> cached;
+        if (_leafPreImageCache.get(leafHash, cached)) {
+            record_encoding::decode(cached.data(), cached.size(), leafData);
+            return true;
+        }
+    }
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+    MDB_val data;
+    if (!tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase)) {
+        return false;
     }
-    return success;
+    decode_record(data, leafData);
+    if constexpr (isReadTransaction) {
+        _leafPreImageCache.put(leafHash, mdb_val_to_vector(data), data.mv_size, tx.cache_generation());
+    }
+    return true;
 }
 
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = record_encoding::encode(leafData);
     FrKeyType key(leafHash);
     tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
+    _leafPreImageCache.erase(leafHash);
 }
 
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_record(data, nodeData);
     }
     return success;
 }
+
+template <typename LeafType> void LMDBTreeStore::migrate_records(uint64_t recordsPerTransaction)
+{
+    {
+        ReadTransaction::Ptr tx = create_read_transaction();
+        uint8_t version = 0;
+        if (read_record_format(version, *tx) && version == record_encoding::FORMAT_VERSION) {
+            return;
+        }
+    }
+    bool complete = false;
+    while (!complete) {
+        complete = migrate_record_batch<LeafType>(recordsPerTransaction);
+    }
+    // Any cached pre-images in the msgpack encoding can still be decoded, so there is no need to invalidate the cache
+}
+
+template <typename LeafType> bool LMDBTreeStore::migrate_record_batch(uint64_t recordsPerTransaction)
+{
+    WriteTransaction::Ptr tx = create_write_transaction();
+    try {
+        uint8_t version = 0;
+        if (read_record_format(version, *tx) && version == record_encoding::FORMAT_VERSION) {
+            return true;
+        }
+        uint8_t database = 0;
+        std::vector<uint8_t> key;
+        if (!read_migration_progress(database, key, *tx)) {
+            key = serialise_key(FrKeyType(0));
+        }
+        std::vector<uint8_t> nextKey;
+        bool remaining = false;
+        switch (database) {
+        case 0:
+            remaining = upgrade_records<NodePayload>(key, recordsPerTransaction, nextKey, *_nodeDatabase, *tx);
+            break;
+        case 1:
+            remaining = upgrade_records<BlockPayload>(key, recordsPerTransaction, nextKey, *_blockDatabase, *tx);
+            break;
+        default:
+            remaining =
+                upgrade_records<LeafType>(key, recordsPerTransaction, nextKey, *_leafHashToPreImageDatabase, *tx);
+            break;
+        }
+        if (!remaining) {
+            // Move on to the first record of the next database, the keys of the block database are block numbers
+            ++database;
+            nextKey = database == 1 ? serialise_key(BlockMetaKeyType(0)) : serialise_key(FrKeyType(0));
+        }
+        bool complete = database > 2;
+        if (complete) {
+            write_record_format(*tx);
+            delete_migration_progress(*tx);
+        } else {
+            write_migration_progress(database, nextKey, *tx);
+        }
+        tx->commit();
+        return complete;
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw;
+    }
+}
+
+template <typename RecordType>
+bool LMDBTreeStore::upgrade_records(const std::vector<uint8_t>& fromKey,
+                                    uint64_t maxRecords,
+                                    std::vector<uint8_t>& nextKey,
+                                    const LMDBDatabase& db,
+                                    WriteTransaction& tx)
+{
+    // Only keys of the same size as fromKey are visited, so the 1 byte meta keys of the block database are skipped
+    return tx.update_values_greater_or_equal_key(
+        fromKey,
+        maxRecords,
+        [](const MDB_val& value, std::vector<uint8_t>& upgraded) {
+            return record_encoding::upgrade<RecordType>(
+                static_cast<const uint8_t*>(value.mv_data), value.mv_size, upgraded);
+        },
+        nextKey,
+        db);
+}
 } // namespace bb::crypto::merkle_tree
@@ -14,6 +14,8 @@
 #include "barretenberg/crypto/merkle_tree/fixtures.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_db_transaction.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/record_encoding.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -258,6 +260,358 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, records_use_a_fixed_layout)
+{
+    NodePayload node{ .left = VALUES[0], .right = std::nullopt, .ref = 3 };
+    std::vector<uint8_t> encoded = record_encoding::encode(node);
+    // header, 2 optional field elements and the reference count
+    EXPECT_EQ(encoded.size(), 2 + 32 + 32 + 8);
+    EXPECT_EQ(encoded[0], record_encoding::FORMAT_VERSION);
+    // only the left child is present
+    EXPECT_EQ(encoded[1], 1);
+    NodePayload decodedNode;
+    record_encoding::decode(encoded.data(), encoded.size(), decodedNode);
+    EXPECT_EQ(decodedNode, node);
+
+    BlockPayload block{ .size = 1ULL << 40, .blockNumber = 7, .root = VALUES[1] };
+    encoded = record_encoding::encode(block);
+    EXPECT_EQ(encoded.size(), 2 + 8 + 8 + 32);
+    BlockPayload decodedBlock;
+    record_encoding::decode(encoded.data(), encoded.size(), decodedBlock);
+    EXPECT_EQ(decodedBlock, block);
+
+    IndexedLeaf<PublicDataLeafValue> leaf(PublicDataLeafValue(VALUES[2], VALUES[3]), 5, VALUES[4]);
+    encoded = record_encoding::encode(leaf);
+    EXPECT_EQ(encoded.size(), 2 + 32 + 32 + 8 + 32);
+    IndexedLeaf<PublicDataLeafValue> decodedLeaf;
+    record_encoding::decode(encoded.data(), encoded.size(), decodedLeaf);
+    EXPECT_EQ(decodedLeaf, leaf);
+
+    // A truncated record is rejected
+    EXPECT_THROW(record_encoding::decode(encoded.data(), encoded.size() - 1, decodedLeaf), std::runtime_error);
+
+    // Records in the legacy msgpack encoding can still be decoded
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, node);
+    EXPECT_FALSE(record_encoding::is_fixed_layout(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));
+    NodePayload legacyNode;
+    record_encoding::decode(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size(), legacyNode);
+    EXPECT_EQ(legacyNode, node);
+}
+
+namespace {
+// Opens the databases of the store named DB1 directly
+struct RawStore {
+    LMDBEnvironment::SharedPtr env;
+    LMDBDatabase::Ptr blocks;
+    LMDBDatabase::Ptr nodes;
+    LMDBDatabase::Ptr leaves;
+    RawStore(const std::string& directory, uint64_t mapSize, uint64_t maxReaders)
+        : env(std::make_shared<LMDBEnvironment>(directory, mapSize, 5, maxReaders))
+    {
+        LMDBDatabaseCreationTransaction tx(env);
+        blocks = std::make_unique<LMDBDatabase>(env, tx, "DB1" + BLOCKS_DB, false, false, block_key_cmp);
+        nodes = std::make_unique<LMDBDatabase>(env, tx, "DB1" + NODES_DB, false, false, fr_key_cmp);
+        leaves = std::make_unique<LMDBDatabase>(env, tx, "DB1" + LEAF_PREIMAGES_DB, false, false, fr_key_cmp);
+        tx.commit();
+    }
+};
+
+template <typename T> std::vector<uint8_t> msgpack_encode(const T& value)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, value);
+    return std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size());
+}
+} // namespace
+
+TEST_F(LMDBTreeStoreTest, migrates_msgpack_records_to_the_fixed_layout)
+{
+    using LeafType = IndexedLeaf<PublicDataLeafValue>;
+    NodePayload node{ .left = VALUES[0], .right = VALUES[1], .ref = 2 };
+    BlockPayload block{ .size = 10, .blockNumber = 1, .root = VALUES[2] };
+    LeafType leaf(PublicDataLeafValue(VALUES[3], VALUES[4]), 6, VALUES[5]);
+    bb::fr nodeHash = VALUES[6];
+    bb::fr leafHash = VALUES[7];
+    FrKeyType nodeKey(nodeHash);
+    FrKeyType leafKey(leafHash);
+    BlockMetaKeyType blockKey(block.blockNumber);
+
+    {
+        // Write the records as they were written before the fixed layout was introduced
+        RawStore raw(_directory, _mapSize, _maxReaders);
+        LMDBTreeWriteTransaction tx(raw.env);
+        std::vector<uint8_t> data = msgpack_encode(node);
+        tx.put_value<FrKeyType>(nodeKey, data, *raw.nodes);
+        data = msgpack_encode(block);
+        tx.put_value<BlockMetaKeyType>(blockKey, data, *raw.blocks);
+        data = msgpack_encode(leaf);
+        tx.put_value<FrKeyType>(leafKey, data, *raw.leaves);
+        tx.commit();
+    }
+
+    auto check_records = [&](LMDBTreeStore& store) {
+        LMDBTreeReadTransaction::Ptr tx = store.create_read_transaction();
+        NodePayload readNode;
+        EXPECT_TRUE(store.read_node(nodeHash, readNode, *tx));
+        EXPECT_EQ(readNode, node);
+        BlockPayload readBlock;
+        EXPECT_TRUE(store.read_block_data(block.blockNumber, readBlock, *tx));
+        EXPECT_EQ(readBlock, block);
+        LeafType readLeaf;
+        EXPECT_TRUE(store.read_leaf_by_hash(leafHash, readLeaf, *tx));
+        EXPECT_EQ(readLeaf, leaf);
+    };
+
+    {
+        LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+        // The legacy records are readable before the migration
+        check_records(store);
+        store.migrate_records<LeafType>();
+        // Migrating again is a no-op
+        store.migrate_records<LeafType>();
+        store.invalidate_cache();
+        check_records(store);
+    }
+
+    {
+        RawStore raw(_directory, _mapSize, _maxReaders);
+        raw.env->wait_for_reader();
+        LMDBTreeReadTransaction tx(raw.env);
+        std::vector<uint8_t> data;
+        EXPECT_TRUE(tx.get_value<FrKeyType>(nodeKey, data, *raw.nodes));
+        EXPECT_EQ(data, record_encoding::encode(node));
+        EXPECT_TRUE(tx.get_value<BlockMetaKeyType>(blockKey, data, *raw.blocks));
+        EXPECT_EQ(data, record_encoding::encode(block));
+        EXPECT_TRUE(tx.get_value<FrKeyType>(leafKey, data, *raw.leaves));
+        EXPECT_EQ(data, record_encoding::encode(leaf));
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, migrates_records_in_resumable_batches)
+{
+    using LeafType = IndexedLeaf<PublicDataLeafValue>;
+    constexpr size_t NUM_RECORDS = 5;
+    std::vector<NodePayload> nodes;
+    std::vector<BlockPayload> blocks;
+    std::vector<LeafType> leaves;
+    for (size_t i = 0; i < NUM_RECORDS; ++i) {
+        nodes.push_back(NodePayload{ .left = VALUES[i], .right = VALUES[i + 1], .ref = i + 1 });
+        blocks.push_back(BlockPayload{ .size = 10 * (i + 1), .blockNumber = i + 1, .root = VALUES[i + 2] });
+        leaves.emplace_back(PublicDataLeafValue(VALUES[i + 3], VALUES[i + 4]), i + 6, VALUES[i + 5]);
+    }
+    // The hashes of the nodes and leaves, whose keys are independent of their content
+    auto node_hash = [](size_t i) { return VALUES[10 + i]; };
+    auto leaf_hash = [](size_t i) { return VALUES[20 + i]; };
+
+    {
+        RawStore raw(_directory, _mapSize, _maxReaders);
+        LMDBTreeWriteTransaction tx(raw.env);
+        for (size_t i = 0; i < NUM_RECORDS; ++i) {
+            FrKeyType nodeKey(node_hash(i));
+            std::vector<uint8_t> data = msgpack_encode(nodes[i]);
+            tx.put_value<FrKeyType>(nodeKey, data, *raw.nodes);
+            BlockMetaKeyType blockKey(blocks[i].blockNumber);
+            data = msgpack_encode(blocks[i]);
+            tx.put_value<BlockMetaKeyType>(blockKey, data, *raw.blocks);
+            FrKeyType leafKey(leaf_hash(i));
+            data = msgpack_encode(leaves[i]);
+            tx.put_value<FrKeyType>(leafKey, data, *raw.leaves);
+        }
+        tx.commit();
+    }
+
+    auto check_records = [&](LMDBTreeStore& store) {
+        LMDBTreeReadTransaction::Ptr tx = store.create_read_transaction();
+        for (size_t i = 0; i < NUM_RECORDS; ++i) {
+            NodePayload readNode;
+            EXPECT_TRUE(store.read_node(node_hash(i), readNode, *tx));
+            EXPECT_EQ(readNode, nodes[i]);
+            BlockPayload readBlock;
+            EXPECT_TRUE(store.read_block_data(blocks[i].blockNumber, readBlock, *tx));
+            EXPECT_EQ(readBlock, blocks[i]);
+            LeafType readLeaf;
+            EXPECT_TRUE(store.read_leaf_by_hash(leaf_hash(i), readLeaf, *tx));
+            EXPECT_EQ(readLeaf, leaves[i]);
+        }
+    };
+    {
+        // Interrupt the migration after the 5 nodes and 3 of the blocks, in batches of 3 records
+        LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+        EXPECT_FALSE(store.migrate_record_batch<LeafType>(3));
+        EXPECT_FALSE(store.migrate_record_batch<LeafType>(3));
+        EXPECT_FALSE(store.migrate_record_batch<LeafType>(3));
+        check_records(store);
+    }
+
+    {
+        // Only the records of the completed batches are migrated and the format version is not yet recorded
+        RawStore raw(_directory, _mapSize, _maxReaders);
+        LMDBTreeReadTransaction tx(raw.env);
+        std::vector<uint8_t> data;
+        for (size_t i = 0; i < NUM_RECORDS; ++i) {
+            FrKeyType nodeKey(node_hash(i));
+            EXPECT_TRUE(tx.get_value<FrKeyType>(nodeKey, data, *raw.nodes));
+            EXPECT_EQ(data, record_encoding::encode(nodes[i]));
+            BlockMetaKeyType blockKey(blocks[i].blockNumber);
+            EXPECT_TRUE(tx.get_value<BlockMetaKeyType>(blockKey, data, *raw.blocks));
+            EXPECT_EQ(data, i < 3 ? record_encoding::encode(blocks[i]) : msgpack_encode(blocks[i]));
+            FrKeyType leafKey(leaf_hash(i));
+            EXPECT_TRUE(tx.get_value<FrKeyType>(leafKey, data, *raw.leaves));
+            EXPECT_EQ(data, msgpack_encode(leaves[i]));
+        }
+        MetaKeyType formatKey(1);
+        EXPECT_FALSE(tx.get_value<MetaKeyType>(formatKey, data, *raw.blocks));
+    }
+
+    {
+        // The migration resumes where it stopped
+        LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+        store.migrate_records<LeafType>(3);
+        EXPECT_TRUE(store.migrate_record_batch<LeafType>(3));
+        store.invalidate_cache();
+        check_records(store);
+    }
+
+    {
+        RawStore raw(_directory, _mapSize, _maxReaders);
+        LMDBTreeReadTransaction tx(raw.env);
+        std::vector<uint8_t> data;
+        for (size_t i = 0; i < NUM_RECORDS; ++i) {
+            BlockMetaKeyType blockKey(blocks[i].blockNumber);
+            EXPECT_TRUE(tx.get_value<BlockMetaKeyType>(blockKey, data, *raw.blocks));
+            EXPECT_EQ(data, record_encoding::encode(blocks[i]));
+            FrKeyType leafKey(leaf_hash(i));
+            EXPECT_TRUE(tx.get_value<FrKeyType>(leafKey, data, *raw.leaves));
+            EXPECT_EQ(data, record_encoding::encode(leaves[i]));
+        }
+        MetaKeyType formatKey(1);
+        EXPECT_TRUE(tx.get_value<MetaKeyType>(formatKey, data, *raw.blocks));
+        EXPECT_EQ(data, std::vector<uint8_t>{ record_encoding::FORMAT_VERSION });
+        // The progress of the migration is removed once it completes
+        MetaKeyType progressKey(2);
+        EXPECT_FALSE(tx.get_value<MetaKeyType>(progressKey, data, *raw.blocks));
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, reads_committed_nodes_and_leaves_through_the_cache)
+{
+    NodePayload nodePayload;
+    nodePayload.left = VALUES[4];
+    nodePayload.right = VALUES[5];
+    nodePayload.ref = 1;
+    PublicDataLeafValue leafData;
+    leafData.slot = VALUES[0];
+    leafData.value = VALUES[1];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(VALUES[6], nodePayload, *transaction);
+        store.write_leaf_by_hash(VALUES[7], leafData, *transaction);
+        transaction->commit();
+    }
+
+    {
+        LMDBTreeReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (uint32_t i = 0; i < 3; i++) {
+            NodePayload readBack;
+            EXPECT_TRUE(store.read_node(VALUES[6], readBack, *transaction));
+            EXPECT_EQ(readBack, nodePayload);
+            PublicDataLeafValue leafReadBack;
+            EXPECT_TRUE(store.read_leaf_by_hash(VALUES[7], leafReadBack, *transaction));
+            EXPECT_EQ(leafReadBack, leafData);
+        }
+        NodePayload readBack;
+        EXPECT_FALSE(store.read_node(VALUES[9], readBack, *transaction));
+
+        TreeDBStats stats;
+        store.get_stats(stats, *transaction);
+        EXPECT_EQ(stats.nodesCacheStats.numItems, 1);
+        EXPECT_EQ(stats.nodesCacheStats.hits, 2);
+        EXPECT_EQ(stats.nodesCacheStats.misses, 2);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.numItems, 1);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.hits, 2);
+        EXPECT_EQ(stats.leafPreimagesCacheStats.misses, 1);
+    }
+
+    // writing a node evicts the cached copy
+    nodePayload.ref = 2;
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(VALUES[6], nodePayload, *transaction);
+        transaction->commit();
+    }
+    {
+        LMDBTreeReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload readBack;
+        EXPECT_TRUE(store.read_node(VALUES[6], readBack, *transaction));
+        EXPECT_EQ(readBack, nodePayload);
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, node_cache_is_bounded)
+{
+    uint64_t cacheSizeKb = 16;
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders, cacheSizeKb);
+    std::vector<bb::fr> hashes;
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (uint32_t i = 0; i < 1024; i++) {
+            hashes.push_back(bb::fr::random_element());
+            NodePayload nodePayload{ .left = VALUES[0], .right = VALUES[1], .ref = 1 };
+            store.write_node(hashes.back(), nodePayload, *transaction);
+        }
+        transaction->commit();
+    }
+    {
+        LMDBTreeReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (const bb::fr& hash : hashes) {
+            NodePayload readBack;
+            EXPECT_TRUE(store.read_node(hash, readBack, *transaction));
+        }
+        TreeDBStats stats;
+        store.get_stats(stats, *transaction);
+        EXPECT_EQ(stats.nodesCacheStats.capacity, cacheSizeKb * 512);
+        EXPECT_LE(stats.nodesCacheStats.totalUsedSize, stats.nodesCacheStats.capacity);
+        EXPECT_GT(stats.nodesCacheStats.numItems, 0);
+        EXPECT_LT(stats.nodesCacheStats.numItems, hashes.size());
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, stale_readers_do_not_populate_an_invalidated_cache)
+{
+    NodePayload nodePayload;
+    nodePayload.left = VALUES[4];
+    nodePayload.right = VALUES[5];
+    nodePayload.ref = 1;
+    bb::fr key = VALUES[6];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_node(key, nodePayload, *transaction);
+        transaction->commit();
+    }
+
+    // This reader's snapshot still contains the node after it has been deleted
+    LMDBTreeReadTransaction::Ptr staleTransaction = store.create_read_transaction();
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        NodePayload removed;
+        store.decrement_node_reference_count(key, removed, *transaction);
+        transaction->commit();
+    }
+    store.invalidate_cache();
+
+    NodePayload readBack;
+    EXPECT_TRUE(store.read_node(key, readBack, *staleTransaction));
+    staleTransaction.reset();
+
+    {
+        LMDBTreeReadTransaction::Ptr transaction = store.create_read_transaction();
+        EXPECT_FALSE(store.read_node(key, readBack, *transaction));
+    }
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
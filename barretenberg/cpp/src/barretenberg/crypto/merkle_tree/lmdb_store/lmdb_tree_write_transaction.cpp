@@ -51,4 +51,14 @@ void LMDBTreeWriteTransaction::delete_value(std::vector<uint8_t>& key, const LMD
 {
     lmdb_queries::delete_value(key, db, *this);
 }
+
+bool LMDBTreeWriteTransaction::update_values_greater_or_equal_key(
+    const std::vector<uint8_t>& key,
+    uint64_t maxValues,
+    const std::function<bool(const MDB_val&, std::vector<uint8_t>&)>& update,
+    std::vector<uint8_t>& nextKey,
+    const LMDBDatabase& db) const
+{
+    return lmdb_queries::update_values_greater_or_equal_key(key, maxValues, update, nextKey, db, *this);
+}
 } // namespace bb::crypto::merkle_tree
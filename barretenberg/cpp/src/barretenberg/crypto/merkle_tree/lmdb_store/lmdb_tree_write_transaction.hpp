@@ -9,6 +9,8 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <exception>
+#include <functional>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 
@@ -46,6 +48,17 @@ class LMDBTreeWriteTransaction : public LMDBTransaction {
 
     template <typename T> void delete_all_values_lesser_or_equal_key(const T& key, const LMDBDatabase& db) const;
 
+    /*
+     * Calls update for at most maxValues values with a key of the same size as, and greater than or equal to, the
+     * given serialised key. If update returns true the value is replaced with the one it provided. Returns true if
+     * values remain beyond the limit, nextKey then holding the serialised key of the first of them.
+     */
+    bool update_values_greater_or_equal_key(const std::vector<uint8_t>& key,
+                                            uint64_t maxValues,
+                                            const std::function<bool(const MDB_val&, std::vector<uint8_t>&)>& update,
+                                            std::vector<uint8_t>& nextKey,
+                                            const LMDBDatabase& db) const;
+
     void commit();
 
     void try_abort();
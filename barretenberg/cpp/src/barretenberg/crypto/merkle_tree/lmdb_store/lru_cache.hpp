@@ -0,0 +1,185 @@
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * A bounded, concurrent least-recently-used cache keyed by hash.
+ * The key space is split over a number of shards, each with its own lock, LRU list and byte budget so that concurrent
+ * readers rarely contend. The byte budget counts the key, the value and a fixed per-entry overhead for the list and
+ * map nodes.
+ *
+ * Entries are only ever added by readers of committed data. To stop a reader holding an older snapshot from
+ * re-populating the cache after it has been invalidated, every put is tagged with the generation at which the reader's
+ * snapshot was taken and is dropped if the cache has since been invalidated.
+ */
+template <typename ValueType> class ShardedLRUCache {
+  public:
+    static constexpr size_t DEFAULT_NUM_SHARDS = 16;
+    static constexpr uint64_t ENTRY_OVERHEAD_BYTES = 64;
+
+    ShardedLRUCache(std::string name, uint64_t capacityBytes, size_t numShards = DEFAULT_NUM_SHARDS)
+        : _name(std::move(name))
+        , _capacity(capacityBytes)
+        , _shards(numShards)
+    {
+        for (Shard& shard : _shards) {
+            shard.capacity = capacityBytes / numShards;
+        }
+    }
+    ShardedLRUCache(const ShardedLRUCache& other) = delete;
+    ShardedLRUCache(ShardedLRUCache&& other) = delete;
+    ShardedLRUCache& operator=(const ShardedLRUCache& other) = delete;
+    ShardedLRUCache& operator=(ShardedLRUCache&& other) = delete;
+    ~ShardedLRUCache() = default;
+
+    bool enabled() const { return _capacity > 0; }
+
+    /**
+     * Returns the cached value for the key if present, marking it as most recently used
+     */
+    bool get(const fr& key, ValueType& value)
+    {
+        if (!enabled()) {
+            return false;
+        }
+        Shard& shard = shard_for(key);
+        {
+            std::unique_lock lock(shard.mtx);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                value = it->second->value;
+                _hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        _misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * Adds the value read at the given generation, evicting the least recently used entries of the shard as required
+     */
+    void put(const fr& key, const ValueType& value, uint64_t valueSize, uint64_t readGeneration)
+    {
+        if (!enabled()) {
+            return;
+        }
+        uint64_t entrySize = sizeof(fr) + valueSize + ENTRY_OVERHEAD_BYTES;
+        Shard& shard = shard_for(key);
+        std::unique_lock lock(shard.mtx);
+        if (readGeneration != _generation.load(std::memory_order_acquire) || entrySize > shard.capacity) {
+            return;
+        }
+        auto it = shard.index.find(key);
+        if (it != shard.index.end()) {
+            shard.size -= it->second->size;
+            shard.entries.erase(it->second);
+            shard.index.erase(it);
+        }
+        while (!shard.entries.empty() && shard.size + entrySize > shard.capacity) {
+            Entry& lru = shard.entries.back();
+            shard.size -= lru.size;
+            shard.index.erase(lru.key);
+            shard.entries.pop_back();
+        }
+        shard.entries.push_front(Entry{ .key = key, .value = value, .size = entrySize });
+        shard.index[key] = shard.entries.begin();
+        shard.size += entrySize;
+    }
+
+    /**
+     * Removes the entry for the key if present
+     */
+    void erase(const fr& key)
+    {
+        if (!enabled()) {
+            return;
+        }
+        Shard& shard = shard_for(key);
+        std::unique_lock lock(shard.mtx);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return;
+        }
+        shard.size -= it->second->size;
+        shard.entries.erase(it->second);
+        shard.index.erase(it);
+    }
+
+    /**
+     * Removes all entries and moves the cache to the given generation. Puts tagged with an earlier generation are
+     * dropped from here on.
+     */
+    void invalidate(uint64_t generation)
+    {
+        // The generation must be updated before the shards are cleared, a put that acquires a shard lock after that
+        // shard has been cleared will then see the new generation
+        _generation.store(generation, std::memory_order_release);
+        for (Shard& shard : _shards) {
+            std::unique_lock lock(shard.mtx);
+            shard.entries.clear();
+            shard.index.clear();
+            shard.size = 0;
+        }
+    }
+
+    CacheStats get_stats() const
+    {
+        uint64_t numItems = 0;
+        uint64_t totalUsedSize = 0;
+        for (const Shard& shard : _shards) {
+            std::unique_lock lock(shard.mtx);
+            numItems += shard.index.size();
+            totalUsedSize += shard.size;
+        }
+        return CacheStats(_name,
+                          _capacity,
+                          numItems,
+                          totalUsedSize,
+                          _hits.load(std::memory_order_relaxed),
+                          _misses.load(std::memory_order_relaxed));
+    }
+
+  private:
+    struct Entry {
+        fr key;
+        ValueType value;
+        uint64_t size;
+    };
+
+    // The keys are hashes so any limb of the raw representation is uniformly distributed
+    struct KeyHash {
+        size_t operator()(const fr& key) const { return static_cast<size_t>(key.data[0]); }
+    };
+
+    struct Shard {
+        mutable std::mutex mtx;
+        std::list<Entry> entries;
+        std::unordered_map<fr, typename std::list<Entry>::iterator, KeyHash> index;
+        uint64_t size = 0;
+        uint64_t capacity = 0;
+    };
+
+    // Use a different limb to the one used for hashing within the shard
+    Shard& shard_for(const fr& key) { return _shards[static_cast<size_t>(key.data[1] % _shards.size())]; }
+
+    std::string _name;
+    uint64_t _capacity;
+    std::vector<Shard> _shards;
+    std::atomic<uint64_t> _generation = 0;
+    std::atomic<uint64_t> _hits = 0;
+    std::atomic<uint64_t> _misses = 0;
+};
+} // namespace bb::crypto::merkle_tree
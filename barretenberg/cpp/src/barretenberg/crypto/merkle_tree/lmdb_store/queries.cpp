@@ -87,4 +87,17 @@ bool get_value(std::vector<uint8_t>& key,
     deserialise_key(dbVal.mv_data, data);
     return true;
 }
+
+bool get_value(std::vector<uint8_t>& key,
+               MDB_val& data,
+               const LMDBDatabase& db,
+               const bb::crypto::merkle_tree::LMDBTransaction& tx)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    // the value refers directly to the memory map, no copy is made
+    return call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &data);
+}
 } // namespace bb::crypto::merkle_tree::lmdb_queries
\ No newline at end of file
@@ -309,6 +309,73 @@ void delete_all_values_greater_or_equal_key(const TKey& key, const LMDBDatabase&
     call_lmdb_func(mdb_cursor_close, cursor);
 }
 
+template <typename TxType>
+bool update_values_greater_or_equal_key(const std::vector<uint8_t>& key,
+                                        uint64_t maxValues,
+                                        const std::function<bool(const MDB_val&, std::vector<uint8_t>&)>& update,
+                                        std::vector<uint8_t>& nextKey,
+                                        const LMDBDatabase& db,
+                                        const TxType& tx)
+{
+    std::vector<uint8_t> keyBuffer = key;
+    uint32_t keySize = static_cast<uint32_t>(keyBuffer.size());
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+
+    bool remaining = false;
+    try {
+        MDB_val dbKey;
+        dbKey.mv_size = keySize;
+        dbKey.mv_data = (void*)keyBuffer.data();
+
+        MDB_val dbVal;
+        // Look for the key >= to that provided
+        int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_SET_RANGE);
+        uint64_t numValues = 0;
+        while (true) {
+            if (code == 0) {
+                // found a key >= our key. if it is not the same size, it must be out of range for what we are looking
+                // for, this means no more data available
+                if (keySize != dbKey.mv_size) {
+                    break;
+                }
+                if (numValues == maxValues) {
+                    // the limit has been reached, return the key to continue from
+                    nextKey = mdb_val_to_vector(dbKey);
+                    remaining = true;
+                    break;
+                }
+                ++numValues;
+                std::vector<uint8_t> updated;
+                if (update(dbVal, updated)) {
+                    // the key and value point into the page that is about to be modified, take a copy of the key
+                    std::vector<uint8_t> currentKey = mdb_val_to_vector(dbKey);
+                    dbKey.mv_data = (void*)currentKey.data();
+                    dbVal.mv_size = updated.size();
+                    dbVal.mv_data = (void*)updated.data();
+                    code = mdb_cursor_put(cursor, &dbKey, &dbVal, MDB_CURRENT);
+                    if (code != 0) {
+                        throw_error("update_values_greater_or_equal_key::mdb_cursor_put", code);
+                    }
+                }
+
+                // move to the next key
+                code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_NEXT);
+            } else if (code == MDB_NOTFOUND) {
+                // no more data to update
+                break;
+            } else {
+                throw_error("update_values_greater_or_equal_key::mdb_cursor_get", code);
+            }
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+    return remaining;
+}
+
 template <typename TKey, typename TxType>
 void get_all_values_lesser_or_equal_key(const TKey& key,
                                         std::vector<std::vector<uint8_t>>& data,
@@ -455,5 +522,7 @@ bool get_value(std::vector<uint8_t>& key,
                const LMDBTransaction& tx);
 
 bool get_value(std::vector<uint8_t>& key, index_t& data, const LMDBDatabase& db, const LMDBTransaction& tx);
+
+bool get_value(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 } // namespace lmdb_queries
 } // namespace bb::crypto::merkle_tree
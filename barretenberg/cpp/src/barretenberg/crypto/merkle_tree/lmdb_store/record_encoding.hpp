@@ -0,0 +1,178 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include "barretenberg/serialize/msgpack_apply.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace bb::crypto::merkle_tree::record_encoding {
+
+/**
+ * Fixed width binary layout for the records held in the tree store. A record is laid out as
+ *
+ * [version: 1 byte][presence mask: 1 byte][fields...]
+ *
+ * where the fields are written in declaration order as
+ * - field elements: 32 bytes, the canonical (non-Montgomery) value as 4 little-endian 64 bit limbs
+ * - 64 bit integers: 8 bytes, little-endian
+ * - optional field elements: a bit in the presence mask, in declaration order, followed by 32 bytes that are zero when
+ *   the value is absent
+ * - nested structures: their own fields, in declaration order
+ *
+ * Every record of a given type therefore has the same size and is decoded with a single pass over the bytes, directly
+ * from the memory map. Records written before this layout was introduced are msgpack encoded. A msgpack encoded
+ * structure always starts with a map marker, never with the version byte, so both formats can be read.
+ */
+constexpr uint8_t FORMAT_VERSION = 1;
+constexpr size_t HEADER_SIZE = 2;
+constexpr size_t MAX_OPTIONAL_FIELDS = 8;
+
+class Encoder {
+  public:
+    std::vector<uint8_t> buffer{ FORMAT_VERSION, 0 };
+
+    void write(uint64_t value)
+    {
+        for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+            buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+
+    void write(const fr& value)
+    {
+        const fr canonical = value.from_montgomery_form();
+        for (const uint64_t limb : canonical.data) {
+            write(limb);
+        }
+    }
+
+    void write(const std::optional<fr>& value)
+    {
+        if (_numOptionals == MAX_OPTIONAL_FIELDS) {
+            throw std::runtime_error("Too many optional fields for the record presence mask");
+        }
+        if (value.has_value()) {
+            buffer[1] |= static_cast<uint8_t>(1U << _numOptionals);
+        }
+        ++_numOptionals;
+        write(value.value_or(fr::zero()));
+    }
+
+    template <msgpack_concepts::HasMsgPack T> void write(const T& value)
+    {
+        msgpack::msgpack_apply(value, [&](const auto&... fields) { (write(fields), ...); });
+    }
+
+  private:
+    size_t _numOptionals = 0;
+};
+
+class Decoder {
+  public:
+    Decoder(const uint8_t* data, size_t size)
+        : _data(data)
+        , _size(size)
+    {}
+
+    bool complete() const { return _offset == _size; }
+
+    void read(uint64_t& value)
+    {
+        check_available(sizeof(uint64_t));
+        value = 0;
+        for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+            value |= static_cast<uint64_t>(_data[_offset + i]) << (8 * i);
+        }
+        _offset += sizeof(uint64_t);
+    }
+
+    void read(fr& value)
+    {
+        uint256_t canonical;
+        for (uint64_t& limb : canonical.data) {
+            read(limb);
+        }
+        value = fr(canonical);
+    }
+
+    void read(std::optional<fr>& value)
+    {
+        if (_numOptionals == MAX_OPTIONAL_FIELDS) {
+            throw std::runtime_error("Too many optional fields for the record presence mask");
+        }
+        const bool present = ((_data[1] >> _numOptionals) & 1U) != 0;
+        ++_numOptionals;
+        fr element;
+        read(element);
+        value = present ? std::optional<fr>(element) : std::nullopt;
+    }
+
+    template <msgpack_concepts::HasMsgPack T> void read(T& value)
+    {
+        // msgpack_apply hands out mutable references to the fields
+        msgpack::msgpack_apply(value, [&](auto&... fields) { (read(fields), ...); });
+    }
+
+  private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _offset = HEADER_SIZE;
+    size_t _numOptionals = 0;
+
+    void check_available(size_t numBytes) const
+    {
+        if (_offset + numBytes > _size) {
+            throw std::runtime_error("Truncated tree store record");
+        }
+    }
+};
+
+/**
+ * Returns true if the bytes are a record in the fixed layout, as opposed to a legacy msgpack record
+ */
+inline bool is_fixed_layout(const uint8_t* data, size_t size)
+{
+    return size >= HEADER_SIZE && data[0] == FORMAT_VERSION;
+}
+
+template <typename RecordType> std::vector<uint8_t> encode(const RecordType& record)
+{
+    Encoder encoder;
+    encoder.write(record);
+    return std::move(encoder.buffer);
+}
+
+/**
+ * Decodes a record in either the fixed layout or the legacy msgpack encoding
+ */
+template <typename RecordType> void decode(const uint8_t* data, size_t size, RecordType& record)
+{
+    if (!is_fixed_layout(data, size)) {
+        msgpack::unpack(reinterpret_cast<const char*>(data), size).get().convert(record);
+        return;
+    }
+    Decoder decoder(data, size);
+    decoder.read(record);
+    if (!decoder.complete()) {
+        throw std::runtime_error("Unexpected trailing bytes in tree store record");
+    }
+}
+
+/**
+ * Re-encodes a legacy msgpack record in the fixed layout. Returns false if the record is already in the fixed layout.
+ */
+template <typename RecordType> bool upgrade(const uint8_t* data, size_t size, std::vector<uint8_t>& upgraded)
+{
+    if (is_fixed_layout(data, size)) {
+        return false;
+    }
+    RecordType record;
+    msgpack::unpack(reinterpret_cast<const char*>(data), size).get().convert(record);
+    upgraded = encode(record);
+    return true;
+}
+} // namespace bb::crypto::merkle_tree::record_encoding
@@ -1,4 +1,5 @@
 #pragma once
+#include "./sorted_leaf_index.hpp"
 #include "./tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
@@ -16,6 +17,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -91,6 +93,11 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void update_index(const index_t& index, const fr& leaf);
 
+    /**
+     * @brief Updates the leaf index for a batch of leaves
+     */
+    void update_indices(const std::vector<std::pair<fr, index_t>>& leaves);
+
     /**
      * @brief Writes the provided data at the given node coordinates. Only writes to uncommitted data.
      */
@@ -198,14 +205,16 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
     // index in the tree
-    std::map<uint256_t, index_t> indices_;
+    SortedLeafIndex indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
     std::unordered_map<fr, IndexedLeafValueType> leaves_;
     PersistedStoreType::SharedPtr dataStore_;
     TreeMeta meta_;
-    mutable std::mutex mtx_;
+    // Guards the uncommitted state. Reads take a shared lock so that the many concurrent readers of a fork do not
+    // serialise on one another, the tree's updates take an exclusive lock to publish changes.
+    mutable std::shared_mutex mtx_;
 
     // The following stores are not persisted, just cached until commit
     std::vector<std::unordered_map<index_t, fr>> nodes_by_index_;
@@ -331,37 +340,27 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
     uint256_t retrieved_value = found_key;
 
     // Accessing indices_ from here under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     if (!requestContext.includeUncommitted || retrieved_value == new_value_as_number || indices_.empty()) {
         return std::make_pair(new_value_as_number == retrieved_value, db_index);
     }
 
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_value_as_number);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    auto low = indices_.find_lower_or_equal(new_value_as_number);
+    if (!low.has_value()) {
+        // No cached lower value, return the db index
+        return std::make_pair(false, db_index);
     }
 
-    if (it->first == uint256_t(new_value_as_number)) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
+    if (low->first == new_value_as_number) {
+        // the value is already present
+        return std::make_pair(true, low->second);
     }
-    // the iterator points to the element immediately larger than the requested value
+    // low is the cached value immediately less than that requested
     // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
+    // 1. The next lowest cached value
     // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
-        return std::make_pair(false, db_index);
-    }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    return std::make_pair(false, low->first > retrieved_value ? low->second : db_index);
 }
 
 template <typename LeafValueType>
@@ -373,7 +372,7 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
     std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLeafValueType> leaf = std::nullopt;
     if (includeUncommitted) {
         // Accessing leaves_ here under a lock
-        std::unique_lock lock(mtx_);
+        std::shared_lock lock(mtx_);
         typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
         if (it != leaves_.end()) {
             leaf = it->second;
@@ -402,7 +401,7 @@ std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLe
 ContentAddressedCachedTreeStore<LeafValueType>::get_cached_leaf_by_index(const index_t& index) const
 {
     // Accessing leaf_pre_image_by_index_ under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     auto it = leaf_pre_image_by_index_.find(index);
     if (it == leaf_pre_image_by_index_.end()) {
         return std::nullopt;
@@ -433,7 +432,20 @@ void ContentAddressedCachedTreeStore<LeafValueType>::update_index(const index_t&
     // std::cout << "update_index at index " << index << " leaf " << leaf << std::endl;
     //  Accessing indices_ under a lock
     std::unique_lock lock(mtx_);
-    indices_.insert({ uint256_t(leaf), index });
+    indices_.insert(uint256_t(leaf), index);
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::update_indices(const std::vector<std::pair<fr, index_t>>& leaves)
+{
+    std::vector<std::pair<uint256_t, index_t>> entries;
+    entries.reserve(leaves.size());
+    for (const auto& [leaf, index] : leaves) {
+        entries.emplace_back(uint256_t(leaf), index);
+    }
+    // Accessing indices_ under a lock
+    std::unique_lock lock(mtx_);
+    indices_.insert(std::move(entries));
 }
 
 template <typename LeafValueType>
@@ -452,13 +464,13 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
 {
     if (requestContext.includeUncommitted) {
         // Accessing indices_ under a lock
-        std::unique_lock lock(mtx_);
-        auto it = indices_.find(uint256_t(leaf));
-        if (it != indices_.end()) {
+        std::shared_lock lock(mtx_);
+        auto index = indices_.find(uint256_t(leaf));
+        if (index.has_value()) {
             // we have an uncommitted value, we will return from here
-            if (it->second >= start_index) {
+            if (index.value() >= start_index) {
                 // we have a qualifying value
-                return std::make_optional(it->second);
+                return index;
             }
             return std::nullopt;
         }
@@ -497,7 +509,7 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
 {
     if (includeUncommitted) {
         // Accessing nodes_ under a lock
-        std::unique_lock lock(mtx_);
+        std::shared_lock lock(mtx_);
         auto it = nodes_.find(nodeHash);
         if (it != nodes_.end()) {
             payload = it->second;
@@ -531,7 +543,7 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(ui
                                                                               fr& data) const
 {
     // Accessing nodes_by_index_ under a lock
-    std::unique_lock lock(mtx_);
+    std::shared_lock lock(mtx_);
     const auto& level_map = nodes_by_index_[level];
     auto it = level_map.find(index);
     if (it == level_map.end()) {
@@ -555,7 +567,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::get_meta(TreeMeta& m,
 {
     if (includeUncommitted) {
         // Accessing meta_ under a lock
-        std::unique_lock lock(mtx_);
+        std::shared_lock lock(mtx_);
         m = meta_;
         return;
     }
@@ -691,10 +703,10 @@ void ContentAddressedCachedTreeStore<LeafValueType>::extract_db_stats(TreeDBStat
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        FrKeyType key = idx.first;
-        dataStore_->write_leaf_index(key, idx.second, tx);
-    }
+    indices_.for_each([&](const uint256_t& leaf, const index_t& index) {
+        FrKeyType key = leaf;
+        dataStore_->write_leaf_index(key, index, tx);
+    });
 }
 
 template <typename LeafValueType>
@@ -765,7 +777,7 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         read_persisted_meta(meta_, *tx);
     }
     nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, index_t>();
+    indices_ = SortedLeafIndex();
     leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
     nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>());
     leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
@@ -919,6 +931,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
         throw std::runtime_error(
             format("Unable to commit unwind of block: ", blockNumber, ". Tree name: ", name_, " Error: ", e.what()));
     }
+    // nodes and leaves may have been deleted from the store, drop everything read before the unwind
+    dataStore_->invalidate_cache();
 
     // now update the uncommitted meta
     put_meta(uncommittedMeta);
@@ -989,6 +1003,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_historical_block(con
                                         " Error: ",
                                         e.what()));
     }
+    // nodes and leaves may have been deleted from the store, drop everything read before the removal
+    dataStore_->invalidate_cache();
 
     // commit was successful, update the uncommitted meta
     uncommittedMeta.oldestHistoricBlock = committedMeta.oldestHistoricBlock;
@@ -1083,6 +1099,10 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_node(const std::opti
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::initialise()
 {
+    // Upgrade any records persisted in the legacy msgpack encoding. Forks are only ever created from a tree that has
+    // been initialised, so they don't need to do this.
+    dataStore_->template migrate_records<IndexedLeafValueType>();
+
     // Read the persisted meta data, if the name or depth of the tree is not consistent with what was provided during
     // construction then we throw
     std::vector<uint8_t> data;
@@ -0,0 +1,233 @@
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An ordered map from leaf key to leaf index, used for the uncommitted leaves of a tree
+ *
+ * @details Entries are held in sorted blocks of at most MAX_BLOCK_SIZE keys. Within a block the keys are stored
+ * contiguously, separately from the indices, and the largest key of every block is kept in a contiguous array of
+ * fences. A lookup is then a binary search over the fences followed by one over a single block, touching a handful of
+ * cache lines rather than chasing the pointers of a node based tree. Inserting into a block moves at most
+ * MAX_BLOCK_SIZE entries, a full block is split in two.
+ *
+ * Like std::map::insert, inserting a key that is already present leaves the existing index untouched.
+ */
+class SortedLeafIndex {
+  public:
+    using KeyType = uint256_t;
+    static constexpr size_t MAX_BLOCK_SIZE = 256;
+
+    SortedLeafIndex() = default;
+    SortedLeafIndex(const SortedLeafIndex& other) = default;
+    SortedLeafIndex(SortedLeafIndex&& other) noexcept = default;
+    SortedLeafIndex& operator=(const SortedLeafIndex& other) = default;
+    SortedLeafIndex& operator=(SortedLeafIndex&& other) noexcept = default;
+    ~SortedLeafIndex() = default;
+
+    bool empty() const { return size_ == 0; }
+
+    size_t size() const { return size_; }
+
+    void clear()
+    {
+        blocks_.clear();
+        fences_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Adds the key with the given index, returns false if the key was already present
+     */
+    bool insert(const KeyType& key, const index_t& index)
+    {
+        if (blocks_.empty()) {
+            blocks_.emplace_back();
+            fences_.emplace_back(key);
+        }
+        // The first block whose largest key is not less than the key, or the last block if the key is the largest
+        size_t block_index = find_block(key);
+        if (block_index == blocks_.size()) {
+            --block_index;
+        }
+        Block& block = blocks_[block_index];
+        auto it = std::lower_bound(block.keys.begin(), block.keys.end(), key);
+        if (it != block.keys.end() && *it == key) {
+            return false;
+        }
+        auto position = static_cast<size_t>(it - block.keys.begin());
+        block.keys.insert(it, key);
+        block.indices.insert(block.indices.begin() + static_cast<std::ptrdiff_t>(position), index);
+        fences_[block_index] = block.keys.back();
+        ++size_;
+        if (block.keys.size() > MAX_BLOCK_SIZE) {
+            split_block(block_index);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Adds many keys at once. Keys that are already present, or repeated in the batch, keep the first index
+     * seen, as if they were inserted one by one in order.
+     *
+     * @details A batch that is large compared to the existing entries is merged in a single pass and the blocks are
+     * rebuilt, otherwise the keys are inserted individually.
+     */
+    void insert(std::vector<std::pair<KeyType, index_t>> entries)
+    {
+        if (entries.size() * 8 < size_) {
+            for (const auto& [key, index] : entries) {
+                insert(key, index);
+            }
+            return;
+        }
+        std::stable_sort(
+            entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        std::vector<std::pair<KeyType, index_t>> merged;
+        merged.reserve(size_ + entries.size());
+        auto batch_it = entries.begin();
+        for (const Block& block : blocks_) {
+            for (size_t i = 0; i < block.keys.size(); ++i) {
+                for (; batch_it != entries.end() && batch_it->first < block.keys[i]; ++batch_it) {
+                    append_unique(merged, *batch_it);
+                }
+                merged.emplace_back(block.keys[i], block.indices[i]);
+                // the existing entry takes precedence
+                while (batch_it != entries.end() && batch_it->first == block.keys[i]) {
+                    ++batch_it;
+                }
+            }
+        }
+        for (; batch_it != entries.end(); ++batch_it) {
+            append_unique(merged, *batch_it);
+        }
+        build(merged);
+    }
+
+    /**
+     * @brief Returns the index stored against the key, if present
+     */
+    std::optional<index_t> find(const KeyType& key) const
+    {
+        size_t block_index = find_block(key);
+        if (block_index == blocks_.size()) {
+            return std::nullopt;
+        }
+        const Block& block = blocks_[block_index];
+        auto it = std::lower_bound(block.keys.begin(), block.keys.end(), key);
+        if (it == block.keys.end() || *it != key) {
+            return std::nullopt;
+        }
+        return block.indices[static_cast<size_t>(it - block.keys.begin())];
+    }
+
+    /**
+     * @brief Returns the entry with the largest key that is less than or equal to the given key, if there is one
+     */
+    std::optional<std::pair<KeyType, index_t>> find_lower_or_equal(const KeyType& key) const
+    {
+        size_t block_index = find_block(key);
+        if (block_index == blocks_.size()) {
+            // All keys are smaller, the predecessor is the largest key
+            if (blocks_.empty()) {
+                return std::nullopt;
+            }
+            const Block& last = blocks_.back();
+            return std::make_pair(last.keys.back(), last.indices.back());
+        }
+        const Block& block = blocks_[block_index];
+        auto it = std::upper_bound(block.keys.begin(), block.keys.end(), key);
+        if (it == block.keys.begin()) {
+            // The predecessor, if any, is the largest key of the previous block
+            if (block_index == 0) {
+                return std::nullopt;
+            }
+            const Block& previous = blocks_[block_index - 1];
+            return std::make_pair(previous.keys.back(), previous.indices.back());
+        }
+        auto position = static_cast<size_t>(it - block.keys.begin()) - 1;
+        return std::make_pair(block.keys[position], block.indices[position]);
+    }
+
+    /**
+     * @brief Calls func(key, index) for every entry in ascending key order
+     */
+    template <typename Func> void for_each(Func&& func) const
+    {
+        for (const Block& block : blocks_) {
+            for (size_t i = 0; i < block.keys.size(); ++i) {
+                func(block.keys[i], block.indices[i]);
+            }
+        }
+    }
+
+  private:
+    struct Block {
+        std::vector<KeyType> keys;
+        std::vector<index_t> indices;
+    };
+
+    std::vector<Block> blocks_;
+    // The largest key of each block
+    std::vector<KeyType> fences_;
+    size_t size_ = 0;
+
+    size_t find_block(const KeyType& key) const
+    {
+        return static_cast<size_t>(std::lower_bound(fences_.begin(), fences_.end(), key) - fences_.begin());
+    }
+
+    void split_block(size_t block_index)
+    {
+        Block& block = blocks_[block_index];
+        const auto half = static_cast<std::ptrdiff_t>(block.keys.size() / 2);
+        Block upper;
+        upper.keys.assign(block.keys.begin() + half, block.keys.end());
+        upper.indices.assign(block.indices.begin() + half, block.indices.end());
+        block.keys.resize(static_cast<size_t>(half));
+        block.indices.resize(static_cast<size_t>(half));
+        fences_[block_index] = block.keys.back();
+        fences_.insert(fences_.begin() + static_cast<std::ptrdiff_t>(block_index) + 1, upper.keys.back());
+        blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(block_index) + 1, std::move(upper));
+    }
+
+    static void append_unique(std::vector<std::pair<KeyType, index_t>>& merged,
+                              const std::pair<KeyType, index_t>& entry)
+    {
+        if (merged.empty() || merged.back().first != entry.first) {
+            merged.push_back(entry);
+        }
+    }
+
+    // Rebuild the blocks from sorted, unique entries. Blocks are left half full to leave room for later inserts.
+    void build(const std::vector<std::pair<KeyType, index_t>>& entries)
+    {
+        clear();
+        constexpr size_t fill = MAX_BLOCK_SIZE / 2;
+        blocks_.reserve((entries.size() + fill - 1) / fill);
+        fences_.reserve(blocks_.capacity());
+        for (size_t start = 0; start < entries.size(); start += fill) {
+            size_t end = std::min(start + fill, entries.size());
+            Block block;
+            block.keys.reserve(MAX_BLOCK_SIZE + 1);
+            block.indices.reserve(MAX_BLOCK_SIZE + 1);
+            for (size_t i = start; i < end; ++i) {
+                block.keys.push_back(entries[i].first);
+                block.indices.push_back(entries[i].second);
+            }
+            fences_.push_back(block.keys.back());
+            blocks_.push_back(std::move(block));
+        }
+        size_ = entries.size();
+    }
+};
+} // namespace bb::crypto::merkle_tree
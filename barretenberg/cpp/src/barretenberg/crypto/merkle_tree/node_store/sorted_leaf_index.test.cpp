@@ -0,0 +1,90 @@
+#include "sorted_leaf_index.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+// Small keys so that lookups hit both present and absent keys
+uint256_t random_key()
+{
+    return uint256_t(engine.get_random_uint64() % 100000);
+}
+
+void expect_matches(const SortedLeafIndex& index, const std::map<uint256_t, index_t>& expected)
+{
+    EXPECT_EQ(index.size(), expected.size());
+    auto it = expected.begin();
+    index.for_each([&](const uint256_t& key, const index_t& value) {
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(key, it->first);
+        EXPECT_EQ(value, it->second);
+        ++it;
+    });
+    EXPECT_EQ(it, expected.end());
+
+    for (size_t i = 0; i < 1000; ++i) {
+        uint256_t key = random_key();
+        auto found = index.find(key);
+        auto expected_it = expected.find(key);
+        EXPECT_EQ(found.has_value(), expected_it != expected.end());
+        if (found.has_value()) {
+            EXPECT_EQ(found.value(), expected_it->second);
+        }
+
+        // The largest entry <= key
+        auto low = index.find_lower_or_equal(key);
+        auto upper = expected.upper_bound(key);
+        EXPECT_EQ(low.has_value(), upper != expected.begin());
+        if (low.has_value()) {
+            --upper;
+            EXPECT_EQ(low->first, upper->first);
+            EXPECT_EQ(low->second, upper->second);
+        }
+    }
+}
+} // namespace
+
+TEST(SortedLeafIndex, EmptyIndex)
+{
+    SortedLeafIndex index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_FALSE(index.find(5).has_value());
+    EXPECT_FALSE(index.find_lower_or_equal(5).has_value());
+}
+
+TEST(SortedLeafIndex, InsertMatchesMap)
+{
+    SortedLeafIndex index;
+    std::map<uint256_t, index_t> expected;
+    for (index_t i = 0; i < 10000; ++i) {
+        uint256_t key = random_key();
+        EXPECT_EQ(index.insert(key, i), expected.insert({ key, i }).second);
+    }
+    expect_matches(index, expected);
+}
+
+TEST(SortedLeafIndex, BatchInsertMatchesMap)
+{
+    SortedLeafIndex index;
+    std::map<uint256_t, index_t> expected;
+    index_t next_index = 0;
+    // Alternate between batches that are merged and batches that are small enough to be inserted individually
+    for (size_t batch_size : std::vector<size_t>{ 4000, 10, 3000, 1, 500 }) {
+        std::vector<std::pair<uint256_t, index_t>> batch;
+        for (size_t i = 0; i < batch_size; ++i) {
+            uint256_t key = random_key();
+            batch.emplace_back(key, next_index++);
+            expected.insert({ key, batch.back().second });
+        }
+        index.insert(batch);
+        expect_matches(index, expected);
+    }
+    index.clear();
+    EXPECT_TRUE(index.empty());
+}
@@ -98,6 +98,63 @@ struct DBStats {
     }
 };
 
+struct CacheStats {
+    std::string name;
+    uint64_t capacity = 0;
+    uint64_t numItems = 0;
+    uint64_t totalUsedSize = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    CacheStats() = default;
+    CacheStats(const CacheStats& other) = default;
+    CacheStats(CacheStats&& other) noexcept { *this = std::move(other); }
+    ~CacheStats() = default;
+    CacheStats(std::string name,
+               uint64_t capacity,
+               uint64_t numItems,
+               uint64_t totalUsedSize,
+               uint64_t hits,
+               uint64_t misses)
+        : name(std::move(name))
+        , capacity(capacity)
+        , numItems(numItems)
+        , totalUsedSize(totalUsedSize)
+        , hits(hits)
+        , misses(misses)
+    {}
+
+    MSGPACK_FIELDS(name, capacity, numItems, totalUsedSize, hits, misses)
+
+    bool operator==(const CacheStats& other) const
+    {
+        return name == other.name && capacity == other.capacity && numItems == other.numItems &&
+               totalUsedSize == other.totalUsedSize && hits == other.hits && misses == other.misses;
+    }
+
+    CacheStats& operator=(const CacheStats& other) = default;
+
+    CacheStats& operator=(CacheStats&& other) noexcept
+    {
+        if (this != &other) {
+            name = std::move(other.name);
+            capacity = other.capacity;
+            numItems = other.numItems;
+            totalUsedSize = other.totalUsedSize;
+            hits = other.hits;
+            misses = other.misses;
+        }
+        return *this;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const CacheStats& stats)
+    {
+        os << "Cache " << stats.name << ", capacity: " << stats.capacity << ", num items: " << stats.numItems
+           << ", total used size: " << stats.totalUsedSize << ", hits: " << stats.hits << ", misses: " << stats.misses;
+        return os;
+    }
+};
+
 struct TreeDBStats {
     uint64_t mapSize;
     DBStats blocksDBStats;
@@ -105,6 +162,8 @@ struct TreeDBStats {
     DBStats leafPreimagesDBStats;
     DBStats leafIndicesDBStats;
     DBStats blockIndicesDBStats;
+    CacheStats nodesCacheStats;
+    CacheStats leafPreimagesCacheStats;
 
     TreeDBStats() = default;
     TreeDBStats(uint64_t mapSize)
@@ -128,13 +187,21 @@ struct TreeDBStats {
 
     ~TreeDBStats() = default;
 
-    MSGPACK_FIELDS(mapSize, blocksDBStats, nodesDBStats, leafPreimagesDBStats, leafIndicesDBStats, blockIndicesDBStats)
+    MSGPACK_FIELDS(mapSize,
+                   blocksDBStats,
+                   nodesDBStats,
+                   leafPreimagesDBStats,
+                   leafIndicesDBStats,
+                   blockIndicesDBStats,
+                   nodesCacheStats,
+                   leafPreimagesCacheStats)
 
     bool operator==(const TreeDBStats& other) const
     {
         return mapSize == other.mapSize && blocksDBStats == other.blocksDBStats && nodesDBStats == other.nodesDBStats &&
                leafPreimagesDBStats == other.leafPreimagesDBStats && leafIndicesDBStats == other.leafIndicesDBStats &&
-               blockIndicesDBStats == other.blockIndicesDBStats;
+               blockIndicesDBStats == other.blockIndicesDBStats && nodesCacheStats == other.nodesCacheStats &&
+               leafPreimagesCacheStats == other.leafPreimagesCacheStats;
     }
 
     TreeDBStats& operator=(TreeDBStats&& other) noexcept
@@ -146,6 +213,8 @@ struct TreeDBStats {
             leafPreimagesDBStats = std::move(other.leafPreimagesDBStats);
             leafIndicesDBStats = std::move(other.leafIndicesDBStats);
             blockIndicesDBStats = std::move(other.blockIndicesDBStats);
+            nodesCacheStats = std::move(other.nodesCacheStats);
+            leafPreimagesCacheStats = std::move(other.leafPreimagesCacheStats);
         }
         return *this;
     }
@@ -156,7 +225,8 @@ struct TreeDBStats {
     {
         os << "Map Size: " << stats.mapSize << " Blocks DB " << stats.blocksDBStats << ", Nodes DB "
            << stats.nodesDBStats << ", Leaf Pre-images DB " << stats.leafPreimagesDBStats << ", Leaf Indices DB "
-           << stats.leafIndicesDBStats << ", Block Indices DB " << stats.blockIndicesDBStats;
+           << stats.leafIndicesDBStats << ", Block Indices DB " << stats.blockIndicesDBStats << ", Nodes "
+           << stats.nodesCacheStats << ", Leaf Pre-images " << stats.leafPreimagesCacheStats;
         return os;
     }
 };
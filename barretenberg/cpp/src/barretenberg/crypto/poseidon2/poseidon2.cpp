@@ -1,5 +1,7 @@
 #include "poseidon2.hpp"
 
+#include <algorithm>
+
 namespace bb::crypto {
 /**
  * @brief Hashes a vector of field elements
@@ -10,6 +12,38 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_fixed_length(input);
 }
 
+/**
+ * @brief Hashes pairs of field elements: out[i] = hash({ left[i], right[i] })
+ * @details A fixed-length sponge hash of two elements is a single permutation of { left, right, 0, iv } where
+ * iv = 2 << 64 encodes the input length, and the output is element 0 of the permuted state. We build those states
+ * HASH_PAIRS_LANES at a time and permute them together. The final partial batch is padded with zero lanes.
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const FF> left, std::span<const FF> right, std::span<FF> out)
+{
+    static_assert(Params::t == 4);
+    ASSERT(left.size() == right.size() && out.size() >= left.size());
+    constexpr size_t LANES = HASH_PAIRS_LANES;
+    const FF iv = FF(static_cast<uint256_t>(2) << 64);
+    const size_t num_pairs = left.size();
+
+    typename Permutation::template BatchState<LANES> state;
+    for (size_t start = 0; start < num_pairs; start += LANES) {
+        const size_t num_lanes = std::min(LANES, num_pairs - start);
+        for (size_t j = 0; j < LANES; ++j) {
+            const bool active = j < num_lanes;
+            state[0][j] = active ? left[start + j] : FF::zero();
+            state[1][j] = active ? right[start + j] : FF::zero();
+            state[2][j] = FF::zero();
+            state[3][j] = iv;
+        }
+        Permutation::template permutation_batch<LANES>(state);
+        for (size_t j = 0; j < num_lanes; ++j) {
+            out[start + j] = state[0][j];
+        }
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
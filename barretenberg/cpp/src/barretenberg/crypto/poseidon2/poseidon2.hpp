@@ -4,6 +4,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -12,11 +14,21 @@ template <typename Params> class Poseidon2 {
 
     // We choose our rate to be t-1 and capacity to be 1.
     using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Permutation = Poseidon2Permutation<Params>;
+
+    // number of permutations hash_pairs interleaves
+    static constexpr size_t HASH_PAIRS_LANES = 8;
 
     /**
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes pairs of field elements: out[i] = hash({ left[i], right[i] })
+     * @details Runs HASH_PAIRS_LANES permutations interleaved at a time (see Poseidon2Permutation::permutation_batch)
+     * and does not allocate. `out` may be the same span as `left` or `right`.
+     */
+    static void hash_pairs(std::span<const FF> left, std::span<const FF> right, std::span<FF> out);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,23 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    // not a multiple of the lane count, so the padded final batch is exercised
+    const size_t num_pairs = 2 * crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::HASH_PAIRS_LANES + 3;
+    std::vector<fr> left(num_pairs);
+    std::vector<fr> right(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        left[i] = fr::random_element(&engine);
+        right[i] = fr::random_element(&engine);
+    }
+
+    std::vector<fr> result(num_pairs);
+    crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(left, right, result);
+
+    for (size_t i = 0; i < num_pairs; ++i) {
+        std::vector<fr> input{ left[i], right[i] };
+        EXPECT_EQ(result[i], crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(input));
+    }
+}
@@ -39,6 +39,8 @@ template <typename Params> class Poseidon2Permutation {
     using RoundConstants = std::array<FF, t>;
     using MatrixDiagonal = std::array<FF, t>;
     using RoundConstantsContainer = std::array<RoundConstants, NUM_ROUNDS>;
+    // structure-of-arrays state of NUM_LANES independent permutations: element i of lane j lives at state[i][j]
+    template <size_t NUM_LANES> using BatchState = std::array<std::array<FF, NUM_LANES>, t>;
 
     static constexpr MatrixDiagonal internal_matrix_diagonal = Params::internal_matrix_diagonal;
     static constexpr RoundConstantsContainer round_constants = Params::round_constants;
@@ -160,5 +162,103 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    template <size_t NUM_LANES> static constexpr void matrix_multiplication_external_batch(BatchState<NUM_LANES>& input)
+    {
+        static_assert(t == 4);
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            auto t0 = input[0][j] + input[1][j]; // A + B
+            auto t1 = input[2][j] + input[3][j]; // C + D
+            auto t2 = input[1][j] + input[1][j]; // 2B
+            t2 += t1;                            // 2B + C + D
+            auto t3 = input[3][j] + input[3][j]; // 2D
+            t3 += t0;                            // 2D + A + B
+            auto t4 = t1 + t1;
+            t4 += t4;
+            t4 += t3; // A + B + 4C + 6D
+            auto t5 = t0 + t0;
+            t5 += t5;
+            t5 += t2;          // 4A + 6B + C + D
+            auto t6 = t3 + t5; // 5A + 7B + C + 3D
+            auto t7 = t2 + t4; // A + 3B + 5C + 7D
+            input[0][j] = t6;
+            input[1][j] = t5;
+            input[2][j] = t7;
+            input[3][j] = t4;
+        }
+    }
+
+    template <size_t NUM_LANES> static constexpr void matrix_multiplication_internal_batch(BatchState<NUM_LANES>& input)
+    {
+        std::array<FF, NUM_LANES> sum = input[0];
+        for (size_t i = 1; i < t; ++i) {
+            for (size_t j = 0; j < NUM_LANES; ++j) {
+                sum[j] += input[i][j];
+            }
+        }
+        for (size_t i = 0; i < t; ++i) {
+            for (size_t j = 0; j < NUM_LANES; ++j) {
+                input[i][j] *= internal_matrix_diagonal[i];
+                input[i][j] += sum[j];
+            }
+        }
+    }
+
+    template <size_t NUM_LANES> static constexpr void apply_single_sbox_batch(std::array<FF, NUM_LANES>& input)
+    {
+        // each pass issues NUM_LANES independent multiplications, so their latencies overlap
+        std::array<FF, NUM_LANES> xxxx;
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            xxxx[j] = input[j].sqr();
+        }
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            xxxx[j].self_sqr();
+        }
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            input[j] *= xxxx[j];
+        }
+    }
+
+    /**
+     * @brief Applies the permutation to NUM_LANES independent states at once.
+     * @details Produces exactly the same output as calling permutation() on every lane. The states are stored
+     * structure-of-arrays and every step of the round function is applied across all lanes before moving on to the
+     * next, so the Montgomery multiplications of different lanes form independent instruction streams instead of one
+     * long dependency chain per state. Used for hashing whole levels of a Merkle tree.
+     *
+     * @param state in/out: the lanes to permute
+     */
+    template <size_t NUM_LANES> static constexpr void permutation_batch(BatchState<NUM_LANES>& state)
+    {
+        matrix_multiplication_external_batch<NUM_LANES>(state);
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        const auto full_round = [&](const RoundConstants& rc) {
+            for (size_t i = 0; i < t; ++i) {
+                for (size_t j = 0; j < NUM_LANES; ++j) {
+                    state[i][j] += rc[i];
+                }
+                apply_single_sbox_batch<NUM_LANES>(state[i]);
+            }
+            matrix_multiplication_external_batch<NUM_LANES>(state);
+        };
+
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            full_round(round_constants[i]);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (size_t j = 0; j < NUM_LANES; ++j) {
+                state[0][j] += round_constants[i][0];
+            }
+            apply_single_sbox_batch<NUM_LANES>(state[0]);
+            matrix_multiplication_internal_batch<NUM_LANES>(state);
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            full_round(round_constants[i]);
+        }
+    }
 };
 } // namespace bb::crypto
@@ -59,3 +59,27 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, BatchMatchesScalar)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t NUM_LANES = 4;
+
+    std::array<std::array<fr, 4>, NUM_LANES> inputs;
+    Permutation::BatchState<NUM_LANES> batch;
+    for (size_t j = 0; j < NUM_LANES; ++j) {
+        for (size_t i = 0; i < 4; ++i) {
+            inputs[j][i] = fr::random_element(&engine);
+            batch[i][j] = inputs[j][i];
+        }
+    }
+
+    Permutation::permutation_batch<NUM_LANES>(batch);
+
+    for (size_t j = 0; j < NUM_LANES; ++j) {
+        auto expected = Permutation::permutation(inputs[j]);
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_EQ(batch[i][j], expected[i]);
+        }
+    }
+}
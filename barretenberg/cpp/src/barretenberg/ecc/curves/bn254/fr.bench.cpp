@@ -1,4 +1,5 @@
 #include "fr.hpp"
+#include "barretenberg/ecc/fields/field_vec.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -436,5 +437,116 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+// Batch kernels over BATCH_SIZE elements, which fit in L2/L3, the argument selects the scalar loop (0) or the vector
+// backend of field_vec (1)
+/*
+AVX-512 IFMA, single thread
+----------------------------------------------------------------------------------------------------
+Benchmark                             Time            CPU   Iterations UserCounters...
+----------------------------------------------------------------------------------------------------
+batch_mul_bench/0               1908465 ns      1860672 ns          356 items_per_second=35.2217M/s
+batch_mul_bench/1                600413 ns       572395 ns         1256 items_per_second=114.494M/s
+batch_sqr_bench/0               1799855 ns      1775322 ns          380 items_per_second=36.915M/s
+batch_sqr_bench/1                566793 ns       561793 ns         1260 items_per_second=116.655M/s
+batch_add_bench/0                859628 ns       846015 ns          955 items_per_second=77.4644M/s
+batch_add_bench/1                306684 ns       303477 ns         2143 items_per_second=215.951M/s
+batch_from_montgomery_bench/0   2125026 ns      2090550 ns          331 items_per_second=31.3487M/s
+batch_from_montgomery_bench/1    514843 ns       508164 ns         1370 items_per_second=128.966M/s
+batch_fold_pairs_bench/0        2644198 ns      2611594 ns          269 items_per_second=25.0943M/s
+batch_fold_pairs_bench/1         784140 ns       773533 ns          928 items_per_second=84.723M/s
+*/
+constexpr size_t BATCH_SIZE = 1 << 16;
+
+template <typename ScalarKernel, typename VectorKernel>
+void batch_bench(State& state, ScalarKernel&& scalar_kernel, VectorKernel&& vector_kernel) noexcept
+{
+    std::span<const fr> a(oldx.data(), BATCH_SIZE);
+    std::span<const fr> b(oldy.data(), BATCH_SIZE);
+    std::vector<fr> out(BATCH_SIZE);
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            scalar_kernel(std::span<fr>(out), a, b);
+        } else {
+            vector_kernel(std::span<fr>(out), a, b);
+        }
+        DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(BATCH_SIZE));
+}
+
+void batch_mul_bench(State& state) noexcept
+{
+    batch_bench(
+        state,
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr> b) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = a[i] * b[i];
+            }
+        },
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr> b) {
+            field_vec<Bn254FrParams>::mul(out, a, b);
+        });
+}
+BENCHMARK(batch_mul_bench)->Arg(0)->Arg(1);
+
+void batch_sqr_bench(State& state) noexcept
+{
+    batch_bench(
+        state,
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr>) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = a[i].sqr();
+            }
+        },
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr>) { field_vec<Bn254FrParams>::sqr(out, a); });
+}
+BENCHMARK(batch_sqr_bench)->Arg(0)->Arg(1);
+
+void batch_add_bench(State& state) noexcept
+{
+    batch_bench(
+        state,
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr> b) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = a[i] + b[i];
+            }
+        },
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr> b) {
+            field_vec<Bn254FrParams>::add(out, a, b);
+        });
+}
+BENCHMARK(batch_add_bench)->Arg(0)->Arg(1);
+
+void batch_from_montgomery_bench(State& state) noexcept
+{
+    batch_bench(
+        state,
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr>) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = a[i].from_montgomery_form();
+            }
+        },
+        [](std::span<fr> out, std::span<const fr> a, std::span<const fr>) {
+            field_vec<Bn254FrParams>::from_montgomery(out, a);
+        });
+}
+BENCHMARK(batch_from_montgomery_bench)->Arg(0)->Arg(1);
+
+void batch_fold_pairs_bench(State& state) noexcept
+{
+    // Folds the 2 * BATCH_SIZE elements of oldx into BATCH_SIZE elements, as in a sumcheck round
+    batch_bench(
+        state,
+        [](std::span<fr> out, std::span<const fr>, std::span<const fr>) {
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = oldx[2 * i] + accz * (oldx[2 * i + 1] - oldx[2 * i]);
+            }
+        },
+        [](std::span<fr> out, std::span<const fr>, std::span<const fr>) {
+            field_vec<Bn254FrParams>::fold_pairs(out, std::span<const fr>(oldx.data(), 2 * BATCH_SIZE), accz);
+        });
+}
+BENCHMARK(batch_fold_pairs_bench)->Arg(0)->Arg(1);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
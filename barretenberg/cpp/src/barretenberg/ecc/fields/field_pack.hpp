@@ -0,0 +1,318 @@
+#pragma once
+
+#include "./field_vec.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace bb {
+
+/**
+ * @brief A pack of NUM_LANES field elements, on which the field operations act lane by lane.
+ *
+ * @details A pack lets code written for a single field element, e.g. the relations evaluated on Univariate<field_pack,
+ * N>, evaluate NUM_LANES independent instances at once. The pack is stored as a structure of arrays: with the IFMA
+ * backend of field_vec, it holds its elements in radix 2^52, limb i of all lanes being contiguous, so that an
+ * operation loads each limb of the lanes in one register and runs the vector kernels of field_vec on them. The
+ * elements are kept fully reduced. On other CPUs, it holds the elements themselves and operates on them one by one.
+ *
+ * A field element or an integer converts implicitly to the pack holding it in every lane.
+ */
+template <typename Params> class field_pack {
+  public:
+    using field = bb::field<Params>;
+
+    static constexpr size_t NUM_LANES = field_vec<Params>::NUM_LANES;
+
+    field_pack() noexcept = default;
+    field_pack(const field& value) noexcept; // NOLINT(google-explicit-constructor)
+    template <typename T>
+        requires std::is_integral_v<T>
+    field_pack(const T value) noexcept // NOLINT(google-explicit-constructor)
+        : field_pack(field(value))
+    {}
+
+    static field_pack zero() noexcept { return field_pack(field::zero()); }
+
+    static field_pack load(std::span<const field, NUM_LANES> elements) noexcept;
+    void store(std::span<field, NUM_LANES> elements) const noexcept;
+    // Sum of the lanes
+    field sum() const noexcept;
+
+    field_pack operator+(const field_pack& other) const noexcept
+    {
+        field_pack r;
+        add(r, *this, other);
+        return r;
+    }
+    field_pack operator-(const field_pack& other) const noexcept
+    {
+        field_pack r;
+        sub(r, *this, other);
+        return r;
+    }
+    field_pack operator-() const noexcept
+    {
+        field_pack r;
+        neg(r, *this);
+        return r;
+    }
+    field_pack operator*(const field_pack& other) const noexcept
+    {
+        field_pack r;
+        mul(r, *this, other);
+        return r;
+    }
+    field_pack sqr() const noexcept { return *this * *this; }
+
+    field_pack& operator+=(const field_pack& other) noexcept
+    {
+        add(*this, *this, other);
+        return *this;
+    }
+    field_pack& operator-=(const field_pack& other) noexcept
+    {
+        sub(*this, *this, other);
+        return *this;
+    }
+    field_pack& operator*=(const field_pack& other) noexcept
+    {
+        mul(*this, *this, other);
+        return *this;
+    }
+    void self_sqr() noexcept { mul(*this, *this, *this); }
+
+    // Whether all lanes are zero
+    bool is_zero() const noexcept;
+
+  private:
+    // The elements of the lanes, or with the IFMA backend, their 5 radix 2^52 limbs which take the room of 10
+    // elements and are only accessed by (aliasing) vector loads and stores
+    alignas(64) std::array<field, 5 * NUM_LANES * sizeof(uint64_t) / sizeof(field)> data;
+
+    field* elements() noexcept { return data.data(); }
+    const field* elements() const noexcept { return data.data(); }
+
+    // r = a op b lane by lane, r may be a or b
+    static void add(field_pack& r, const field_pack& a, const field_pack& b) noexcept;
+    static void sub(field_pack& r, const field_pack& a, const field_pack& b) noexcept;
+    static void neg(field_pack& r, const field_pack& a) noexcept;
+    static void mul(field_pack& r, const field_pack& a, const field_pack& b) noexcept;
+
+#if BB_FIELD_VEC_IFMA
+    using vec = field_vec<Params>;
+    using lanes = typename vec::lanes;
+
+    BB_IFMA_TARGET static lanes unpack(const field_pack& a)
+    {
+        lanes r;
+        for (size_t i = 0; i < vec::NUM_LIMBS; ++i) {
+            r.limb[i] = _mm512_load_si512(reinterpret_cast<const uint64_t*>(a.data.data()) + (NUM_LANES * i));
+        }
+        return r;
+    }
+
+    BB_IFMA_TARGET static void pack(field_pack& r, const lanes& a)
+    {
+        for (size_t i = 0; i < vec::NUM_LIMBS; ++i) {
+            _mm512_store_si512(reinterpret_cast<uint64_t*>(r.data.data()) + (NUM_LANES * i), a.limb[i]);
+        }
+    }
+
+    BB_IFMA_TARGET static void ifma_broadcast(field_pack& r, const field& value)
+    {
+        pack(r, vec::broadcast(value.reduce_once()));
+    }
+
+    BB_IFMA_TARGET static void ifma_load(field_pack& r, const field* in)
+    {
+        lanes a = vec::load(in);
+        vec::reduce(a, vec::MODULUS);
+        pack(r, a);
+    }
+
+    BB_IFMA_TARGET static void ifma_store(field* out, const field_pack& a) { vec::store(out, unpack(a)); }
+
+    // a + b < 2p
+    BB_IFMA_TARGET static void ifma_add(field_pack& r, const field_pack& a, const field_pack& b)
+    {
+        lanes x = unpack(a);
+        const lanes y = unpack(b);
+        for (size_t i = 0; i < vec::NUM_LIMBS; ++i) {
+            x.limb[i] = _mm512_add_epi64(x.limb[i], y.limb[i]);
+        }
+        vec::normalize(x);
+        vec::reduce(x, vec::MODULUS);
+        pack(r, x);
+    }
+
+    // a - b + p < 2p
+    BB_IFMA_TARGET static void ifma_sub(field_pack& r, const field_pack& a, const field_pack& b)
+    {
+        lanes x = unpack(a);
+        const lanes y = unpack(b);
+        for (size_t i = 0; i < vec::NUM_LIMBS; ++i) {
+            x.limb[i] = _mm512_sub_epi64(_mm512_add_epi64(x.limb[i], vec::set1(vec::MODULUS[i])), y.limb[i]);
+        }
+        vec::normalize(x);
+        vec::reduce(x, vec::MODULUS);
+        pack(r, x);
+    }
+
+    // p - a is p for a = 0
+    BB_IFMA_TARGET static void ifma_neg(field_pack& r, const field_pack& a)
+    {
+        lanes x = unpack(a);
+        for (size_t i = 0; i < vec::NUM_LIMBS; ++i) {
+            x.limb[i] = _mm512_sub_epi64(vec::set1(vec::MODULUS[i]), x.limb[i]);
+        }
+        vec::normalize(x);
+        vec::reduce(x, vec::MODULUS);
+        pack(r, x);
+    }
+
+    BB_IFMA_TARGET static void ifma_mul(field_pack& r, const field_pack& a, const field_pack& b)
+    {
+        lanes x = vec::montgomery_mul(unpack(a), unpack(b));
+        vec::reduce(x, vec::MODULUS);
+        pack(r, x);
+    }
+
+    BB_IFMA_TARGET static bool ifma_is_zero(const field_pack& a)
+    {
+        const lanes x = unpack(a);
+        __m512i any = x.limb[0];
+        for (size_t i = 1; i < vec::NUM_LIMBS; ++i) {
+            any = _mm512_or_si512(any, x.limb[i]);
+        }
+        return _mm512_test_epi64_mask(any, any) == 0;
+    }
+#endif
+};
+
+template <typename Params> field_pack<Params>::field_pack(const field& value) noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_broadcast(*this, value);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        elements()[i] = value;
+    }
+}
+
+template <typename Params>
+field_pack<Params> field_pack<Params>::load(std::span<const field, NUM_LANES> elements) noexcept
+{
+    field_pack r;
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_load(r, elements.data());
+        return r;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        r.elements()[i] = elements[i];
+    }
+    return r;
+}
+
+template <typename Params> void field_pack<Params>::store(std::span<field, NUM_LANES> elements) const noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_store(elements.data(), *this);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        elements[i] = this->elements()[i];
+    }
+}
+
+template <typename Params> typename field_pack<Params>::field field_pack<Params>::sum() const noexcept
+{
+    std::array<field, NUM_LANES> lane_values;
+    store(lane_values);
+    field result = field::zero();
+    for (const field& value : lane_values) {
+        result += value;
+    }
+    return result;
+}
+
+template <typename Params>
+void field_pack<Params>::add(field_pack& r, const field_pack& a, const field_pack& b) noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_add(r, a, b);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        r.elements()[i] = a.elements()[i] + b.elements()[i];
+    }
+}
+
+template <typename Params>
+void field_pack<Params>::sub(field_pack& r, const field_pack& a, const field_pack& b) noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_sub(r, a, b);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        r.elements()[i] = a.elements()[i] - b.elements()[i];
+    }
+}
+
+template <typename Params> void field_pack<Params>::neg(field_pack& r, const field_pack& a) noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_neg(r, a);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        r.elements()[i] = -a.elements()[i];
+    }
+}
+
+template <typename Params>
+void field_pack<Params>::mul(field_pack& r, const field_pack& a, const field_pack& b) noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        ifma_mul(r, a, b);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        r.elements()[i] = a.elements()[i] * b.elements()[i];
+    }
+}
+
+template <typename Params> bool field_pack<Params>::is_zero() const noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if (field_vec<Params>::has_ifma()) {
+        return ifma_is_zero(*this);
+    }
+#endif
+    for (size_t i = 0; i < NUM_LANES; ++i) {
+        if (!elements()[i].is_zero()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace bb
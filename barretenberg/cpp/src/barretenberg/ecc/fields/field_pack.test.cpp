@@ -0,0 +1,98 @@
+#include "field_pack.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+
+template <typename Field> class FieldPackTest : public ::testing::Test {
+  public:
+    using field_pack = bb::field_pack<typename Field::Params>;
+    using Lanes = std::array<Field, field_pack::NUM_LANES>;
+
+    // Random lanes, with a zero and an element in the coarse form [p, 2p) which the field arithmetic may produce
+    static Lanes random_lanes()
+    {
+        Lanes lanes;
+        for (auto& lane : lanes) {
+            lane = Field::random_element().reduce_once();
+        }
+        lanes[1] = Field::zero();
+        if (Field::modulus.get_msb() < 254) {
+            const uint256_t coarse =
+                uint256_t(lanes[2].data[0], lanes[2].data[1], lanes[2].data[2], lanes[2].data[3]) + Field::modulus;
+            for (size_t j = 0; j < 4; ++j) {
+                lanes[2].data[j] = coarse.data[j];
+            }
+        }
+        return lanes;
+    }
+
+    static Lanes lanes_of(const field_pack& pack)
+    {
+        Lanes lanes;
+        pack.store(lanes);
+        return lanes;
+    }
+};
+
+using FieldTypes = ::testing::Types<bb::fr, bb::fq, secp256k1::fq>;
+
+} // namespace
+
+TYPED_TEST_SUITE(FieldPackTest, FieldTypes);
+
+TYPED_TEST(FieldPackTest, LaneWiseArithmetic)
+{
+    using Field = TypeParam;
+    using field_pack = typename TestFixture::field_pack;
+    for (size_t trial = 0; trial < 16; ++trial) {
+        const auto a = this->random_lanes();
+        const auto b = this->random_lanes();
+        const Field c = Field::random_element();
+        const field_pack a_pack = field_pack::load(a);
+        const field_pack b_pack = field_pack::load(b);
+
+        const auto sums = this->lanes_of(a_pack + b_pack);
+        const auto differences = this->lanes_of(a_pack - b_pack);
+        const auto negations = this->lanes_of(-a_pack);
+        const auto products = this->lanes_of(a_pack * b_pack);
+        const auto squares = this->lanes_of(a_pack.sqr());
+        const auto scalar_products = this->lanes_of(a_pack * c);
+        const auto shifted = this->lanes_of(a_pack - 3);
+        for (size_t i = 0; i < field_pack::NUM_LANES; ++i) {
+            EXPECT_EQ(sums[i], a[i] + b[i]);
+            EXPECT_EQ(differences[i], a[i] - b[i]);
+            EXPECT_EQ(negations[i], -a[i]);
+            EXPECT_EQ(products[i], a[i] * b[i]);
+            EXPECT_EQ(squares[i], a[i].sqr());
+            EXPECT_EQ(scalar_products[i], a[i] * c);
+            EXPECT_EQ(shifted[i], a[i] - Field(3));
+        }
+
+        Field sum = Field::zero();
+        for (const Field& lane : a) {
+            sum += lane;
+        }
+        EXPECT_EQ(a_pack.sum(), sum);
+    }
+}
+
+TYPED_TEST(FieldPackTest, IsZero)
+{
+    using Field = TypeParam;
+    using field_pack = typename TestFixture::field_pack;
+    EXPECT_TRUE(field_pack::zero().is_zero());
+    EXPECT_TRUE((field_pack(Field(5)) - 5).is_zero());
+
+    // A pack is zero only if all its lanes are
+    typename TestFixture::Lanes lanes;
+    lanes.fill(Field::zero());
+    lanes.back() = Field::one();
+    EXPECT_FALSE(field_pack::load(lanes).is_zero());
+}
@@ -0,0 +1,510 @@
+#pragma once
+
+#include "./field.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if (BBERG_NO_ASM == 0) && defined(__x86_64__)
+#include <immintrin.h>
+#define BB_FIELD_VEC_IFMA 1
+// The IFMA kernels are compiled for AVX-512 IFMA whatever the target architecture and only called on CPUs supporting
+// it, see field_vec::has_ifma
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+#else
+#define BB_FIELD_VEC_IFMA 0
+#endif
+
+namespace bb {
+
+template <typename Params> class field_pack;
+
+/**
+ * @brief Batch arithmetic over arrays of field elements with a vector backend.
+ *
+ * @details On CPUs with AVX-512 IFMA, the kernels process NUM_LANES elements at once in a radix 2^52 representation:
+ * an element is split into 5 limbs of 52 bits, and limb i of the NUM_LANES elements is held in one 512-bit register,
+ * so that the 52x52-bit multiply-adds of the Montgomery multiplication (vpmadd52luq/vpmadd52huq) run on all lanes at
+ * once. The Montgomery reduction divides by 2^256 like the scalar one, with 4 reductions of 52 bits and a last one of
+ * 48 bits, so that the vector results are the same field elements as the scalar ones. They are fully reduced.
+ *
+ * The backend is selected at runtime. The scalar arithmetic of field is used on other CPUs, for moduli of 254 bits or
+ * more (the limb bounds of the vector multiplication rely on 4p^2 < 2^256 p), and for the elements at the end of an
+ * array which do not fill a vector. AVX2 has no 64-bit multiplication, so it is not faster than the MULX/ADX scalar
+ * multiplication and has no backend.
+ *
+ * The output of a kernel may be one of its inputs, and the output of fold_pairs may start at or before the start of
+ * its input.
+ */
+template <typename Params> class field_vec {
+  public:
+    using field = bb::field<Params>;
+
+    static constexpr size_t NUM_LANES = 8;
+
+    static bool has_ifma() noexcept;
+
+    // out[i] = a[i] * b[i]
+    static void mul(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept;
+    // out[i] = a[i] * b
+    static void mul(std::span<field> out, std::span<const field> a, const field& b) noexcept;
+    // out[i] = a[i]^2
+    static void sqr(std::span<field> out, std::span<const field> a) noexcept;
+    // out[i] = a[i] + b[i]
+    static void add(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept;
+    // out[i] = a[i] converted out of Montgomery form, see field::from_montgomery_form
+    static void from_montgomery(std::span<field> out, std::span<const field> a) noexcept;
+    // out[i] = pairs[2i] + challenge * (pairs[2i + 1] - pairs[2i]), i.e. the fold of a multilinear table in its first
+    // variable
+    static void fold_pairs(std::span<field> out, std::span<const field> pairs, const field& challenge) noexcept;
+
+  private:
+    // Packs of field elements operate on their lanes with the kernels below
+    friend class field_pack<Params>;
+
+    static constexpr bool VECTORIZABLE = Params::modulus_3 < 0x4000000000000000ULL;
+
+#if BB_FIELD_VEC_IFMA
+    static constexpr size_t NUM_LIMBS = 5;
+    static constexpr uint64_t LIMB_MASK = (uint64_t(1) << 52) - 1;
+
+    static constexpr std::array<uint64_t, NUM_LIMBS> to_radix_52(const uint256_t& x)
+    {
+        return { x.data[0] & LIMB_MASK,
+                 ((x.data[0] >> 52) | (x.data[1] << 12)) & LIMB_MASK,
+                 ((x.data[1] >> 40) | (x.data[2] << 24)) & LIMB_MASK,
+                 ((x.data[2] >> 28) | (x.data[3] << 36)) & LIMB_MASK,
+                 x.data[3] >> 16 };
+    }
+    static constexpr std::array<uint64_t, NUM_LIMBS> MODULUS = to_radix_52(field::modulus);
+    static constexpr std::array<uint64_t, NUM_LIMBS> TWICE_MODULUS = to_radix_52(field::modulus + field::modulus);
+
+    // NUM_LANES field elements in radix 2^52, limb[i] holds the i-th limbs of all lanes
+    struct lanes {
+        __m512i limb[NUM_LIMBS]; // NOLINT
+    };
+
+    // Lane-wise shifts, written with vector extensions because the shift intrinsics of GCC 12 trigger false
+    // maybe-uninitialized warnings
+    using u64x8 = uint64_t __attribute__((vector_size(64)));
+    using i64x8 = int64_t __attribute__((vector_size(64)));
+    BB_IFMA_TARGET static __m512i shl(__m512i x, unsigned n) { return (__m512i)((u64x8)x << n); }
+    BB_IFMA_TARGET static __m512i shr(__m512i x, unsigned n) { return (__m512i)((u64x8)x >> n); }
+    BB_IFMA_TARGET static __m512i sar(__m512i x, unsigned n) { return (__m512i)((i64x8)x >> n); }
+
+    BB_IFMA_TARGET static __m512i set1(uint64_t x) { return _mm512_set1_epi64(static_cast<int64_t>(x)); }
+    BB_IFMA_TARGET static __m512i index(uint64_t i0, uint64_t i1, uint64_t i2, uint64_t i3)
+    {
+        // Lane j gets i_{j / 2} + 8 * (j % 2), i.e. a permutation index pair per pair of lanes
+        return _mm512_setr_epi64(static_cast<int64_t>(i0),
+                                 static_cast<int64_t>(i0 + 8),
+                                 static_cast<int64_t>(i1),
+                                 static_cast<int64_t>(i1 + 8),
+                                 static_cast<int64_t>(i2),
+                                 static_cast<int64_t>(i2 + 8),
+                                 static_cast<int64_t>(i3),
+                                 static_cast<int64_t>(i3 + 8));
+    }
+    BB_IFMA_TARGET static __m512i index(
+        uint64_t i0, uint64_t i1, uint64_t i2, uint64_t i3, uint64_t i4, uint64_t i5, uint64_t i6, uint64_t i7)
+    {
+        return _mm512_setr_epi64(static_cast<int64_t>(i0),
+                                 static_cast<int64_t>(i1),
+                                 static_cast<int64_t>(i2),
+                                 static_cast<int64_t>(i3),
+                                 static_cast<int64_t>(i4),
+                                 static_cast<int64_t>(i5),
+                                 static_cast<int64_t>(i6),
+                                 static_cast<int64_t>(i7));
+    }
+
+    // Splits the 64-bit limbs x[0..3] of the lanes into 52-bit limbs
+    BB_IFMA_TARGET static lanes from_radix_64(const __m512i (&x)[4]) // NOLINT
+    {
+        const __m512i mask = set1(LIMB_MASK);
+        lanes r;
+        r.limb[0] = _mm512_and_si512(x[0], mask);
+        r.limb[1] = _mm512_and_si512(_mm512_or_si512(shr(x[0], 52), shl(x[1], 12)), mask);
+        r.limb[2] = _mm512_and_si512(_mm512_or_si512(shr(x[1], 40), shl(x[2], 24)), mask);
+        r.limb[3] = _mm512_and_si512(_mm512_or_si512(shr(x[2], 28), shl(x[3], 36)), mask);
+        r.limb[4] = shr(x[3], 16);
+        return r;
+    }
+
+    // Joins the 52-bit limbs of the lanes, which must be less than 2^256, into 64-bit limbs x[0..3]
+    BB_IFMA_TARGET static void to_radix_64(const lanes& a, __m512i (&x)[4]) // NOLINT
+    {
+        x[0] = _mm512_or_si512(a.limb[0], shl(a.limb[1], 52));
+        x[1] = _mm512_or_si512(shr(a.limb[1], 12), shl(a.limb[2], 40));
+        x[2] = _mm512_or_si512(shr(a.limb[2], 24), shl(a.limb[3], 28));
+        x[3] = _mm512_or_si512(shr(a.limb[3], 36), shl(a.limb[4], 16));
+    }
+
+    // Loads in[0..NUM_LANES), transposing the 4 registers holding 2 elements each into one register per 64-bit limb
+    BB_IFMA_TARGET static lanes load(const field* in)
+    {
+        const auto* words = reinterpret_cast<const uint64_t*>(in);
+        __m512i x[4]; // NOLINT
+        for (size_t i = 0; i < 4; ++i) {
+            x[i] = _mm512_loadu_si512(words + 8 * i);
+        }
+        // Limbs 0, 1 (resp. 2, 3) of the elements 0..3 (lo) and 4..7 (hi), element by element
+        const __m512i lo_01 = _mm512_permutex2var_epi64(x[0], index(0, 1, 4, 5, 8, 9, 12, 13), x[1]);
+        const __m512i lo_23 = _mm512_permutex2var_epi64(x[0], index(2, 3, 6, 7, 10, 11, 14, 15), x[1]);
+        const __m512i hi_01 = _mm512_permutex2var_epi64(x[2], index(0, 1, 4, 5, 8, 9, 12, 13), x[3]);
+        const __m512i hi_23 = _mm512_permutex2var_epi64(x[2], index(2, 3, 6, 7, 10, 11, 14, 15), x[3]);
+        const __m512i even = index(0, 2, 4, 6, 8, 10, 12, 14);
+        const __m512i odd = index(1, 3, 5, 7, 9, 11, 13, 15);
+        x[0] = _mm512_permutex2var_epi64(lo_01, even, hi_01);
+        x[1] = _mm512_permutex2var_epi64(lo_01, odd, hi_01);
+        x[2] = _mm512_permutex2var_epi64(lo_23, even, hi_23);
+        x[3] = _mm512_permutex2var_epi64(lo_23, odd, hi_23);
+        return from_radix_64(x);
+    }
+
+    // Loads the elements in[0, 2, ..., 2 * NUM_LANES - 2] into even and in[1, 3, ..., 2 * NUM_LANES - 1] into odd
+    BB_IFMA_TARGET static void load_pairs(const field* in, lanes& even, lanes& odd)
+    {
+        const auto* words = reinterpret_cast<const uint64_t*>(in);
+        // Row i holds the 4 limbs of in[2i] followed by the 4 limbs of in[2i + 1], transpose the 8 x 8 matrix
+        __m512i rows[8]; // NOLINT
+        for (size_t i = 0; i < 8; ++i) {
+            rows[i] = _mm512_loadu_si512(words + 8 * i);
+        }
+        // Interleave the columns of pairs of rows, then of pairs of pairs, then of the two halves
+        __m512i pairs[8]; // NOLINT
+        for (size_t i = 0; i < 4; ++i) {
+            pairs[2 * i] = _mm512_permutex2var_epi64(rows[2 * i], index(0, 1, 2, 3), rows[2 * i + 1]);
+            pairs[2 * i + 1] = _mm512_permutex2var_epi64(rows[2 * i], index(4, 5, 6, 7), rows[2 * i + 1]);
+        }
+        // quads[4h + 2k + j] holds the columns 4j + 2k, 4j + 2k + 1 of the rows 4h..4h + 3
+        __m512i quads[8]; // NOLINT
+        const __m512i first = index(0, 1, 8, 9, 2, 3, 10, 11);
+        const __m512i second = index(4, 5, 12, 13, 6, 7, 14, 15);
+        for (size_t h = 0; h < 2; ++h) {
+            for (size_t j = 0; j < 2; ++j) {
+                quads[4 * h + j] = _mm512_permutex2var_epi64(pairs[4 * h + j], first, pairs[4 * h + 2 + j]);
+                quads[4 * h + 2 + j] = _mm512_permutex2var_epi64(pairs[4 * h + j], second, pairs[4 * h + 2 + j]);
+            }
+        }
+        const __m512i low = index(0, 1, 2, 3, 8, 9, 10, 11);
+        const __m512i high = index(4, 5, 6, 7, 12, 13, 14, 15);
+        __m512i columns[8]; // NOLINT
+        for (size_t k = 0; k < 2; ++k) {
+            for (size_t j = 0; j < 2; ++j) {
+                const __m512i top = quads[2 * k + j];
+                const __m512i bottom = quads[4 + 2 * k + j];
+                columns[4 * j + 2 * k] = _mm512_permutex2var_epi64(top, low, bottom);
+                columns[4 * j + 2 * k + 1] = _mm512_permutex2var_epi64(top, high, bottom);
+            }
+        }
+        even = from_radix_64({ columns[0], columns[1], columns[2], columns[3] });
+        odd = from_radix_64({ columns[4], columns[5], columns[6], columns[7] });
+    }
+
+    // Stores the lanes, which must be less than 2^256, into out[0..NUM_LANES), inverting the transposition of load
+    BB_IFMA_TARGET static void store(field* out, const lanes& a)
+    {
+        __m512i x[4]; // NOLINT
+        to_radix_64(a, x);
+        const __m512i lo = index(0, 1, 2, 3);
+        const __m512i hi = index(4, 5, 6, 7);
+        // Limbs 0, 1 (resp. 2, 3) of the elements 0..3 and 4..7
+        const __m512i lo_01 = _mm512_permutex2var_epi64(x[0], lo, x[1]);
+        const __m512i hi_01 = _mm512_permutex2var_epi64(x[0], hi, x[1]);
+        const __m512i lo_23 = _mm512_permutex2var_epi64(x[2], lo, x[3]);
+        const __m512i hi_23 = _mm512_permutex2var_epi64(x[2], hi, x[3]);
+        const __m512i first = index(0, 1, 8, 9, 2, 3, 10, 11);
+        const __m512i second = index(4, 5, 12, 13, 6, 7, 14, 15);
+        auto* words = reinterpret_cast<uint64_t*>(out);
+        _mm512_storeu_si512(words, _mm512_permutex2var_epi64(lo_01, first, lo_23));
+        _mm512_storeu_si512(words + 8, _mm512_permutex2var_epi64(lo_01, second, lo_23));
+        _mm512_storeu_si512(words + 16, _mm512_permutex2var_epi64(hi_01, first, hi_23));
+        _mm512_storeu_si512(words + 24, _mm512_permutex2var_epi64(hi_01, second, hi_23));
+    }
+
+    BB_IFMA_TARGET static lanes broadcast(const field& x)
+    {
+        const auto limbs = to_radix_52(uint256_t(x.data[0], x.data[1], x.data[2], x.data[3]));
+        lanes r;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            r.limb[i] = set1(limbs[i]);
+        }
+        return r;
+    }
+
+    // Propagates the carries of the limbs, which may be negative as long as the lanes are not
+    BB_IFMA_TARGET static void normalize(lanes& a)
+    {
+        const __m512i mask = set1(LIMB_MASK);
+        for (size_t i = 0; i < NUM_LIMBS - 1; ++i) {
+            a.limb[i + 1] = _mm512_add_epi64(a.limb[i + 1], sar(a.limb[i], 52));
+            a.limb[i] = _mm512_and_si512(a.limb[i], mask);
+        }
+    }
+
+    // Subtracts m from the lanes which are at least m, the limbs of a must be normalized
+    BB_IFMA_TARGET static void reduce(lanes& a, const std::array<uint64_t, NUM_LIMBS>& m)
+    {
+        const __m512i mask = set1(LIMB_MASK);
+        lanes d;
+        __m512i borrow = _mm512_setzero_si512();
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const __m512i diff = _mm512_sub_epi64(_mm512_sub_epi64(a.limb[i], set1(m[i])), borrow);
+            borrow = shr(diff, 63);
+            d.limb[i] = _mm512_and_si512(diff, mask);
+        }
+        const __mmask8 no_borrow = _mm512_cmpeq_epi64_mask(borrow, _mm512_setzero_si512());
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            a.limb[i] = _mm512_mask_blend_epi64(no_borrow, a.limb[i], d.limb[i]);
+        }
+    }
+
+    // a * b / 2^256 < 2p for a * b < 2^256 p, the limbs of a and b must be less than 2^52
+    BB_IFMA_TARGET static lanes montgomery_mul(const lanes& a, const lanes& b)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        __m512i t[2 * NUM_LIMBS]; // NOLINT
+        for (auto& column : t) {
+            column = zero;
+        }
+        // Schoolbook product, the low (resp. high) 52 bits of a_i * b_j go to column i + j (resp. i + j + 1). The
+        // columns sum at most 2 * NUM_LIMBS products for each of the product and the reduction, well below 2^64.
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[i + j] = _mm512_madd52lo_epu64(t[i + j], a.limb[i], b.limb[j]);
+                t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a.limb[i], b.limb[j]);
+            }
+        }
+        // Montgomery reduction, the k-th step zeroes the low 52 bits of column k (only 48 bits in the last step, which
+        // totals 256 bits) by adding a multiple of p
+        const __m512i r_inv = set1(Params::r_inv & LIMB_MASK);
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            __m512i m = _mm512_madd52lo_epu64(zero, t[k], r_inv);
+            if (k == NUM_LIMBS - 1) {
+                m = _mm512_and_si512(m, set1(LIMB_MASK >> 4));
+            }
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[k + j] = _mm512_madd52lo_epu64(t[k + j], m, set1(MODULUS[j]));
+                t[k + j + 1] = _mm512_madd52hi_epu64(t[k + j + 1], m, set1(MODULUS[j]));
+            }
+            if (k < NUM_LIMBS - 1) {
+                t[k + 1] = _mm512_add_epi64(t[k + 1], shr(t[k], 52));
+            }
+        }
+        // The result is the columns from NUM_LIMBS - 1 on shifted right by 48 bits
+        const __m512i mask = set1(LIMB_MASK);
+        for (size_t i = NUM_LIMBS - 1; i < 2 * NUM_LIMBS - 1; ++i) {
+            t[i + 1] = _mm512_add_epi64(t[i + 1], shr(t[i], 52));
+            t[i] = _mm512_and_si512(t[i], mask);
+        }
+        lanes r;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            r.limb[i] = _mm512_and_si512(
+                _mm512_or_si512(shr(t[NUM_LIMBS - 1 + i], 48), shl(t[NUM_LIMBS + i], 4)),
+                mask);
+        }
+        return r;
+    }
+
+    // The kernels return the number of elements they processed, a multiple of NUM_LANES
+    BB_IFMA_TARGET static size_t ifma_mul(field* out, const field* a, const field* b, size_t size)
+    {
+        const size_t num_vectors = size / NUM_LANES;
+        for (size_t i = 0; i < num_vectors * NUM_LANES; i += NUM_LANES) {
+            lanes r = montgomery_mul(load(a + i), load(b + i));
+            reduce(r, MODULUS);
+            store(out + i, r);
+        }
+        return num_vectors * NUM_LANES;
+    }
+
+    BB_IFMA_TARGET static size_t ifma_mul(field* out, const field* a, const field& b, size_t size)
+    {
+        const size_t num_vectors = size / NUM_LANES;
+        const lanes b_lanes = broadcast(b);
+        for (size_t i = 0; i < num_vectors * NUM_LANES; i += NUM_LANES) {
+            lanes r = montgomery_mul(load(a + i), b_lanes);
+            reduce(r, MODULUS);
+            store(out + i, r);
+        }
+        return num_vectors * NUM_LANES;
+    }
+
+    BB_IFMA_TARGET static size_t ifma_sqr(field* out, const field* a, size_t size)
+    {
+        const size_t num_vectors = size / NUM_LANES;
+        for (size_t i = 0; i < num_vectors * NUM_LANES; i += NUM_LANES) {
+            const lanes a_lanes = load(a + i);
+            lanes r = montgomery_mul(a_lanes, a_lanes);
+            reduce(r, MODULUS);
+            store(out + i, r);
+        }
+        return num_vectors * NUM_LANES;
+    }
+
+    BB_IFMA_TARGET static size_t ifma_add(field* out, const field* a, const field* b, size_t size)
+    {
+        const size_t num_vectors = size / NUM_LANES;
+        for (size_t i = 0; i < num_vectors * NUM_LANES; i += NUM_LANES) {
+            lanes r = load(a + i);
+            const lanes b_lanes = load(b + i);
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                r.limb[j] = _mm512_add_epi64(r.limb[j], b_lanes.limb[j]);
+            }
+            // a + b < 4p
+            normalize(r);
+            reduce(r, TWICE_MODULUS);
+            reduce(r, MODULUS);
+            store(out + i, r);
+        }
+        return num_vectors * NUM_LANES;
+    }
+
+    BB_IFMA_TARGET static size_t ifma_from_montgomery(field* out, const field* a, size_t size)
+    {
+        const size_t num_vectors = size / NUM_LANES;
+        lanes one;
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            one.limb[j] = set1(j == 0 ? 1U : 0U);
+        }
+        for (size_t i = 0; i < num_vectors * NUM_LANES; i += NUM_LANES) {
+            lanes r = montgomery_mul(load(a + i), one);
+            reduce(r, MODULUS);
+            store(out + i, r);
+        }
+        return num_vectors * NUM_LANES;
+    }
+
+    BB_IFMA_TARGET static size_t ifma_fold_pairs(field* out, const field* pairs, const field& challenge, size_t size)
+    {
+        const size_t num_vectors = size / NUM_LANES;
+        // The challenge is reduced so that (odd - even + 2p) * challenge < 4p^2 < 2^256 p
+        const lanes u = broadcast(challenge.reduce_once());
+        for (size_t i = 0; i < num_vectors * NUM_LANES; i += NUM_LANES) {
+            lanes even;
+            lanes odd;
+            load_pairs(pairs + 2 * i, even, odd);
+            // odd - even + 2p < 4p
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                odd.limb[j] = _mm512_sub_epi64(_mm512_add_epi64(odd.limb[j], set1(TWICE_MODULUS[j])), even.limb[j]);
+            }
+            normalize(odd);
+            lanes r = montgomery_mul(odd, u);
+            // even + (odd - even) * u < 4p
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                r.limb[j] = _mm512_add_epi64(r.limb[j], even.limb[j]);
+            }
+            normalize(r);
+            reduce(r, TWICE_MODULUS);
+            reduce(r, MODULUS);
+            store(out + i, r);
+        }
+        return num_vectors * NUM_LANES;
+    }
+#endif
+};
+
+template <typename Params> bool field_vec<Params>::has_ifma() noexcept
+{
+#if BB_FIELD_VEC_IFMA
+    if constexpr (VECTORIZABLE) {
+        static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+        return supported;
+    }
+#endif
+    return false;
+}
+
+template <typename Params>
+void field_vec<Params>::mul(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept
+{
+    ASSERT(a.size() == out.size() && b.size() == out.size());
+    size_t i = 0;
+#if BB_FIELD_VEC_IFMA
+    if (has_ifma()) {
+        i = ifma_mul(out.data(), a.data(), b.data(), out.size());
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <typename Params>
+void field_vec<Params>::mul(std::span<field> out, std::span<const field> a, const field& b) noexcept
+{
+    ASSERT(a.size() == out.size());
+    size_t i = 0;
+#if BB_FIELD_VEC_IFMA
+    if (has_ifma()) {
+        i = ifma_mul(out.data(), a.data(), b, out.size());
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] * b;
+    }
+}
+
+template <typename Params> void field_vec<Params>::sqr(std::span<field> out, std::span<const field> a) noexcept
+{
+    ASSERT(a.size() == out.size());
+    size_t i = 0;
+#if BB_FIELD_VEC_IFMA
+    if (has_ifma()) {
+        i = ifma_sqr(out.data(), a.data(), out.size());
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i].sqr();
+    }
+}
+
+template <typename Params>
+void field_vec<Params>::add(std::span<field> out, std::span<const field> a, std::span<const field> b) noexcept
+{
+    ASSERT(a.size() == out.size() && b.size() == out.size());
+    size_t i = 0;
+#if BB_FIELD_VEC_IFMA
+    if (has_ifma()) {
+        i = ifma_add(out.data(), a.data(), b.data(), out.size());
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+template <typename Params>
+void field_vec<Params>::from_montgomery(std::span<field> out, std::span<const field> a) noexcept
+{
+    ASSERT(a.size() == out.size());
+    size_t i = 0;
+#if BB_FIELD_VEC_IFMA
+    if (has_ifma()) {
+        i = ifma_from_montgomery(out.data(), a.data(), out.size());
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = a[i].from_montgomery_form();
+    }
+}
+
+template <typename Params>
+void field_vec<Params>::fold_pairs(std::span<field> out, std::span<const field> pairs, const field& challenge) noexcept
+{
+    ASSERT(pairs.size() == 2 * out.size());
+    size_t i = 0;
+#if BB_FIELD_VEC_IFMA
+    if (has_ifma()) {
+        i = ifma_fold_pairs(out.data(), pairs.data(), challenge, out.size());
+    }
+#endif
+    for (; i < out.size(); ++i) {
+        out[i] = pairs[2 * i] + challenge * (pairs[2 * i + 1] - pairs[2 * i]);
+    }
+}
+
+} // namespace bb
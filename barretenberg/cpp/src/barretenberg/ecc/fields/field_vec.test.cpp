@@ -0,0 +1,130 @@
+#include "field_vec.hpp"
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+
+template <typename Field> class FieldVecTest : public ::testing::Test {
+  public:
+    // Random elements, every third one in the coarse form [p, 2p) which the field arithmetic may produce
+    static std::vector<Field> random_elements(size_t size)
+    {
+        std::vector<Field> elements(size);
+        for (size_t i = 0; i < size; ++i) {
+            elements[i] = Field::random_element().reduce_once();
+            if (i % 3 == 0 && Field::modulus.get_msb() < 254) {
+                const uint256_t coarse = uint256_t(elements[i].data[0],
+                                                   elements[i].data[1],
+                                                   elements[i].data[2],
+                                                   elements[i].data[3]) +
+                                         Field::modulus;
+                for (size_t j = 0; j < 4; ++j) {
+                    elements[i].data[j] = coarse.data[j];
+                }
+            }
+        }
+        return elements;
+    }
+
+    // Sizes below, at and around multiples of the number of lanes
+    static constexpr std::array<size_t, 6> SIZES = { 0, 1, 7, 8, 13, 67 };
+};
+
+using FieldTypes = ::testing::Types<bb::fr, bb::fq, secp256k1::fq>;
+
+} // namespace
+
+TYPED_TEST_SUITE(FieldVecTest, FieldTypes);
+
+TYPED_TEST(FieldVecTest, Mul)
+{
+    using Field = TypeParam;
+    using field_vec = bb::field_vec<typename Field::Params>;
+    for (size_t size : this->SIZES) {
+        const auto a = this->random_elements(size);
+        const auto b = this->random_elements(size);
+        const Field c = Field::random_element();
+
+        std::vector<Field> out(size);
+        field_vec::mul(out, a, b);
+        std::vector<Field> out_constant(size);
+        field_vec::mul(out_constant, a, c);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(out[i], a[i] * b[i]);
+            EXPECT_EQ(out_constant[i], a[i] * c);
+        }
+
+        // In place
+        auto in_place = a;
+        field_vec::mul(in_place, in_place, b);
+        EXPECT_EQ(in_place, out);
+    }
+}
+
+TYPED_TEST(FieldVecTest, SqrAndAdd)
+{
+    using Field = TypeParam;
+    using field_vec = bb::field_vec<typename Field::Params>;
+    for (size_t size : this->SIZES) {
+        const auto a = this->random_elements(size);
+        const auto b = this->random_elements(size);
+
+        std::vector<Field> squares(size);
+        field_vec::sqr(squares, a);
+        std::vector<Field> sums(size);
+        field_vec::add(sums, a, b);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(squares[i], a[i].sqr());
+            EXPECT_EQ(sums[i], a[i] + b[i]);
+        }
+    }
+}
+
+TYPED_TEST(FieldVecTest, FromMontgomery)
+{
+    using Field = TypeParam;
+    using field_vec = bb::field_vec<typename Field::Params>;
+    for (size_t size : this->SIZES) {
+        const auto a = this->random_elements(size);
+
+        std::vector<Field> out(size);
+        field_vec::from_montgomery(out, a);
+        for (size_t i = 0; i < size; ++i) {
+            // Compare the raw limbs, which are not a Montgomery form anymore
+            const Field expected = a[i].from_montgomery_form().reduce_once();
+            const Field actual = out[i].reduce_once();
+            for (size_t j = 0; j < 4; ++j) {
+                EXPECT_EQ(actual.data[j], expected.data[j]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(FieldVecTest, FoldPairs)
+{
+    using Field = TypeParam;
+    using field_vec = bb::field_vec<typename Field::Params>;
+    for (size_t size : this->SIZES) {
+        const auto pairs = this->random_elements(2 * size);
+        const Field challenge = Field::random_element();
+
+        std::vector<Field> out(size);
+        field_vec::fold_pairs(out, pairs, challenge);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(out[i], pairs[2 * i] + challenge * (pairs[2 * i + 1] - pairs[2 * i]));
+        }
+
+        // In place, into the first half of the pairs
+        auto in_place = pairs;
+        field_vec::fold_pairs(std::span(in_place).subspan(0, size), in_place, challenge);
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(in_place[i], out[i]);
+        }
+    }
+}
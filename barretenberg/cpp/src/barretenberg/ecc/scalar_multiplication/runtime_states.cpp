@@ -30,10 +30,13 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     , point_pairs_2_ptr(
           get_mem_slab((static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(AffineElement)))
     , scratch_space_ptr(get_mem_slab(static_cast<size_t>(num_points) * sizeof(AffineElement)))
+    // not a slab: the slabs are only 32-byte aligned, the affine elements need 64
+    , bucket_sums_ptr(aligned_alloc(64, num_rounds * num_buckets * sizeof(AffineElement)), aligned_free)
     , point_schedule(reinterpret_cast<uint64_t*>(point_schedule_ptr.get()))
     , point_pairs_1(reinterpret_cast<AffineElement*>(point_pairs_1_ptr.get()))
     , point_pairs_2(reinterpret_cast<AffineElement*>(point_pairs_2_ptr.get()))
     , scratch_space(reinterpret_cast<Fq*>(scratch_space_ptr.get()))
+    , bucket_sums(reinterpret_cast<AffineElement*>(bucket_sums_ptr.get()))
     , skew_table(reinterpret_cast<bool*>(aligned_alloc(64, pad(static_cast<size_t>(num_points) * sizeof(bool), 64))))
     , bucket_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
     , bit_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
@@ -52,6 +55,7 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
         static_cast<size_t>(bb::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
 
     const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
+    const size_t bucket_sums_per_thread = (this->num_rounds * this->num_buckets) / num_threads;
     parallel_for(num_threads, [&](size_t i) {
         PROFILE_THIS_NAME("memset in Pippenger runtime state creation");
         const size_t thread_offset = i * points_per_thread;
@@ -69,6 +73,9 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
                    points_per_thread * sizeof(uint64_t));
         }
         memset(reinterpret_cast<void*>(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
+        memset(reinterpret_cast<void*>(bucket_sums + i * bucket_sums_per_thread),
+               0,
+               bucket_sums_per_thread * sizeof(AffineElement));
     });
 
     memset(reinterpret_cast<void*>(bucket_counts), 0, num_threads * num_buckets * sizeof(uint32_t));
@@ -77,6 +84,27 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     memset(reinterpret_cast<void*>(round_counts), 0, MAX_NUM_ROUNDS * sizeof(uint64_t));
 }
 
+template <typename Curve>
+size_t pippenger_runtime_state<Curve>::get_memory_footprint(const size_t num_initial_points)
+{
+    // Mirrors the allocations made by the constructor
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_buckets = static_cast<size_t>(1ULL << get_optimal_bucket_width(num_initial_points));
+    const size_t num_rounds = get_num_pippenger_rounds(num_points);
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t prefetch_overflow = num_threads * 16;
+
+    const size_t point_schedule_size = (num_points * num_rounds + prefetch_overflow) * sizeof(uint64_t);
+    const size_t point_pairs_size = 2 * (num_points * 2 + prefetch_overflow) * sizeof(AffineElement);
+    const size_t scratch_space_size = num_points * sizeof(AffineElement);
+    const size_t bucket_sums_size = num_rounds * num_buckets * sizeof(AffineElement);
+    const size_t skew_table_size = pad(num_points * sizeof(bool), 64);
+    const size_t bucket_tables_size = num_threads * num_buckets * (2 * sizeof(uint32_t) + sizeof(bool));
+    const size_t round_counts_size = MAX_NUM_ROUNDS * sizeof(uint64_t);
+    return point_schedule_size + point_pairs_size + scratch_space_size + bucket_sums_size + skew_table_size +
+           bucket_tables_size + round_counts_size;
+}
+
 template <typename Curve>
 pippenger_runtime_state<Curve>::pippenger_runtime_state(pippenger_runtime_state&& other) noexcept
     : num_points(other.num_points)
@@ -88,10 +116,12 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(pippenger_runtime_state&
     , point_pairs_1_ptr(std::move(other.point_pairs_1_ptr))
     , point_pairs_2_ptr(std::move(other.point_pairs_2_ptr))
     , scratch_space_ptr(std::move(other.scratch_space_ptr))
+    , bucket_sums_ptr(std::move(other.bucket_sums_ptr))
     , point_schedule(other.point_schedule)
     , point_pairs_1(other.point_pairs_1)
     , point_pairs_2(other.point_pairs_2)
     , scratch_space(other.scratch_space)
+    , bucket_sums(other.bucket_sums)
     , skew_table(other.skew_table)
     , bucket_counts(other.bucket_counts)
     , bit_counts(other.bit_counts)
@@ -106,6 +136,7 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(pippenger_runtime_state&
     other.point_pairs_1 = nullptr;
     other.point_pairs_2 = nullptr;
     other.scratch_space = nullptr;
+    other.bucket_sums = nullptr;
     other.bit_counts = nullptr;
     other.bucket_counts = nullptr;
     other.bucket_empty_status = nullptr;
@@ -142,12 +173,14 @@ pippenger_runtime_state<Curve>& pippenger_runtime_state<Curve>::operator=(
     point_pairs_1_ptr = std::move(other.point_pairs_1_ptr);
     point_pairs_2_ptr = std::move(other.point_pairs_2_ptr);
     scratch_space_ptr = std::move(other.scratch_space_ptr);
+    bucket_sums_ptr = std::move(other.bucket_sums_ptr);
 
     point_schedule = other.point_schedule;
     skew_table = other.skew_table;
     point_pairs_1 = other.point_pairs_1;
     point_pairs_2 = other.point_pairs_2;
     scratch_space = other.scratch_space;
+    bucket_sums = other.bucket_sums;
     bit_counts = other.bit_counts;
     bucket_counts = other.bucket_counts;
     bucket_empty_status = other.bucket_empty_status;
@@ -158,6 +191,7 @@ pippenger_runtime_state<Curve>& pippenger_runtime_state<Curve>::operator=(
     other.point_pairs_1 = nullptr;
     other.point_pairs_2 = nullptr;
     other.scratch_space = nullptr;
+    other.bucket_sums = nullptr;
     other.bit_counts = nullptr;
     other.bucket_counts = nullptr;
     other.bucket_empty_status = nullptr;
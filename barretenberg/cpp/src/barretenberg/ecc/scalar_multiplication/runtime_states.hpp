@@ -90,10 +90,13 @@ template <typename Curve> struct pippenger_runtime_state {
     std::shared_ptr<void> point_pairs_1_ptr;
     std::shared_ptr<void> point_pairs_2_ptr;
     std::shared_ptr<void> scratch_space_ptr;
+    std::shared_ptr<void> bucket_sums_ptr;
     uint64_t* point_schedule;
     typename Curve::AffineElement* point_pairs_1;
     typename Curve::AffineElement* point_pairs_2;
     typename Curve::BaseField* scratch_space;
+    // The reduced buckets of all rounds, num_buckets per round, which are combined into the round sums at once
+    typename Curve::AffineElement* bucket_sums;
 
     bool* skew_table;
     uint32_t* bucket_counts;
@@ -102,6 +105,11 @@ template <typename Curve> struct pippenger_runtime_state {
     uint64_t* round_counts;
 
     pippenger_runtime_state(size_t num_initial_points) noexcept;
+
+    /**
+     * @brief The number of bytes allocated by a runtime state for num_initial_points points
+     */
+    static size_t get_memory_footprint(size_t num_initial_points);
     pippenger_runtime_state(pippenger_runtime_state&& other) noexcept;
     pippenger_runtime_state& operator=(pippenger_runtime_state&& other) noexcept;
     ~pippenger_runtime_state() noexcept;
@@ -3,7 +3,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
+#include <numeric>
 
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
@@ -778,6 +780,267 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
     return max_bucket_bits;
 }
 
+/**
+ * A set of independent additions lhs += rhs or lhs -= rhs, evaluated with the affine formulae and a single batch
+ * inversion (see `add_affine_points`). Either side may be the point at infinity and the two sides may be equal or
+ * opposite points, so every edge case is handled. The additions of a set must be independent: no two of them may have
+ * the same lhs, and no addition may have the lhs of an earlier addition of the set as its rhs.
+ */
+template <typename Curve> class AffineAdditionBatch {
+    using Fq = typename Curve::BaseField;
+    using AffineElement = typename Curve::AffineElement;
+
+    // How an addition lhs += rhs is evaluated
+    enum class Addition : uint8_t { SKIP, COPY, CANCEL, ADD };
+    // The lhs are scattered in memory, so we fetch them ahead
+    static constexpr size_t PREFETCH_DISTANCE = 8;
+
+  public:
+    explicit AffineAdditionBatch(const size_t capacity)
+    {
+        lhs_points.reserve(capacity);
+        rhs_points.reserve(capacity);
+        rhs_negated.reserve(capacity);
+        additions.reserve(capacity);
+        slopes.reserve(capacity);
+        denominators.reserve(capacity);
+    }
+
+    size_t size() const { return lhs_points.size(); }
+
+    // Adds lhs += rhs, or lhs -= rhs if negate is set, to the set. Both points are read when the set is evaluated.
+    void add(AffineElement* lhs, const AffineElement* rhs, const bool negate = false)
+    {
+        lhs_points.push_back(lhs);
+        rhs_points.push_back(rhs);
+        rhs_negated.push_back(static_cast<uint8_t>(negate));
+    }
+
+    // Evaluates the additions in the order they were added and empties the set
+    void evaluate()
+    {
+        const size_t num_additions = lhs_points.size();
+        additions.resize(num_additions);
+        // The slope numerators times the product of the previous denominators, and then the slopes
+        slopes.resize(num_additions);
+        denominators.resize(num_additions);
+
+        Fq batch_inversion_accumulator = Fq::one();
+        for (size_t j = 0; j < num_additions; ++j) {
+            if (j + PREFETCH_DISTANCE < num_additions) {
+                __builtin_prefetch(lhs_points[j + PREFETCH_DISTANCE]);
+            }
+            const AffineElement& lhs = *lhs_points[j];
+            const AffineElement& rhs = *rhs_points[j];
+            if (rhs.is_point_at_infinity()) {
+                additions[j] = Addition::SKIP;
+                continue;
+            }
+            if (lhs.is_point_at_infinity()) {
+                additions[j] = Addition::COPY;
+                continue;
+            }
+            const Fq rhs_y = rhs_negated[j] != 0 ? -rhs.y : rhs.y;
+            Fq numerator;
+            Fq denominator;
+            if (lhs.x == rhs.x) {
+                if (lhs.y != rhs_y || lhs.y.is_zero()) {
+                    additions[j] = Addition::CANCEL;
+                    continue;
+                }
+                // double
+                const Fq x_squared = lhs.x.sqr();
+                numerator = x_squared + x_squared + x_squared; // 3x^2
+                denominator = lhs.y + lhs.y;                   // 2y
+            } else {
+                numerator = rhs_y - lhs.y;   // y2 - y1
+                denominator = rhs.x - lhs.x; // x2 - x1
+            }
+            additions[j] = Addition::ADD;
+            slopes[j] = numerator * batch_inversion_accumulator;
+            denominators[j] = denominator;
+            batch_inversion_accumulator *= denominator;
+        }
+
+        batch_inversion_accumulator = batch_inversion_accumulator.invert();
+        for (size_t j = num_additions - 1; j < num_additions; --j) {
+            if (additions[j] == Addition::ADD) {
+                slopes[j] *= batch_inversion_accumulator;
+                batch_inversion_accumulator *= denominators[j];
+            }
+        }
+
+        // lhs.x == rhs.x for a doubling, so the addition and the doubling share their formulae
+        for (size_t j = 0; j < num_additions; ++j) {
+            if (j + PREFETCH_DISTANCE < num_additions) {
+                __builtin_prefetch(lhs_points[j + PREFETCH_DISTANCE]);
+            }
+            AffineElement& lhs = *lhs_points[j];
+            const AffineElement& rhs = *rhs_points[j];
+            switch (additions[j]) {
+            case Addition::SKIP: {
+                break;
+            }
+            case Addition::COPY: {
+                lhs = rhs_negated[j] != 0 ? -rhs : rhs;
+                break;
+            }
+            case Addition::CANCEL: {
+                lhs.self_set_infinity();
+                break;
+            }
+            case Addition::ADD: {
+                const Fq x3 = slopes[j].sqr() - lhs.x - rhs.x; // x3 = lambda_squared - x1 - x2
+                lhs.y = slopes[j] * (lhs.x - x3) - lhs.y;      // y3 = lambda * (x1 - x3) - y1
+                lhs.x = x3;
+                break;
+            }
+            }
+        }
+        lhs_points.clear();
+        rhs_points.clear();
+        rhs_negated.clear();
+    }
+
+  private:
+    std::vector<AffineElement*> lhs_points;
+    std::vector<const AffineElement*> rhs_points;
+    std::vector<uint8_t> rhs_negated;
+    std::vector<Addition> additions;
+    std::vector<Fq> slopes;
+    std::vector<Fq> denominators;
+};
+
+/**
+ * Accumulates many segments of consecutive buckets at once. For the segment s, made of the buckets B_0, ..., B_{L-1}
+ * at buckets[s * L, (s + 1) * L) where L = segment_length, this computes
+ *
+ * running_sums[s] = B_0 + B_1 + ... + B_{L-1}
+ * weighted_sums[s] = 0 * B_0 + 1 * B_1 + ... + (L - 1) * B_{L-1}
+ *
+ * using the running sum of the bucket concatenation: walking down from the top bucket, we add the running sum into the
+ * weighted sum and then the bucket into the running sum. The segments are walked in lockstep, so each step is a set of
+ * 2 * num_segments independent additions which we evaluate with the affine formulae and a single batch inversion (see
+ * `AffineAdditionBatch`).
+ *
+ * Any bucket may be the point at infinity, and the sums start at infinity, so the additions handle all the edge cases.
+ */
+template <typename Curve>
+void accumulate_bucket_segments(const typename Curve::AffineElement* buckets,
+                                const size_t segment_length,
+                                const size_t num_segments,
+                                typename Curve::AffineElement* running_sums,
+                                typename Curve::AffineElement* weighted_sums)
+{
+    for (size_t i = 0; i < num_segments; ++i) {
+        running_sums[i].self_set_infinity();
+        weighted_sums[i].self_set_infinity();
+    }
+
+    // The weighted sum is added to first, as it adds the running sum of the previous step
+    AffineAdditionBatch<Curve> additions(num_segments * 2);
+    for (size_t step = segment_length - 1; step < segment_length; --step) {
+        const size_t next_step = step > 0 ? step - 1 : 0;
+        for (size_t i = 0; i < num_segments; ++i) {
+            __builtin_prefetch(buckets + (i * segment_length) + next_step);
+            additions.add(&weighted_sums[i], &running_sums[i]);
+            additions.add(&running_sums[i], &buckets[(i * segment_length) + step]);
+        }
+        additions.evaluate();
+    }
+}
+
+/**
+ * The sum 1 * B_0 + 3 * B_1 + ... + (2n - 1) * B_{n-1} of a round whose buckets are cut into segments of segment_length
+ * buckets, from the sums of its segments computed by `accumulate_bucket_segments`. It is the sum of
+ * 2 * weighted_sums[s] + (2 * s * segment_length + 1) * running_sums[s] over the segments s, in which we get the sum of
+ * s * running_sums[s] with a running sum again.
+ */
+template <typename Curve>
+typename Curve::Element sum_round_segments(const typename Curve::AffineElement* running_sums,
+                                           const typename Curve::AffineElement* weighted_sums,
+                                           const size_t num_segments,
+                                           const size_t segment_length)
+{
+    using Element = typename Curve::Element;
+    Element weighted_sum;
+    Element running_sum;
+    Element index_sum;
+    weighted_sum.self_set_infinity();
+    running_sum.self_set_infinity();
+    index_sum.self_set_infinity();
+    for (size_t s = num_segments - 1; s < num_segments; --s) {
+        index_sum += running_sum;
+        running_sum += running_sums[s];
+        weighted_sum += weighted_sums[s];
+    }
+    // multiply by 2 * segment_length
+    for (size_t i = 0; i <= numeric::get_msb(segment_length); ++i) {
+        index_sum.self_dbl();
+    }
+    weighted_sum.self_dbl();
+    return weighted_sum + running_sum + index_sum;
+}
+
+/**
+ * Computes the sum of each pippenger round from its buckets. The round r has the buckets B_0, ..., B_{n-1} at
+ * buckets[r * n, (r + 1) * n), where n = num_buckets, and its sum is 1 * B_0 + 3 * B_1 + ... + (2n - 1) * B_{n-1}
+ * as the bucket k collects the points whose wnaf slice is 2k + 1.
+ *
+ * The buckets of all rounds are combined as a single job. They are cut into segments of consecutive buckets, which are
+ * accumulated in chunks spread over all threads by `accumulate_bucket_segments`. The segments of a chunk share a batch
+ * inversion, so each bucket costs two affine additions instead of the two projective additions of walking the buckets
+ * of a round with a running sum. The few segments of each round are then combined with projective additions.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> combine_buckets(const typename Curve::AffineElement* buckets,
+                                                     const size_t num_rounds,
+                                                     const size_t num_buckets)
+{
+    PROFILE_THIS();
+
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    // The number of segments sharing a batch inversion, which makes its cost small next to the additions
+    constexpr size_t SEGMENTS_PER_CHUNK = 256;
+    constexpr size_t MIN_SEGMENT_LENGTH = 16;
+    const size_t num_total_buckets = num_rounds * num_buckets;
+    const size_t num_chunks = calculate_num_threads(num_total_buckets, SEGMENTS_PER_CHUNK * MIN_SEGMENT_LENGTH);
+
+    // The longest segments within a round which give every chunk SEGMENTS_PER_CHUNK segments
+    size_t segment_length = num_buckets;
+    while (segment_length > 1 && num_total_buckets / segment_length < num_chunks * SEGMENTS_PER_CHUNK) {
+        segment_length >>= 1;
+    }
+    const size_t num_segments = num_total_buckets / segment_length;
+    const size_t segments_per_round = num_buckets / segment_length;
+
+    std::vector<AffineElement> running_sums(num_segments);
+    std::vector<AffineElement> weighted_sums(num_segments);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = (chunk * num_segments) / num_chunks;
+        const size_t end = ((chunk + 1) * num_segments) / num_chunks;
+        accumulate_bucket_segments<Curve>(
+            &buckets[start * segment_length], segment_length, end - start, &running_sums[start], &weighted_sums[start]);
+    });
+
+    std::vector<Element> round_sums(num_rounds);
+    parallel_for(num_rounds, [&](size_t round) {
+        const size_t offset = round * segments_per_round;
+        round_sums[round] = sum_round_segments<Curve>(
+            &running_sums[offset], &weighted_sums[offset], segments_per_round, segment_length);
+    });
+    return round_sums;
+}
+
+/**
+ * Evaluates the pippenger rounds in two passes. In the first, every thread adds the points of its slice of each round
+ * into buckets with `reduce_buckets` and writes them into `state.bucket_sums`. The slices of a round are sorted by
+ * bucket, so adjacent slices share at most a bucket, whose parts are added together afterwards. In the second, the
+ * buckets of all rounds are combined into the round sums at once by `combine_buckets`, spread evenly over all the
+ * threads whatever the distribution of the points into buckets.
+ */
 template <typename Curve>
 typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
                                                   std::span<const typename Curve::AffineElement> points,
@@ -791,108 +1054,133 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
     const size_t num_rounds = get_num_rounds(num_points);
     const size_t num_threads = get_num_cpus_pow2();
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
+    const size_t num_buckets = 1UL << bits_per_bucket;
+    ASSERT(num_rounds * num_buckets <= state.num_rounds * state.num_buckets);
 
-    std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
-        static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
+    // A slice whose first bucket is also the last bucket of the previous slice writes it into shared_buckets, and its
+    // index into shared_bucket_indices
+    constexpr size_t NO_SHARED_BUCKET = static_cast<size_t>(-1);
+    std::vector<AffineElement> shared_buckets(num_rounds * num_threads);
+    std::vector<size_t> shared_bucket_indices(num_rounds * num_threads, NO_SHARED_BUCKET);
+    std::vector<Element> skew_sums(num_threads);
 
     parallel_for(num_threads, [&](size_t j) {
-        thread_accumulators[j].self_set_infinity();
-
         for (size_t i = 0; i < num_rounds; ++i) {
-
+            AffineElement* round_buckets = &state.bucket_sums[i * num_buckets];
             const uint64_t num_round_points = state.round_counts[i];
 
-            Element accumulator;
-            accumulator.self_set_infinity();
-
-            if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
-            } else {
-
-                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
-                const uint64_t leftovers =
-                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
-
-                uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
-                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
-                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
-
-                affine_product_runtime_state<Curve> product_state =
-                    state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
-                product_state.points = points.data();
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
-                Element running_sum;
-                running_sum.self_set_infinity();
-
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
+            if (num_round_points == 0) {
+                if (j == num_threads - 1) {
+                    for (size_t k = 0; k < num_buckets; ++k) {
+                        round_buckets[k].self_set_infinity();
                     }
-                    accumulator += running_sum;
-                }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
-
-                // we now need to scale up 'running sum' up to the value of the first bucket.
-                // e.g. if first bucket is 0, no scaling
-                // if first bucket is 1, we need to add (2 * running_sum)
-                if (first_bucket > 0) {
-                    auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
-                    size_t shift = numeric::get_msb(multiplier);
-                    Element rolling_accumulator = Curve::Group::point_at_infinity;
-                    bool init = false;
-                    while (shift != static_cast<size_t>(-1)) {
-                        if (init) {
-                            rolling_accumulator.self_dbl();
-                            if (((multiplier >> shift) & 1)) {
-                                rolling_accumulator += running_sum;
-                            }
-                        } else {
-                            rolling_accumulator += running_sum;
-                        }
-                        init = true;
-                        shift -= 1;
-                    }
-                    accumulator += rolling_accumulator;
                 }
+                continue;
+            }
+            // a round with fewer points than threads is done by the last thread
+            if (num_round_points < num_threads && j != num_threads - 1) {
+                continue;
             }
 
-            if (i == (num_rounds - 1)) {
-                const size_t num_points_per_thread = num_points / num_threads;
-                bool* skew_table = &state.skew_table[j * num_points_per_thread];
-                const AffineElement* point_table = &points[j * num_points_per_thread];
-                AffineElement addition_temporary;
-                for (size_t k = 0; k < num_points_per_thread; ++k) {
-                    if (skew_table[k]) {
-                        addition_temporary = -point_table[k];
-                        accumulator += addition_temporary;
-                    }
+            const uint64_t num_round_points_per_thread = num_round_points / num_threads;
+            const uint64_t leftovers =
+                (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
+
+            uint64_t* thread_point_schedule = &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
+            const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+            const size_t last_bucket =
+                thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+            const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+
+            // the buckets between the previous slice and this one are empty, and so are the ones after the last slice
+            size_t first_empty_bucket = 0;
+            bool shares_first_bucket = false;
+            if (j > 0 && num_round_points_per_thread > 0) {
+                const size_t previous_bucket = *(thread_point_schedule - 1) & 0x7fffffffU;
+                first_empty_bucket = previous_bucket + 1;
+                shares_first_bucket = previous_bucket == first_bucket;
+            }
+            for (size_t k = first_empty_bucket; k < first_bucket; ++k) {
+                round_buckets[k].self_set_infinity();
+            }
+            if (j == num_threads - 1) {
+                for (size_t k = last_bucket + 1; k < num_buckets; ++k) {
+                    round_buckets[k].self_set_infinity();
                 }
             }
 
-            if (i > 0) {
-                for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
-                    thread_accumulators[j].self_dbl();
+            affine_product_runtime_state<Curve> product_state = state.get_affine_product_runtime_state(num_threads, j);
+            product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+            product_state.points = points.data();
+            product_state.point_schedule = thread_point_schedule;
+            product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+            AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+
+            // the non-empty buckets are output in increasing order
+            size_t output_it = 0;
+            for (size_t k = 0; k < num_thread_buckets; ++k) {
+                AffineElement& bucket = (k == 0 && shares_first_bucket) ? shared_buckets[(i * num_threads) + j]
+                                                                        : round_buckets[first_bucket + k];
+                if (product_state.bucket_empty_status[k]) {
+                    bucket.self_set_infinity();
+                } else {
+                    bucket = output_buckets[output_it++];
                 }
             }
-            thread_accumulators[j] += accumulator;
+            if (shares_first_bucket) {
+                shared_bucket_indices[(i * num_threads) + j] = (i * num_buckets) + first_bucket;
+            }
+        }
+
+        skew_sums[j].self_set_infinity();
+        const size_t num_points_per_thread = num_points / num_threads;
+        bool* skew_table = &state.skew_table[j * num_points_per_thread];
+        const AffineElement* point_table = &points[j * num_points_per_thread];
+        AffineElement addition_temporary;
+        for (size_t k = 0; k < num_points_per_thread; ++k) {
+            if (skew_table[k]) {
+                addition_temporary = -point_table[k];
+                skew_sums[j] += addition_temporary;
+            }
         }
     });
 
+    // Add the shared parts of the buckets, the slices sharing a bucket are consecutive
+    std::vector<Element> merged_buckets;
+    std::vector<size_t> merged_indices;
+    for (size_t k = 0; k < shared_bucket_indices.size(); ++k) {
+        const size_t index = shared_bucket_indices[k];
+        if (index == NO_SHARED_BUCKET) {
+            continue;
+        }
+        if (merged_indices.empty() || merged_indices.back() != index) {
+            merged_indices.push_back(index);
+            merged_buckets.emplace_back(state.bucket_sums[index]);
+        }
+        merged_buckets.back() += shared_buckets[k];
+    }
+    if (!merged_buckets.empty()) {
+        Element::batch_normalize(merged_buckets.data(), merged_buckets.size());
+        for (size_t k = 0; k < merged_buckets.size(); ++k) {
+            // the point at infinity keeps its flag in x
+            state.bucket_sums[merged_indices[k]] = AffineElement(merged_buckets[k].x, merged_buckets[k].y);
+        }
+    }
+
+    const std::vector<Element> round_sums = combine_buckets<Curve>(state.bucket_sums, num_rounds, num_buckets);
+
     Element result;
     result.self_set_infinity();
-    for (size_t i = 0; i < num_threads; ++i) {
-        result += thread_accumulators[i];
+    for (size_t i = 0; i < num_rounds; ++i) {
+        if (i > 0) {
+            for (size_t k = 0; k < bits_per_bucket + 1; ++k) {
+                result.self_dbl();
+            }
+        }
+        result += round_sums[i];
+    }
+    for (const Element& skew_sum : skew_sums) {
+        result += skew_sum;
     }
     return result;
 }
@@ -1035,6 +1323,333 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(
     return pippenger(scalars, G_mod, state, false);
 }
 
+/**
+ * @brief Pippenger over a fixed amount of scratch memory, independent of the number of points
+ *
+ * @details The runtime state of pippenger is sized to the whole point set: a 2^24 point MSM needs several GiB of
+ * point schedules and bucket buffers, more than the scalars and points themselves. This variant walks the input in
+ * chunks of as many points as `state` was constructed for (rounded down to a power of 2), runs pippenger on each chunk
+ * in the same runtime state and sums the chunk results, so the caller picks the scratch size by sizing the state (see
+ * get_pippenger_chunk_size). Chunks wholly before scalars.start_index are skipped.
+ *
+ * The result is the same group element as pippenger's. The cost is one bucket reduction per chunk and round instead
+ * of one per round, which is small once the chunks have a few hundred thousand points.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_chunked(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                          std::span<const typename Curve::AffineElement> points,
+                                          pippenger_runtime_state<Curve>& state,
+                                          bool handle_edge_cases)
+{
+    PROFILE_THIS();
+    using Element = typename Curve::Element;
+
+    const auto capacity = static_cast<size_t>(state.num_points / 2);
+    const size_t chunk_size = capacity == 0 ? 1 : static_cast<size_t>(1ULL << numeric::get_msb(capacity));
+
+    Element result;
+    result.self_set_infinity();
+    for (size_t chunk_start = 0; chunk_start < scalars.size(); chunk_start += chunk_size) {
+        const size_t chunk_end = std::min(chunk_start + chunk_size, scalars.size());
+        const size_t first_point = scalars.start_index + chunk_start;
+        result += pippenger<Curve>({ 0, scalars.span.subspan(chunk_start, chunk_end - chunk_start) },
+                                   points.subspan(first_point * 2),
+                                   state,
+                                   handle_edge_cases);
+    }
+    return result;
+}
+
+/**
+ * @brief The largest power-of-2 number of points whose pippenger_runtime_state fits in memory_budget bytes, i.e. the
+ * number of points to construct the runtime state for when using pippenger_chunked with that budget. Never less than
+ * the size below which pippenger does not use its runtime state.
+ */
+template <typename Curve> size_t get_pippenger_chunk_size(const size_t memory_budget)
+{
+    // Below this size pippenger does not use the runtime state, see the threshold in pippenger()
+    const size_t min_chunk_size = get_num_cpus_pow2() * 16;
+    size_t chunk_size = min_chunk_size;
+    while (chunk_size < (1ULL << 31) &&
+           pippenger_runtime_state<Curve>::get_memory_footprint(chunk_size * 2) <= memory_budget) {
+        chunk_size *= 2;
+    }
+    return chunk_size;
+}
+
+/**
+ * The entry that `wnaf::fixed_wnaf` writes for the round `round` of a 127-bit scalar, where round 0 holds the most
+ * significant slice: the bucket index in the low 31 bits and the sign in bit 31. The entry of a round only depends on
+ * two adjacent slices of the scalar, so it can be computed without the wnaf of the whole scalar. As with fixed_wnaf,
+ * the entries represent scalar + 1 if the scalar is even (its skew).
+ */
+inline uint64_t get_wnaf_round_entry(const uint64_t* scalar,
+                                     const size_t round,
+                                     const size_t num_rounds,
+                                     const size_t wnaf_bits)
+{
+    const size_t final_bits = wnaf::SCALAR_BITS - (wnaf_bits * (num_rounds - 1));
+    if (round == 0) {
+        const uint64_t slice = wnaf::get_wnaf_bits(scalar, final_bits, (num_rounds - 1) * wnaf_bits);
+        return (slice + static_cast<uint64_t>((slice & 1UL) == 0UL)) >> 1UL;
+    }
+    const size_t slice_index = num_rounds - round;
+    const uint64_t slice =
+        wnaf::get_wnaf_bits(scalar, slice_index == num_rounds - 1 ? final_bits : wnaf_bits, slice_index * wnaf_bits);
+    const uint64_t previous_slice = wnaf::get_wnaf_bits(scalar, wnaf_bits, (slice_index - 1) * wnaf_bits);
+    const uint64_t previous = previous_slice + static_cast<uint64_t>((previous_slice & 1UL) == 0UL);
+    const auto predicate = static_cast<uint64_t>((slice & 1UL) == 0UL);
+    return (((previous - (predicate << wnaf_bits)) ^ (0UL - predicate)) >> 1UL) | (predicate << 31UL);
+}
+
+/**
+ * @brief Pippenger for several scalar vectors over the same points, which walks the points once per round for a
+ * batch of vectors instead of once per round for each vector
+ *
+ * @details The vectors are taken in batches of PIPPENGER_BATCH_SIZE, largest first so that vectors of similar sizes
+ * share a batch. The points used by a batch are split into one slice per thread, and in every round each thread walks
+ * its slice once: a point is read once and added into the bucket of every vector of the batch whose span covers it.
+ * As each thread has its own buckets for the vectors of the batch, the points need not be sorted by bucket. They are
+ * added with the affine formulae in sets of independent additions sharing a batch inversion (see
+ * `AffineAdditionBatch`); a point whose bucket already has an addition in the current set waits for the next one. At
+ * the end of a round the thread combines its buckets into the round sums of the batch.
+ *
+ * The scratch memory is bounded by the batch size: the endomorphism split of the scalars of a batch, 32 bytes per
+ * scalar, and per thread the buckets of the vectors of a batch. A vector skips the points outside its span and the
+ * halves of its split scalars which are zero. The additions handle every edge case, so the points need not be
+ * distinct.
+ *
+ * @param scalars The scalar vectors, scalars[k].start_index being the index of the point of the first scalar
+ * @param points The pippenger point table (see generate_pippenger_point_table) up to the end index of every vector
+ * @return The multi-scalar multiplication of each vector, in the order of the input
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars,
+    std::span<const typename Curve::AffineElement> points)
+{
+    PROFILE_THIS();
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    // The number of additions sharing a batch inversion
+    constexpr size_t MIN_ADDITIONS_PER_SET = 256;
+    constexpr size_t MAX_ADDITIONS_PER_SET = 2048;
+    // The points of a vector whose scalar is even are subtracted once (the skew), into this many accumulators so that
+    // they rarely wait for the next set of additions
+    constexpr size_t NUM_SKEW_ACCUMULATORS = MAX_ADDITIONS_PER_SET;
+    // The number of bucket segments sharing a batch inversion when combining the buckets of a round
+    constexpr size_t NUM_ROUND_SEGMENTS = 256;
+    // Every thread combines its own buckets each round, which should stay small next to adding its points
+    constexpr size_t MIN_POINTS_PER_THREAD = 1 << 12;
+
+    std::vector<Element> results(scalars.size());
+    std::vector<size_t> order(scalars.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+        order.begin(), order.end(), [&](size_t i, size_t j) { return scalars[i].size() > scalars[j].size(); });
+
+    for (size_t batch_start = 0; batch_start < order.size(); batch_start += PIPPENGER_BATCH_SIZE) {
+        const std::span<const size_t> batch(&order[batch_start],
+                                            std::min(PIPPENGER_BATCH_SIZE, order.size() - batch_start));
+        const size_t batch_size = batch.size();
+
+        size_t first_point = std::numeric_limits<size_t>::max();
+        size_t end_point = 0;
+        for (const size_t k : batch) {
+            results[k].self_set_infinity();
+            if (scalars[k].size() > 0) {
+                first_point = std::min(first_point, scalars[k].start_index);
+                end_point = std::max(end_point, scalars[k].end_index());
+            }
+        }
+        if (end_point == 0) {
+            continue;
+        }
+        ASSERT(end_point * 2 <= points.size());
+
+        // Split every scalar of the batch into two 127-bit scalars, in the first and last two limbs of a field element
+        std::vector<std::vector<Fr>> split_scalars(batch_size);
+        for (size_t v = 0; v < batch_size; ++v) {
+            const std::span<const Fr> vector_scalars = scalars[batch[v]].span;
+            split_scalars[v].resize(vector_scalars.size());
+            parallel_for_range(vector_scalars.size(), [&](size_t start, size_t end) {
+                for (size_t j = start; j < end; ++j) {
+                    Fr T0 = vector_scalars[j].from_montgomery_form();
+                    Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
+                    split_scalars[v][j] = T0;
+                }
+            });
+        }
+
+        const size_t num_batch_points = end_point - first_point;
+        const size_t num_threads = calculate_num_threads(num_batch_points, MIN_POINTS_PER_THREAD);
+        const size_t num_points_per_thread = (num_batch_points + num_threads - 1) / num_threads;
+        const size_t bits_per_bucket = get_optimal_bucket_width(num_points_per_thread);
+        const size_t wnaf_bits = bits_per_bucket + 1;
+        const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+        const size_t num_buckets = 1UL << bits_per_bucket;
+        const size_t num_batch_buckets = batch_size * num_buckets;
+
+        size_t segment_length = num_buckets;
+        while (segment_length > 1 && num_batch_buckets / segment_length < NUM_ROUND_SEGMENTS) {
+            segment_length >>= 1;
+        }
+        const size_t segments_per_vector = num_buckets / segment_length;
+        const size_t additions_per_set =
+            std::clamp(num_batch_buckets / 2, MIN_ADDITIONS_PER_SET, MAX_ADDITIONS_PER_SET);
+        // The first round only uses the 2^(top_bits - 1) lowest buckets of a vector, often too few to fill a set of
+        // additions without waiting, so its points are spread over replicas of them among the unused buckets
+        const size_t top_bits = wnaf::SCALAR_BITS - (wnaf_bits * (num_rounds - 1));
+        const size_t top_round_buckets = 1UL << (top_bits - 1);
+        size_t num_top_replicas = 1;
+        while (2 * num_top_replicas * top_round_buckets <= num_buckets &&
+               batch_size * num_top_replicas * top_round_buckets < 2 * additions_per_set) {
+            num_top_replicas *= 2;
+        }
+
+        std::vector<Element> thread_results(num_threads * batch_size);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t slice_start = std::min(first_point + (thread_idx * num_points_per_thread), end_point);
+            const size_t slice_end = std::min(slice_start + num_points_per_thread, end_point);
+            Element* vector_results = &thread_results[thread_idx * batch_size];
+
+            // The buckets of the vector v are at [v * num_buckets, (v + 1) * num_buckets), followed by the skew
+            // accumulators of every vector
+            std::vector<AffineElement> buckets(num_batch_buckets + (batch_size * NUM_SKEW_ACCUMULATORS));
+            for (AffineElement& bucket : buckets) {
+                bucket.self_set_infinity();
+            }
+            std::vector<size_t> num_skewed_points(batch_size, 0);
+            std::vector<size_t> num_top_points(batch_size, 0);
+
+            AffineAdditionBatch<Curve> additions(additions_per_set);
+            std::vector<uint8_t> bucket_in_set(buckets.size(), 0);
+            std::vector<size_t> set_buckets;
+            // A point added into a bucket, or subtracted from it if negate is set
+            struct BucketAddition {
+                size_t bucket;
+                const AffineElement* point;
+                bool negate;
+            };
+            std::vector<BucketAddition> waiting_additions;
+            std::vector<BucketAddition> retried_additions;
+            const auto add_to_bucket = [&](const BucketAddition& addition) {
+                if (bucket_in_set[addition.bucket] != 0) {
+                    waiting_additions.push_back(addition);
+                } else {
+                    bucket_in_set[addition.bucket] = 1;
+                    set_buckets.push_back(addition.bucket);
+                    additions.add(&buckets[addition.bucket], addition.point, addition.negate);
+                }
+            };
+            const auto evaluate_additions = [&]() {
+                additions.evaluate();
+                for (const size_t bucket : set_buckets) {
+                    bucket_in_set[bucket] = 0;
+                }
+                set_buckets.clear();
+                std::swap(waiting_additions, retried_additions);
+                for (const BucketAddition& addition : retried_additions) {
+                    add_to_bucket(addition);
+                }
+                retried_additions.clear();
+            };
+
+            std::vector<AffineElement> running_sums(batch_size * segments_per_vector);
+            std::vector<AffineElement> weighted_sums(batch_size * segments_per_vector);
+            for (size_t v = 0; v < batch_size; ++v) {
+                vector_results[v].self_set_infinity();
+            }
+            for (size_t round = 0; round < num_rounds; ++round) {
+                for (size_t k = 0; k < num_batch_buckets; ++k) {
+                    buckets[k].self_set_infinity();
+                }
+                for (size_t i = slice_start; i < slice_end; ++i) {
+                    for (size_t v = 0; v < batch_size; ++v) {
+                        const PolynomialSpan<const Fr>& vector_scalars = scalars[batch[v]];
+                        if (i < vector_scalars.start_index || i >= vector_scalars.end_index()) {
+                            continue;
+                        }
+                        const Fr& split_scalar = split_scalars[v][i - vector_scalars.start_index];
+                        for (size_t half = 0; half < 2; ++half) {
+                            const uint64_t* scalar = &split_scalar.data[2 * half];
+                            if ((scalar[0] | scalar[1]) == 0) {
+                                continue;
+                            }
+                            const AffineElement& point = points[(2 * i) + half];
+                            const uint64_t entry = get_wnaf_round_entry(scalar, round, num_rounds, wnaf_bits);
+                            size_t bucket = (v * num_buckets) + static_cast<size_t>(entry & 0x7fffffffU);
+                            if (round == 0) {
+                                bucket += (num_top_points[v]++ & (num_top_replicas - 1)) * top_round_buckets;
+                            }
+                            add_to_bucket({ bucket, &point, ((entry >> 31U) & 1U) != 0 });
+                            if (round == 0 && (scalar[0] & 1) == 0) {
+                                const size_t accumulator = num_skewed_points[v]++ % NUM_SKEW_ACCUMULATORS;
+                                add_to_bucket(
+                                    { num_batch_buckets + (v * NUM_SKEW_ACCUMULATORS) + accumulator, &point, true });
+                            }
+                        }
+                    }
+                    if (additions.size() >= additions_per_set || waiting_additions.size() >= additions_per_set) {
+                        evaluate_additions();
+                    }
+                }
+                while (additions.size() > 0 || !waiting_additions.empty()) {
+                    evaluate_additions();
+                }
+                if (round == 0) {
+                    // Fold the replicas of the first round back into its buckets, halving them at every step
+                    for (size_t width = num_top_replicas / 2; width > 0; width >>= 1) {
+                        for (size_t v = 0; v < batch_size; ++v) {
+                            AffineElement* vector_buckets = &buckets[v * num_buckets];
+                            for (size_t k = 0; k < width * top_round_buckets; ++k) {
+                                additions.add(&vector_buckets[k], &vector_buckets[k + (width * top_round_buckets)]);
+                            }
+                        }
+                        additions.evaluate();
+                    }
+                    for (size_t v = 0; v < batch_size; ++v) {
+                        for (size_t k = top_round_buckets; k < num_top_replicas * top_round_buckets; ++k) {
+                            buckets[(v * num_buckets) + k].self_set_infinity();
+                        }
+                    }
+                }
+
+                accumulate_bucket_segments<Curve>(buckets.data(),
+                                                  segment_length,
+                                                  batch_size * segments_per_vector,
+                                                  running_sums.data(),
+                                                  weighted_sums.data());
+                for (size_t v = 0; v < batch_size; ++v) {
+                    if (round > 0) {
+                        for (size_t k = 0; k < wnaf_bits; ++k) {
+                            vector_results[v].self_dbl();
+                        }
+                    }
+                    vector_results[v] += sum_round_segments<Curve>(&running_sums[v * segments_per_vector],
+                                                                   &weighted_sums[v * segments_per_vector],
+                                                                   segments_per_vector,
+                                                                   segment_length);
+                }
+            }
+            for (size_t v = 0; v < batch_size; ++v) {
+                for (size_t k = 0; k < NUM_SKEW_ACCUMULATORS; ++k) {
+                    vector_results[v] += buckets[num_batch_buckets + (v * NUM_SKEW_ACCUMULATORS) + k];
+                }
+            }
+        });
+
+        for (size_t v = 0; v < batch_size; ++v) {
+            for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+                results[batch[v]] += thread_results[(thread_idx * batch_size) + v];
+            }
+        }
+    }
+    return results;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(const curve::BN254::AffineElement* points,
@@ -1061,6 +1676,16 @@ template void add_affine_points_with_edge_cases<curve::BN254>(curve::BN254::Affi
 template void evaluate_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                      const size_t max_bucket_bits,
                                                      bool handle_edge_cases);
+template void accumulate_bucket_segments<curve::BN254>(const curve::BN254::AffineElement* buckets,
+                                                       size_t segment_length,
+                                                       size_t num_segments,
+                                                       curve::BN254::AffineElement* running_sums,
+                                                       curve::BN254::AffineElement* weighted_sums);
+
+template std::vector<curve::BN254::Element> combine_buckets<curve::BN254>(const curve::BN254::AffineElement* buckets,
+                                                                          size_t num_rounds,
+                                                                          size_t num_buckets);
+
 template curve::BN254::Element pippenger_internal<curve::BN254>(std::span<const curve::BN254::AffineElement> points,
                                                                 PolynomialSpan<const curve::BN254::ScalarField> scalars,
                                                                 const size_t num_initial_points,
@@ -1096,6 +1721,16 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     std::span<const curve::BN254::AffineElement> points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_chunked<curve::BN254>(PolynomialSpan<const curve::BN254::ScalarField> scalars,
+                                                               std::span<const curve::BN254::AffineElement> points,
+                                                               pippenger_runtime_state<curve::BN254>& state,
+                                                               bool handle_edge_cases = true);
+
+template size_t get_pippenger_chunk_size<curve::BN254>(size_t memory_budget);
+template std::vector<curve::BN254::Element> pippenger_batch<curve::BN254>(
+    std::span<const PolynomialSpan<const curve::BN254::ScalarField>> scalars,
+    std::span<const curve::BN254::AffineElement> points);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1121,6 +1756,17 @@ template void add_affine_points_with_edge_cases<curve::Grumpkin>(curve::Grumpkin
 template void evaluate_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                         const size_t max_bucket_bits,
                                                         bool handle_edge_cases);
+template void accumulate_bucket_segments<curve::Grumpkin>(const curve::Grumpkin::AffineElement* buckets,
+                                                          size_t segment_length,
+                                                          size_t num_segments,
+                                                          curve::Grumpkin::AffineElement* running_sums,
+                                                          curve::Grumpkin::AffineElement* weighted_sums);
+
+template std::vector<curve::Grumpkin::Element> combine_buckets<curve::Grumpkin>(
+    const curve::Grumpkin::AffineElement* buckets,
+    size_t num_rounds,
+    size_t num_buckets);
+
 template curve::Grumpkin::Element pippenger_internal<curve::Grumpkin>(
     std::span<const curve::Grumpkin::AffineElement> points,
     PolynomialSpan<const curve::Grumpkin::ScalarField> scalars,
@@ -1156,6 +1802,17 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     std::span<const curve::Grumpkin::AffineElement> points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_chunked<curve::Grumpkin>(
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars,
+    std::span<const curve::Grumpkin::AffineElement> points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true);
+
+template size_t get_pippenger_chunk_size<curve::Grumpkin>(size_t memory_budget);
+template std::vector<curve::Grumpkin::Element> pippenger_batch<curve::Grumpkin>(
+    std::span<const PolynomialSpan<const curve::Grumpkin::ScalarField>> scalars,
+    std::span<const curve::Grumpkin::AffineElement> points);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -6,6 +6,8 @@
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -134,6 +136,19 @@ template <typename Curve>
 void evaluate_addition_chains(affine_product_runtime_state<Curve>& state,
                               size_t max_bucket_bits,
                               bool handle_edge_cases);
+
+template <typename Curve>
+void accumulate_bucket_segments(const typename Curve::AffineElement* buckets,
+                                size_t segment_length,
+                                size_t num_segments,
+                                typename Curve::AffineElement* running_sums,
+                                typename Curve::AffineElement* weighted_sums);
+
+template <typename Curve>
+std::vector<typename Curve::Element> combine_buckets(const typename Curve::AffineElement* buckets,
+                                                     size_t num_rounds,
+                                                     size_t num_buckets);
+
 template <typename Curve>
 typename Curve::Element pippenger_internal(typename Curve::AffineElement* points,
                                            PolynomialSpan<const typename Curve::ScalarField> scalars,
@@ -175,6 +190,22 @@ typename Curve::Element pippenger_unsafe_optimized_for_non_dyadic_polys(
     std::span<const typename Curve::AffineElement> points,
     pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+typename Curve::Element pippenger_chunked(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                          std::span<const typename Curve::AffineElement> points,
+                                          pippenger_runtime_state<Curve>& state,
+                                          bool handle_edge_cases = true);
+
+template <typename Curve> size_t get_pippenger_chunk_size(size_t memory_budget);
+
+// The number of scalar vectors pippenger_batch walks the points for at once, which bounds its scratch memory
+constexpr size_t PIPPENGER_BATCH_SIZE = 4;
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars,
+    std::span<const typename Curve::AffineElement> points);
+
 // Explicit instantiation
 // BN254
 
@@ -46,8 +46,14 @@ void ECCVMProver::execute_wire_commitments_round()
 {
     auto wire_polys = key->polynomials.get_wires();
     auto labels = commitment_labels.get_wires();
+    std::vector<PolynomialSpan<const FF>> wires;
+    wires.reserve(wire_polys.size());
+    for (auto& wire : wire_polys) {
+        wires.emplace_back(wire);
+    }
+    auto commitments = key->commitment_key->commit_batch(wires);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], key->commitment_key->commit(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -111,7 +117,10 @@ void ECCVMProver::execute_relation_check_rounds()
 /**
  * @brief Produce a univariate opening claim for the sumcheck multivariate evalutions and a batched univariate claim
  * for the transcript polynomials (for the Translator consistency check). Reduce the two opening claims to a single one
- * via Shplonk and produce an opening proof with the univariate PCS of choice (IPA when operating on Grumpkin).
+ * via Shplonk. The opening proof for the reduced claim is produced in execute_opening_proof_round.
+ * @details The translation batching challenge is derived here, before the opening proof. The opening proof is written
+ * to the separate ipa_transcript, so this ordering does not change the main transcript, and it lets the Translator
+ * start as soon as this round is done.
  *
  */
 void ECCVMProver::execute_pcs_rounds()
@@ -119,7 +128,6 @@ void ECCVMProver::execute_pcs_rounds()
     using Curve = typename Flavor::Curve;
     using Shplemini = ShpleminiProver_<Curve>;
     using Shplonk = ShplonkProver_<Curve>;
-    using OpeningClaim = ProverOpeningClaim<Curve>;
 
     // Execute the Shplemini (Gemini + Shplonk) protocol to produce a univariate opening claim for the multilinear
     // evaluations produced by Sumcheck
@@ -181,13 +189,19 @@ void ECCVMProver::execute_pcs_rounds()
                                                          translation_opening_claim };
 
     // Reduce the opening claims to a single opening claim via Shplonk
-    const OpeningClaim batch_opening_claim = Shplonk::prove(key->commitment_key, opening_claims, transcript);
-
-    // Compute the opening proof for the batched opening claim with the univariate PCS
-    PCS::compute_opening_proof(key->commitment_key, batch_opening_claim, ipa_transcript);
+    batch_opening_claim = Shplonk::prove(key->commitment_key, opening_claims, transcript);
 
     // Produce another challenge passed as input to the translator verifier
     translation_batching_challenge_v = transcript->template get_challenge<FF>("Translation:batching_challenge");
+}
+
+/**
+ * @brief Compute the opening proof for the batched opening claim with the univariate PCS (IPA on Grumpkin)
+ *
+ */
+void ECCVMProver::execute_opening_proof_round()
+{
+    PCS::compute_opening_proof(key->commitment_key, batch_opening_claim, ipa_transcript);
 
     vinfo("computed opening proof");
 }
@@ -197,9 +211,14 @@ ECCVMProof ECCVMProver::export_proof()
     return { transcript->export_proof(), ipa_transcript->export_proof() };
 }
 
-ECCVMProof ECCVMProver::construct_proof()
+/**
+ * @brief Run every round up to the opening proof and export the main transcript
+ * @details After this the main transcript is no longer used by the ECCVM prover and may be handed to the Translator,
+ * while the opening proof is computed with construct_ipa_proof.
+ */
+HonkProof ECCVMProver::construct_pre_ipa_proof()
 {
-    PROFILE_THIS_NAME("ECCVMProver::construct_proof");
+    PROFILE_THIS_NAME("ECCVMProver::construct_pre_ipa_proof");
 
     execute_preamble_round();
 
@@ -213,6 +232,25 @@ ECCVMProof ECCVMProver::construct_proof()
 
     execute_pcs_rounds();
 
-    return export_proof();
+    return transcript->export_proof();
+}
+
+HonkProof ECCVMProver::construct_ipa_proof()
+{
+    PROFILE_THIS_NAME("ECCVMProver::construct_ipa_proof");
+
+    execute_opening_proof_round();
+
+    return ipa_transcript->export_proof();
+}
+
+ECCVMProof ECCVMProver::construct_proof()
+{
+    PROFILE_THIS_NAME("ECCVMProver::construct_proof");
+
+    HonkProof pre_ipa_proof = construct_pre_ipa_proof();
+    HonkProof ipa_proof = construct_ipa_proof();
+
+    return { pre_ipa_proof, ipa_proof };
 }
 } // namespace bb
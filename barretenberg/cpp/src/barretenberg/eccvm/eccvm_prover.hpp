@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/eccvm/eccvm_flavor.hpp"
 #include "barretenberg/goblin/translation_evaluations.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
@@ -25,6 +26,7 @@ class ECCVMProver {
     using Transcript = typename Flavor::Transcript;
     using TranslationEvaluations = bb::TranslationEvaluations_<FF, BF>;
     using CircuitBuilder = typename Flavor::CircuitBuilder;
+    using OpeningClaim = ProverOpeningClaim<typename Flavor::Curve>;
 
     explicit ECCVMProver(CircuitBuilder& builder,
                          const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>(),
@@ -36,9 +38,12 @@ class ECCVMProver {
     BB_PROFILE void execute_grand_product_computation_round();
     BB_PROFILE void execute_relation_check_rounds();
     BB_PROFILE void execute_pcs_rounds();
+    BB_PROFILE void execute_opening_proof_round();
     BB_PROFILE void execute_transcript_consistency_univariate_opening_round();
 
     ECCVMProof export_proof();
+    HonkProof construct_pre_ipa_proof();
+    HonkProof construct_ipa_proof();
     ECCVMProof construct_proof();
 
     std::shared_ptr<Transcript> transcript;
@@ -60,6 +65,8 @@ class ECCVMProver {
 
     Polynomial quotient_W;
 
+    OpeningClaim batch_opening_claim; // output of the Shplonk reduction, opened by execute_opening_proof_round
+
     FF evaluation_challenge_x;
     FF translation_batching_challenge_v; // to be rederived by the translator verifier
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/task_group.hpp"
 #include "barretenberg/eccvm/eccvm_circuit_builder.hpp"
 #include "barretenberg/eccvm/eccvm_prover.hpp"
 #include "barretenberg/eccvm/eccvm_trace_checker.hpp"
@@ -59,6 +60,10 @@ class GoblinProver {
     // on the first call to accumulate there is no merge proof to verify
     bool merge_proof_exists{ false };
 
+    // if set, prove() overlaps the Translator proof with the ECCVM opening proof (see prove_eccvm_and_translator). The
+    // ClientIVC prover sets it; it is off by default so that the sequential provers remain the reference path.
+    bool pipeline_eccvm_and_translator{ false };
+
     std::shared_ptr<ECCVMProvingKey> get_eccvm_proving_key() const { return eccvm_key; }
     std::shared_ptr<TranslatorProvingKey> get_translator_proving_key() const { return translator_prover->key; }
 
@@ -222,6 +227,63 @@ class GoblinProver {
         }
     }
 
+    /**
+     * @brief Construct the ECCVM and Translator proofs with the two provers running concurrently
+     * @details The Translator depends on the ECCVM only through the shared transcript and the challenges
+     * evaluation_challenge_x and translation_batching_challenge_v, all of which are fixed once the ECCVM Shplonk round
+     * is complete. The remaining ECCVM work, the IPA opening proof, writes to its own transcript. We therefore build
+     * the Translator circuit and prove it as a task on the work-stealing pool while the calling thread computes the IPA
+     * proof. The parallel_for calls of both provers queue their work on the same pool, whose threads steal from
+     * whichever prover has work left, so the thread budget is split between them without creating extra threads. The
+     * proofs are the same as those of prove_eccvm + prove_translator.
+     *
+     */
+    void prove_eccvm_and_translator()
+    {
+        {
+            PROFILE_THIS_NAME("Create ECCVMBuilder and ECCVMProver");
+
+            auto eccvm_builder = std::make_unique<ECCVMBuilder>(op_queue);
+            eccvm_prover = std::make_unique<ECCVMProver>(*eccvm_builder);
+        }
+        {
+            PROFILE_THIS_NAME("Construct ECCVM pre-IPA Proof");
+
+            goblin_proof.eccvm_proof.pre_ipa_proof = eccvm_prover->construct_pre_ipa_proof();
+            goblin_proof.translation_evaluations = eccvm_prover->translation_evaluations;
+        }
+
+        fq translation_batching_challenge_v = eccvm_prover->translation_batching_challenge_v;
+        fq evaluation_challenge_x = eccvm_prover->evaluation_challenge_x;
+        std::shared_ptr<Transcript> transcript = eccvm_prover->transcript;
+        eccvm_key = eccvm_prover->key;
+
+        // If the IPA proof throws, the destructor of translator_task waits for the task before the exception propagates
+        TaskGroup translator_task;
+        translator_task.spawn([&]() {
+            {
+                PROFILE_THIS_NAME("Create TranslatorBuilder and TranslatorProver");
+
+                auto translator_builder = std::make_unique<TranslatorBuilder>(
+                    translation_batching_challenge_v, evaluation_challenge_x, op_queue);
+                translator_prover = std::make_unique<TranslatorProver>(*translator_builder, transcript, commitment_key);
+            }
+            {
+                PROFILE_THIS_NAME("Construct Translator Proof");
+
+                goblin_proof.translator_proof = translator_prover->construct_proof();
+            }
+        });
+        {
+            PROFILE_THIS_NAME("Construct ECCVM IPA Proof");
+
+            goblin_proof.eccvm_proof.ipa_proof = eccvm_prover->construct_ipa_proof();
+        }
+        // Rethrows any exception thrown by the Translator task
+        translator_task.sync();
+        eccvm_prover = nullptr;
+    }
+
     /**
      * @brief Constuct a full Goblin proof (ECCVM, Translator, merge)
      * @details The merge proof is assumed to already have been constucted in the last accumulate step. It is simply
@@ -235,6 +297,13 @@ class GoblinProver {
         PROFILE_THIS_NAME("Goblin::prove");
 
         goblin_proof.merge_proof = merge_proof_in.empty() ? std::move(merge_proof) : std::move(merge_proof_in);
+        if (pipeline_eccvm_and_translator) {
+            PROFILE_THIS_NAME("prove_eccvm_and_translator");
+            vinfo("prove eccvm and translator...");
+            prove_eccvm_and_translator();
+            vinfo("finished eccvm and translator proving.");
+            return goblin_proof;
+        }
         {
             PROFILE_THIS_NAME("prove_eccvm");
             vinfo("prove eccvm...");
@@ -1,4 +1,10 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
 #include <typeinfo>
 
 namespace bb {
@@ -21,40 +27,80 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The relation lists the columns it reads: `get_inverse_input_entities` are the columns of the read and write terms
+ * and of `operation_exists_at_row`, and `get_inverse_selector_entities` those of them of which at least one is
+ * non-zero at a row with an operation. Only the input columns are copied into the row values, rather than the whole
+ * row of `get_row`, and only the rows within the backed range of a selector can have an operation. These rows are
+ * split into a chunk per thread, each of which batch inverts its part of the inverse polynomial.
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
 {
     using FF = typename Flavor::FF;
+    using AllValues = typename Flavor::AllValues;
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+    const auto& const_polynomials = polynomials;
+    const auto columns = Relation::get_inverse_input_entities(const_polynomials);
+    constexpr size_t NUM_COLUMNS = std::tuple_size_v<decltype(columns)>;
+
+    // The selectors are all zero outside of their backed ranges, and the inverse can only be written where it is backed
+    size_t start = circuit_size;
+    size_t end = 0;
+    const auto extend_active_range = [&](const auto& selector) {
+        if (!selector.is_empty()) {
+            start = std::min(start, selector.start_index());
+            end = std::max(end, selector.end_index());
         }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial.at(i) = denominator;
     };
+    std::apply([&](const auto&... selector) { (extend_active_range(selector), ...); },
+               Relation::get_inverse_selector_entities(const_polynomials));
+    start = std::max(start, inverse_polynomial.start_index());
+    end = std::min({ end, inverse_polynomial.end_index(), circuit_size });
+    if (start >= end) {
+        return;
+    }
 
-    // Compute inverse polynomial I in place by inverting the product at each row
-    // Note: zeroes are ignored as they are not used anyway
-    FF::batch_invert(inverse_polynomial.coeffs());
+    // A row copies its columns and computes the product of the terms if it has an operation
+    constexpr size_t ROW_COST = (NUM_COLUMNS * thread_heuristics::FF_COPY_COST) +
+                                ((READ_TERMS + WRITE_TERMS + 3) * thread_heuristics::FF_MULTIPLICATION_COST);
+    parallel_for_heuristic(
+        end - start,
+        [&](size_t chunk_start, size_t chunk_end, BB_UNUSED size_t chunk_index) {
+            // The values of the columns which are not inputs are left uninitialized and never read, so that a chunk
+            // does not zero the whole row of the flavor
+            auto row = std::make_unique_for_overwrite<AllValues>();
+            auto row_columns = Relation::get_inverse_input_entities(*row);
+            for (size_t i = start + chunk_start; i < start + chunk_end; ++i) {
+                bb::constexpr_for<0, NUM_COLUMNS, 1>([&]<size_t column_index>() {
+                    std::get<column_index>(row_columns) = std::get<column_index>(columns)[i];
+                });
+                if (!Relation::operation_exists_at_row(*row)) {
+                    continue;
+                }
+                FF denominator = 1;
+                bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                    auto denominator_term =
+                        Relation::template compute_read_term<Accumulator, read_index>(*row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                    auto denominator_term =
+                        Relation::template compute_write_term<Accumulator, write_index>(*row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                inverse_polynomial.at(i) = denominator;
+            }
+
+            // Compute inverse polynomial I in place by inverting the product at each row of the chunk
+            // Note: zeroes are ignored as they are not used anyway
+            FF::batch_invert(inverse_polynomial.coeffs().subspan(start + chunk_start - inverse_polynomial.start_index(),
+                                                                 chunk_end - chunk_start));
+        },
+        ROW_COST);
 }
 
 /**
@@ -3,6 +3,7 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_vec.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
 #include <math.h>
@@ -30,6 +31,13 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #endif
 }
 
+// The chunk of data processed by thread j of the domain, for the batch kernels of field_vec
+template <typename T, typename Fr>
+std::span<T> thread_chunk(T* data, const EvaluationDomain<Fr>& domain, const size_t j)
+{
+    return { data + j * domain.thread_size, domain.thread_size };
+}
+
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -546,9 +554,10 @@ template <typename Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
     fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const auto chunk = thread_chunk(coeffs, domain, j);
+        field_vec<typename Fr::Params>::mul(chunk, chunk, domain.domain_inverse);
+    });
 }
 
 template <typename Fr>
@@ -556,9 +565,10 @@ template <typename Fr>
 void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
     fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    target[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const auto chunk = thread_chunk(target, domain, j);
+        field_vec<typename Fr::Params>::mul(chunk, chunk, domain.domain_inverse);
+    });
 }
 
 template <typename Fr>
@@ -574,9 +584,16 @@ void ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i >> log2_poly_size][i & poly_mask] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        // The chunk of the thread may span several polynomials
+        const size_t end = (j + 1) * domain.thread_size;
+        for (size_t i = j * domain.thread_size; i < end;) {
+            const size_t size = std::min(end - i, poly_size - (i & poly_mask));
+            std::span<Fr> chunk(&coeffs[i >> log2_poly_size][i & poly_mask], size);
+            field_vec<typename Fr::Params>::mul(chunk, chunk, domain.domain_inverse);
+            i += size;
+        }
+    });
 }
 
 template <typename Fr>
@@ -584,9 +601,10 @@ template <typename Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
     fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= value;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const auto chunk = thread_chunk(coeffs, domain, j);
+        field_vec<typename Fr::Params>::mul(chunk, chunk, value);
+    });
 }
 
 template <typename Fr>
@@ -706,9 +724,10 @@ void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr
 {
     fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
     Fr T0 = domain.domain_inverse * value;
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= T0;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const auto chunk = thread_chunk(coeffs, domain, j);
+        field_vec<typename Fr::Params>::mul(chunk, chunk, T0);
+    });
 }
 
 template <typename Fr>
@@ -740,9 +759,10 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
-    ITERATE_OVER_DOMAIN_START(domain);
-    r_coeffs[i] = a_coeffs[i] + b_coeffs[i];
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        field_vec<typename Fr::Params>::add(
+            thread_chunk(r_coeffs, domain, j), thread_chunk(a_coeffs, domain, j), thread_chunk(b_coeffs, domain, j));
+    });
 }
 
 template <typename Fr>
@@ -756,9 +776,10 @@ void sub(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 template <typename Fr>
 void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
-    ITERATE_OVER_DOMAIN_START(domain);
-    r_coeffs[i] = a_coeffs[i] * b_coeffs[i];
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        field_vec<typename Fr::Params>::mul(
+            thread_chunk(r_coeffs, domain, j), thread_chunk(a_coeffs, domain, j), thread_chunk(b_coeffs, domain, j));
+    });
 }
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
@@ -3,7 +3,6 @@
 #include <tuple>
 
 #include "barretenberg/common/constexpr_utils.hpp"
-#include "barretenberg/common/thread.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 
@@ -219,59 +218,63 @@ template <typename FF_> class DatabusLookupRelationImpl {
     }
 
     /**
-     * @brief Construct the polynomial I whose components are the inverse of the product of the read and write terms
-     * @details If the denominators of log derivative lookup relation are read_term and write_term, then I_i =
-     * (read_term_i*write_term_i)^{-1}.
-     * @note Importantly, I_i = 0 for rows i at which there is no read or write, so the cost of this method is
+     * @brief The lookup from the bus column bus_idx, in the form of a relation with a single read and write term for
+     * compute_logderivative_inverse
+     * @note The inverse I_i is 0 at rows at which there is no read or write, so the cost of computing it is
      * proportional to the actual databus usage.
-     *
      */
-    template <size_t bus_idx, typename Polynomials>
-    static void compute_logderivative_inverse(Polynomials& polynomials,
-                                              auto& relation_parameters,
-                                              const size_t circuit_size)
-    {
-        PROFILE_THIS_NAME("Databus::compute_logderivative_inverse");
-        auto& inverse_polynomial = BusData<bus_idx, Polynomials>::inverses(polynomials);
-
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(circuit_size, min_iterations_per_thread);
-        size_t iterations_per_thread = circuit_size / num_threads; // actual iterations per thread
-
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-            bool is_read = false;
-            bool nonzero_read_count = false;
-            for (size_t i = start; i < end; ++i) {
-                // Determine if the present row contains a databus operation
-                auto q_busread = polynomials.q_busread[i];
-                if constexpr (bus_idx == 0) { // calldata
-                    is_read = q_busread == 1 && polynomials.q_l[i] == 1;
-                    nonzero_read_count = polynomials.calldata_read_counts[i] > 0;
-                }
-                if constexpr (bus_idx == 1) { // secondary_calldata
-                    is_read = q_busread == 1 && polynomials.q_r[i] == 1;
-                    nonzero_read_count = polynomials.secondary_calldata_read_counts[i] > 0;
-                }
-                if constexpr (bus_idx == 2) { // return data
-                    is_read = q_busread == 1 && polynomials.q_o[i] == 1;
-                    nonzero_read_count = polynomials.return_data_read_counts[i] > 0;
-                }
-                // We only compute the inverse if this row contains a read gate or data that has been read
-                if (is_read || nonzero_read_count) {
-                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                    auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                    auto value = compute_read_term<FF>(row, relation_parameters) *
-                                 compute_write_term<FF, bus_idx>(row, relation_parameters);
-                    inverse_polynomial.at(i) = value;
-                }
+    template <size_t bus_idx> struct BusColumnLookup {
+        using ValueAccumulator0 = FF;
+        static constexpr size_t READ_TERMS = 1;
+        static constexpr size_t WRITE_TERMS = 1;
+
+        template <typename AllEntities> static auto& get_inverse_polynomial(AllEntities& in)
+        {
+            return BusData<bus_idx, AllEntities>::inverses(in);
+        }
+
+        template <typename AllEntities> static auto get_inverse_input_entities(AllEntities& in)
+        {
+            return std::tuple_cat(std::forward_as_tuple(in.q_busread, in.w_l, in.w_r, in.databus_id),
+                                  get_bus_column_entities(in));
+        }
+
+        // A read gate has q_busread on, and data which is read has its read tag on
+        template <typename AllEntities> static auto get_inverse_selector_entities(AllEntities& in)
+        {
+            return std::forward_as_tuple(in.q_busread, std::get<1>(get_bus_column_entities(in)));
+        }
+
+        // The column selector, read tags and values of the bus column
+        template <typename AllEntities> static auto get_bus_column_entities(AllEntities& in)
+        {
+            if constexpr (bus_idx == 0) { // calldata
+                return std::forward_as_tuple(in.q_l, in.calldata_read_tags, in.calldata);
             }
-        });
-
-        // Compute inverse polynomial I in place by inverting the product at each row
-        // Note: zeroes are ignored as they are not used anyway
-        FF::batch_invert(inverse_polynomial.coeffs());
+            if constexpr (bus_idx == 1) { // secondary_calldata
+                return std::forward_as_tuple(in.q_r, in.secondary_calldata_read_tags, in.secondary_calldata);
+            }
+            if constexpr (bus_idx == 2) { // return data
+                return std::forward_as_tuple(in.q_o, in.return_data_read_tags, in.return_data);
+            }
+        }
+
+        template <typename AllValues> static bool operation_exists_at_row(const AllValues& row)
+        {
+            return DatabusLookupRelationImpl::operation_exists_at_row<bus_idx>(row);
+        }
+
+        template <typename Accumulator, size_t read_index, typename AllEntities, typename Parameters>
+        static Accumulator compute_read_term(const AllEntities& in, const Parameters& params)
+        {
+            return DatabusLookupRelationImpl::compute_read_term<Accumulator>(in, params);
+        }
+
+        template <typename Accumulator, size_t write_index, typename AllEntities, typename Parameters>
+        static Accumulator compute_write_term(const AllEntities& in, const Parameters& params)
+        {
+            return DatabusLookupRelationImpl::compute_write_term<Accumulator, bus_idx>(in, params);
+        }
     };
 
     /**
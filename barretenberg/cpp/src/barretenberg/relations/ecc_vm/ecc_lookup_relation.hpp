@@ -51,6 +51,44 @@ polynomials,
      */
     template <typename AllEntities> static auto& get_inverse_polynomial(AllEntities& in) { return in.lookup_inverses; }
 
+    /**
+     * @brief Get the polynomials the inverse polynomial is computed from (see compute_logderivative_inverse)
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_input_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.msm_add,
+                                     in.msm_skew,
+                                     in.precompute_select,
+                                     in.precompute_pc,
+                                     in.precompute_tx,
+                                     in.precompute_ty,
+                                     in.precompute_round,
+                                     in.msm_pc,
+                                     in.msm_count,
+                                     in.msm_slice1,
+                                     in.msm_slice2,
+                                     in.msm_slice3,
+                                     in.msm_slice4,
+                                     in.msm_x1,
+                                     in.msm_x2,
+                                     in.msm_x3,
+                                     in.msm_x4,
+                                     in.msm_y1,
+                                     in.msm_y2,
+                                     in.msm_y3,
+                                     in.msm_y4);
+    }
+
+    /**
+     * @brief Get the selectors of the reads and writes, at least one of which is on at a row with an operation
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_selector_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.msm_add, in.msm_skew, in.precompute_select);
+    }
+
     template <typename Accumulator, typename AllEntities>
     static Accumulator compute_inverse_exists(const AllEntities& in)
     {
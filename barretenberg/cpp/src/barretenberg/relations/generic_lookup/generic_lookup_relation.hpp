@@ -228,6 +228,31 @@ template <typename Settings, typename FF_> class GenericLookupRelationImpl {
         return std::get<INVERSE_POLYNOMIAL_INDEX>(Settings::get_nonconst_entities(in));
     }
 
+    /**
+     * @brief Get all the polynomials the inverse polynomial is computed from (see compute_logderivative_inverse)
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_input_entities(AllEntities& in)
+    {
+        if constexpr (std::is_const_v<AllEntities>) {
+            return Settings::get_const_entities(in);
+        } else {
+            return Settings::get_nonconst_entities(in);
+        }
+    }
+
+    /**
+     * @brief Get the predicates of the read and write terms, at least one of which is on at a row with an operation
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_selector_entities(AllEntities& in)
+    {
+        return [&]<size_t... predicate_index>(std::index_sequence<predicate_index...>) {
+            return std::forward_as_tuple(std::get<LOOKUP_READ_TERM_PREDICATE_START_POLYNOMIAL_INDEX + predicate_index>(
+                Settings::get_const_entities(in))...);
+        }(std::make_index_sequence<READ_TERMS + WRITE_TERMS>());
+    }
+
     /**
      * @brief Get selector/wire switching on(1) or off(0) inverse computation
      *
@@ -78,6 +78,30 @@ template <typename Settings, typename FF_> class GenericPermutationRelationImpl
         return std::get<INVERSE_POLYNOMIAL_INDEX>(Settings::get_nonconst_entities(in));
     }
 
+    /**
+     * @brief Get all the polynomials the inverse polynomial is computed from (see compute_logderivative_inverse)
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_input_entities(AllEntities& in)
+    {
+        if constexpr (std::is_const_v<AllEntities>) {
+            return Settings::get_const_entities(in);
+        } else {
+            return Settings::get_nonconst_entities(in);
+        }
+    }
+
+    /**
+     * @brief Get the polynomials enabling the two sets, at least one of which is on at a row with an operation
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_selector_entities(AllEntities& in)
+    {
+        const auto entities = Settings::get_const_entities(in);
+        return std::forward_as_tuple(std::get<FIRST_PERMUTATION_SET_ENABLE_POLYNOMIAL_INDEX>(entities),
+                                     std::get<SECOND_PERMUTATION_SET_ENABLE_POLYNOMIAL_INDEX>(entities));
+    }
+
     /**
      * @brief Get selector/wire switching on(1) or off(0) inverse computation
      * We turn it on if either of the permutation contribution selectors are active
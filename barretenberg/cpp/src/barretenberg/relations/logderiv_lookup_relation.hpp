@@ -3,7 +3,6 @@
 #include <tuple>
 
 #include "barretenberg/common/constexpr_utils.hpp"
-#include "barretenberg/common/thread.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/relations/relation_types.hpp"
@@ -66,6 +65,39 @@ template <typename FF_> class LogDerivLookupRelationImpl {
     // Get the inverse polynomial for this relation
     template <typename AllEntities> static auto& get_inverse_polynomial(AllEntities& in) { return in.lookup_inverses; }
 
+    /**
+     * @brief Get the polynomials the inverse polynomial is computed from (see compute_logderivative_inverse)
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_input_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.q_lookup,
+                                     in.lookup_read_tags,
+                                     in.table_1,
+                                     in.table_2,
+                                     in.table_3,
+                                     in.table_4,
+                                     in.w_l,
+                                     in.w_r,
+                                     in.w_o,
+                                     in.w_l_shift,
+                                     in.w_r_shift,
+                                     in.w_o_shift,
+                                     in.q_o,
+                                     in.q_r,
+                                     in.q_m,
+                                     in.q_c);
+    }
+
+    /**
+     * @brief Get the selectors of the lookup gates and of the table entries which are read
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_selector_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.q_lookup, in.lookup_read_tags);
+    }
+
     // Used in the inverse correctness subrelation; facilitates only computing inverses where necessary
     template <typename Accumulator, typename AllEntities>
     static Accumulator compute_inverse_exists(const AllEntities& in)
@@ -143,45 +175,6 @@ template <typename FF_> class LogDerivLookupRelationImpl {
                table_index * eta_three;
     }
 
-    /**
-     * @brief Construct the polynomial I whose components are the inverse of the product of the read and write terms
-     * @details If the denominators of log derivative lookup relation are read_term and write_term, then I_i =
-     * (read_term_i*write_term_i)^{-1}.
-     * @note Importantly, I_i = 0 for rows i at which there is no read or write, so the cost of this method is
-     * proportional to the actual number of lookups.
-     *
-     */
-    template <typename Polynomials>
-    static void compute_logderivative_inverse(Polynomials& polynomials,
-                                              auto& relation_parameters,
-                                              const size_t circuit_size)
-    {
-        PROFILE_THIS_NAME("Lookup::compute_logderivative_inverse");
-        auto& inverse_polynomial = get_inverse_polynomial(polynomials);
-
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(circuit_size, min_iterations_per_thread);
-        size_t iterations_per_thread = circuit_size / num_threads; // actual iterations per thread
-
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-            for (size_t i = start; i < end; ++i) {
-                // We only compute the inverse if this row contains a lookup gate or data that has been looked up
-                if (polynomials.q_lookup.get(i) == 1 || polynomials.lookup_read_tags.get(i) == 1) {
-                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-                    auto row = polynomials.get_row(i); // Note: this is a copy. use sparingly!
-                    auto value = compute_read_term<FF, 0>(row, relation_parameters) *
-                                 compute_write_term<FF, 0>(row, relation_parameters);
-                    inverse_polynomial.at(i) = value;
-                }
-            }
-        });
-
-        // Compute inverse polynomial I in place by inverting the product at each row
-        FF::batch_invert(inverse_polynomial.coeffs());
-    };
-
     /**
      * @brief Log-derivative style lookup argument for conventional lookups form tables with 3 or fewer columns
      * @details The identity to be checked is of the form
@@ -52,4 +52,17 @@ using TupleOfValues = typename TupleOfContainersOverArray<ExtractValueType, FF,
 
 template <typename FF, auto LENGTHS> using ArrayOfValues = HomogeneousTupleToArray<TupleOfValues<FF, LENGTHS>>;
 
+/**
+ * @brief The type of a univariate, or of a (nested) tuple of univariates, with values of type ValueType instead, e.g.
+ * to accumulate the relations over packs of field elements.
+ */
+template <typename Container, typename ValueType> struct RebindUnivariates;
+template <typename FF, size_t domain_end, size_t domain_start, size_t skip_count, typename ValueType>
+struct RebindUnivariates<Univariate<FF, domain_end, domain_start, skip_count>, ValueType> {
+    using type = Univariate<ValueType, domain_end, domain_start, skip_count>;
+};
+template <typename... Containers, typename ValueType> struct RebindUnivariates<std::tuple<Containers...>, ValueType> {
+    using type = std::tuple<typename RebindUnivariates<Containers, ValueType>::type...>;
+};
+
 } // namespace bb
\ No newline at end of file
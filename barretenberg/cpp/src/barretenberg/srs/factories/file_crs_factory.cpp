@@ -8,6 +8,13 @@
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace bb::srs::factories {
 
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
@@ -47,6 +54,65 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
     return num_points;
 }
 
+template <typename Curve>
+std::shared_ptr<MappedProverCrs<Curve>> MappedProverCrs<Curve>::map(const size_t num_points, std::string const& dir)
+{
+#ifdef __wasm__
+    static_cast<void>(num_points);
+    static_cast<void>(dir);
+    return nullptr;
+#else
+    PROFILE_THIS_NAME("MappedProverCrs::map");
+
+    const std::string path = srs::IO<Curve>::get_point_table_path(dir);
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(PointTableHeader)) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const auto& header = *static_cast<PointTableHeader const*>(mapping);
+    if (header.num_points < num_points || !srs::IO<Curve>::is_valid_point_table_header(header, file_size, dir)) {
+        munmap(mapping, file_size);
+        return nullptr;
+    }
+    // Expose only the requested degree, like FileProverCrs, even though the whole table is mapped
+    return std::make_shared<MappedProverCrs>(mapping, file_size, num_points);
+#endif
+}
+
+template <typename Curve>
+MappedProverCrs<Curve>::MappedProverCrs(void* mapping, const size_t mapping_size, const size_t num_points)
+    : mapping(mapping)
+    , mapping_size(mapping_size)
+    , num_points(num_points)
+{}
+
+template <typename Curve> MappedProverCrs<Curve>::~MappedProverCrs()
+{
+#ifndef __wasm__
+    munmap(mapping, mapping_size);
+#endif
+}
+
+template <typename Curve> std::span<typename Curve::AffineElement> MappedProverCrs<Curve>::get_monomial_points()
+{
+    auto* points = reinterpret_cast<typename Curve::AffineElement*>(static_cast<char*>(mapping) +
+                                                                     sizeof(PointTableHeader));
+    return { points, num_points * 2 };
+}
+
 template <typename Curve>
 FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
     : path_(std::move(path))
@@ -60,13 +126,43 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
     PROFILE_THIS();
 
     if (prover_degree_ < degree || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = load_prover_crs(degree);
         prover_degree_ = degree;
-        vinfo("Initialized ", Curve::name, " prover CRS from file of size ", degree);
     }
     return prover_crs_;
 }
 
+template <typename Curve>
+std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::load_prover_crs(size_t degree)
+{
+    if (auto mapped_crs = MappedProverCrs<Curve>::map(degree, path_)) {
+        vinfo("Mapped ", Curve::name, " prover CRS point table of size ", mapped_crs->get_monomial_size());
+        return mapped_crs;
+    }
+
+    auto file_crs = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+    vinfo("Initialized ", Curve::name, " prover CRS from file of size ", degree);
+    return file_crs;
+}
+
+template <typename Curve> bool FileCrsFactory<Curve>::write_point_table(size_t degree)
+{
+#ifdef __wasm__
+    static_cast<void>(degree);
+    return false;
+#else
+    PROFILE_THIS();
+
+    FileProverCrs<Curve> file_crs(degree, path_);
+    if (!srs::IO<Curve>::write_point_table(file_crs.get_monomial_points().data(), degree, path_)) {
+        info("Could not write ", Curve::name, " prover CRS point table to ", path_);
+        return false;
+    }
+    vinfo("Wrote ", Curve::name, " prover CRS point table of size ", degree);
+    return true;
+#endif
+}
+
 template <typename Curve>
 std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::get_verifier_crs(size_t degree)
 {
@@ -80,6 +176,8 @@ std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::g
 
 template class FileProverCrs<curve::BN254>;
 template class FileProverCrs<curve::Grumpkin>;
+template class MappedProverCrs<curve::BN254>;
+template class MappedProverCrs<curve::Grumpkin>;
 template class FileCrsFactory<curve::BN254>;
 template class FileCrsFactory<curve::Grumpkin>;
 
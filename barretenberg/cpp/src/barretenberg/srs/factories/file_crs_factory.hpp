@@ -12,6 +12,9 @@ namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ * The prover CRS is memory-mapped from a preprocessed point table (<path>/monomial/point_table.dat) when one exists
+ * which is large enough and was built from the transcripts in the directory; otherwise it is read from the
+ * transcripts. The point table is only ever written by an explicit call to write_point_table.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
@@ -22,7 +25,16 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
 
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> get_verifier_crs(size_t degree = 0) override;
 
+    /**
+     * @brief Build the pippenger point table of the first degree points of the transcripts and write it to
+     * <path>/monomial/point_table.dat, so that subsequent prover CRS loads map it
+     * @return false if the table could not be written, e.g. as the directory is read-only (always false in wasm)
+     */
+    bool write_point_table(size_t degree);
+
   private:
+    std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> load_prover_crs(size_t degree);
+
     std::string path_;
     size_t prover_degree_;
     size_t verifier_degree_;
@@ -69,6 +81,38 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
 };
 
+/**
+ * @brief A prover CRS backed by a copy-on-write memory mapping of a preprocessed point table file
+ * @details The file (see PointTableHeader) already holds the pippenger point table in its in-memory layout, so
+ * construction is a single mmap: no parsing, byteswapping or endomorphism computation, and pages are faulted in on
+ * first use by the MSM. The mapping is MAP_PRIVATE, so several prover processes on one machine share the same page
+ * cache pages for the SRS as long as they only read the points. A write through get_monomial_points() copies the page
+ * it touches into the process and never reaches the file.
+ */
+template <typename Curve> class MappedProverCrs : public ProverCrs<Curve> {
+  public:
+    /**
+     * @brief Map the point table in dir if it exists, is valid for this curve and host, was built from the transcripts
+     * in dir, and holds at least num_points points. Returns nullptr otherwise (or when memory mapping is unavailable,
+     * as in wasm builds).
+     */
+    static std::shared_ptr<MappedProverCrs> map(size_t num_points, std::string const& dir);
+
+    MappedProverCrs(void* mapping, size_t mapping_size, size_t num_points);
+    MappedProverCrs(const MappedProverCrs&) = delete;
+    MappedProverCrs& operator=(const MappedProverCrs&) = delete;
+    ~MappedProverCrs();
+
+    std::span<typename Curve::AffineElement> get_monomial_points() override;
+
+    size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    void* mapping;
+    size_t mapping_size;
+    size_t num_points;
+};
+
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
   public:
     FileVerifierCrs(std::string const& path, const size_t num_points);
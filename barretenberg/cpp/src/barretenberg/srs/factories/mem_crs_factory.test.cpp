@@ -4,6 +4,8 @@
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include "file_crs_factory.hpp"
+#include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 
@@ -74,3 +76,56 @@ TEST(reference_string, mem_grumpkin_file_consistency)
                      sizeof(Grumpkin::AffineElement) * 1024 * 2),
               0);
 }
+
+TEST(reference_string, file_crs_maps_point_table)
+{
+    const size_t num_points = 1024;
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "bb_mapped_crs_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir / "monomial");
+
+    // Write a small transcript of random points.
+    std::vector<Grumpkin::AffineElement> points(num_points);
+    for (auto& point : points) {
+        point = Grumpkin::AffineElement::random_element();
+    }
+    ::srs::Manifest manifest{ 0, 1, static_cast<uint32_t>(num_points), 0, static_cast<uint32_t>(num_points), 0, 0 };
+    ::srs::IO<Grumpkin>::write_transcript(points.data(), manifest, dir.string());
+    MemGrumpkinCrsFactory mem_crs(points);
+    auto mem_prover_crs = mem_crs.get_prover_crs(num_points);
+
+    // Loading the prover CRS reads the transcript, and leaves the directory as it is.
+    auto file_prover_crs = FileCrsFactory<Grumpkin>(dir.string()).get_prover_crs(num_points);
+    for (size_t i = 0; i < num_points * 2; ++i) {
+        EXPECT_EQ(mem_prover_crs->get_monomial_points()[i], file_prover_crs->get_monomial_points()[i]);
+    }
+    EXPECT_FALSE(std::filesystem::exists(dir / "monomial" / "point_table.dat"));
+    EXPECT_EQ(MappedProverCrs<Grumpkin>::map(num_points, dir.string()), nullptr);
+
+    // Once the point table is written, loads map it as long as it is large enough.
+    EXPECT_TRUE(FileCrsFactory<Grumpkin>(dir.string()).write_point_table(num_points));
+    auto mapped_prover_crs = MappedProverCrs<Grumpkin>::map(num_points / 2, dir.string());
+    ASSERT_NE(mapped_prover_crs, nullptr);
+    EXPECT_EQ(mapped_prover_crs->get_monomial_size(), num_points / 2);
+    EXPECT_EQ(memcmp(file_prover_crs->get_monomial_points().data(),
+                     mapped_prover_crs->get_monomial_points().data(),
+                     sizeof(Grumpkin::AffineElement) * num_points),
+              0);
+    EXPECT_EQ(MappedProverCrs<Grumpkin>::map(num_points * 2, dir.string()), nullptr);
+    // A point table for another curve is rejected.
+    EXPECT_EQ(MappedProverCrs<BN254>::map(num_points, dir.string()), nullptr);
+
+    // Writing to the mapped points does not change the file.
+    mapped_prover_crs->get_monomial_points()[0] = Grumpkin::AffineElement::infinity();
+    EXPECT_EQ(MappedProverCrs<Grumpkin>::map(num_points, dir.string())->get_monomial_points()[0],
+              file_prover_crs->get_monomial_points()[0]);
+
+    // A point table built from an earlier version of the transcript is rejected.
+    const std::filesystem::path transcript_path = dir / "monomial" / "transcript00.dat";
+    const auto last_write_time = std::filesystem::last_write_time(transcript_path);
+    ::srs::IO<Grumpkin>::write_transcript(points.data(), manifest, dir.string());
+    std::filesystem::last_write_time(transcript_path, last_write_time + std::chrono::seconds(10));
+    EXPECT_EQ(MappedProverCrs<Grumpkin>::map(num_points, dir.string()), nullptr);
+
+    std::filesystem::remove_all(dir);
+}
@@ -3,9 +3,13 @@
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
 #include <concepts>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <optional>
 #include <string>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace bb::srs {
 /**
@@ -45,6 +49,44 @@ struct Manifest {
     uint32_t start_from;
 };
 
+/**
+ * @brief The header of a preprocessed point table file
+ *
+ * @details A point table file holds the pippenger point table built from the first num_points SRS elements (the raw
+ * elements P_i at even indices and the endomorphism points at odd indices), stored exactly as it is laid out in memory:
+ * affine coordinates in Montgomery form and native byte order. This lets the prover memory-map the file and use it in
+ * place, with no byteswapping, Montgomery conversion or endomorphism computation at startup.
+ *
+ * 00   | XX XX XX XX XX XX XX XX | Magic ("BBPTABLE")
+ * 08   | XX XX XX XX             | Format version
+ * 0C   | XX XX XX XX             | Byte order mark (0x01020304 written in native byte order)
+ * 10   | XX XX XX XX XX XX XX XX | Size of a single affine element in bytes
+ * 18   | XX XX XX XX XX XX XX XX | The number of SRS points (num_points); the table holds 2 * num_points elements
+ * 20   | XX XX XX XX XX XX XX XX | Fingerprint of the transcript files the points were read from
+ * 28   | XX ...                  | Null-terminated curve name, padded to 24 bytes
+ * 40   | XX ...                  | 2 * num_points affine elements
+ *
+ * The header is 64 bytes so that the elements stay cache-line aligned within a page-aligned mapping.
+ *
+ * The fingerprint hashes the inode, size and modification time of each transcript file holding the first num_points
+ * points, so that a table is not used anymore once the transcripts it was built from are replaced or updated.
+ */
+struct PointTableHeader {
+    static constexpr uint64_t MAGIC = 0x454c424154504242; // "BBPTABLE" read as a little endian word
+    static constexpr uint32_t VERSION = 2;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr size_t CURVE_NAME_LENGTH = 24;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t byte_order_mark;
+    uint64_t element_size;
+    uint64_t num_points;
+    uint64_t transcript_fingerprint;
+    char curve_name[CURVE_NAME_LENGTH];
+};
+static_assert(sizeof(PointTableHeader) == 64);
+
 // Detect whether a curve has a G2AffineElement defined
 template <typename Curve>
 concept HasG2 = requires { typename Curve::G2AffineElement; };
@@ -431,6 +473,111 @@ template <typename Curve> class IO {
         write_elements_to_buffer<AffineElement>(g1_x, &buffer[manifest_size], num_g1_x);
         write_buffer_to_file(path, &buffer[0], transcript_size);
     }
+
+    static std::string get_point_table_path(std::string const& dir) { return format(dir, "/monomial/point_table.dat"); }
+
+    /**
+     * @brief Fingerprint the transcript files in dir which hold the first num_points points, by hashing (FNV-1a) the
+     * inode, size and modification time of each of them. Returns std::nullopt if they do not hold num_points points.
+     */
+    static std::optional<uint64_t> get_transcript_fingerprint(std::string const& dir, size_t num_points)
+    {
+        constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325;
+        constexpr uint64_t FNV_PRIME = 0x100000001b3;
+        uint64_t fingerprint = FNV_OFFSET_BASIS;
+        const auto hash_word = [&](uint64_t word) {
+            for (size_t i = 0; i < sizeof(word); ++i) {
+                fingerprint = (fingerprint ^ ((word >> (8 * i)) & 0xff)) * FNV_PRIME;
+            }
+        };
+
+        size_t num = 0;
+        size_t num_read = 0;
+        while (num_read < num_points) {
+            const std::string path = get_transcript_path(dir, num);
+            struct stat st;
+            if (stat(path.c_str(), &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Manifest)) {
+                return std::nullopt;
+            }
+            Manifest manifest;
+            read_manifest(path, manifest);
+            if (manifest.num_g1_points == 0) {
+                return std::nullopt;
+            }
+
+            hash_word(num);
+            hash_word(static_cast<uint64_t>(st.st_ino));
+            hash_word(static_cast<uint64_t>(st.st_size));
+            hash_word(static_cast<uint64_t>(st.st_mtime));
+            num_read += manifest.num_g1_points;
+            ++num;
+        }
+        return fingerprint;
+    }
+
+    static PointTableHeader make_point_table_header(size_t num_points, uint64_t transcript_fingerprint)
+    {
+        PointTableHeader header{};
+        header.magic = PointTableHeader::MAGIC;
+        header.version = PointTableHeader::VERSION;
+        header.byte_order_mark = PointTableHeader::BYTE_ORDER_MARK;
+        header.element_size = sizeof(AffineElement);
+        header.num_points = num_points;
+        header.transcript_fingerprint = transcript_fingerprint;
+        strncpy(header.curve_name, Curve::name, PointTableHeader::CURVE_NAME_LENGTH - 1);
+        return header;
+    }
+
+    /**
+     * @brief Check that a point table header was written for this curve by a host with the same memory layout, from
+     * the transcripts which are in dir now, and that a file of file_size bytes holds the whole table it describes.
+     */
+    static bool is_valid_point_table_header(PointTableHeader const& header, size_t file_size, std::string const& dir)
+    {
+        const PointTableHeader expected = make_point_table_header(header.num_points, header.transcript_fingerprint);
+        if (header.magic != expected.magic || header.version != expected.version ||
+            header.byte_order_mark != expected.byte_order_mark || header.element_size != expected.element_size ||
+            strncmp(header.curve_name, expected.curve_name, PointTableHeader::CURVE_NAME_LENGTH) != 0) {
+            return false;
+        }
+        if (file_size < sizeof(PointTableHeader) + sizeof(AffineElement) * 2 * header.num_points) {
+            return false;
+        }
+        return get_transcript_fingerprint(dir, header.num_points) == header.transcript_fingerprint;
+    }
+
+    /**
+     * @brief Write a pippenger point table of num_points SRS points, read from the transcripts in dir, to
+     * <dir>/monomial/point_table.dat
+     * @details The table is written to a temporary file which is then renamed into place, so that concurrent readers
+     * never observe a partially written table. Returns false if the file could not be written (e.g. the SRS directory
+     * is read-only) or the transcripts do not hold num_points points.
+     */
+    static bool write_point_table(AffineElement const* point_table, size_t num_points, std::string const& dir)
+    {
+        const auto transcript_fingerprint = get_transcript_fingerprint(dir, num_points);
+        if (!transcript_fingerprint) {
+            return false;
+        }
+        const std::string path = get_point_table_path(dir);
+        const std::string tmp_path = format(path, ".", std::to_string(getpid()), ".tmp");
+        const PointTableHeader header = make_point_table_header(num_points, *transcript_fingerprint);
+
+        std::ofstream file(tmp_path, std::ofstream::binary | std::ofstream::trunc);
+        file.write(reinterpret_cast<char const*>(&header), sizeof(PointTableHeader));
+        file.write(reinterpret_cast<char const*>(point_table),
+                   static_cast<std::streamsize>(sizeof(AffineElement) * 2 * num_points));
+        file.close();
+        if (!file) {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+        return true;
+    }
 };
 
 } // namespace bb::srs
@@ -495,6 +495,45 @@ TYPED_TEST(ScalarMultiplicationTests, AddAffinePoints)
     aligned_free(scratch_space);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, CombineBuckets)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    // enough buckets to be cut into several segments per round
+    constexpr size_t num_rounds = 3;
+    constexpr size_t num_buckets = 256;
+    std::vector<AffineElement> buckets(num_rounds * num_buckets);
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        buckets[i] = AffineElement(Element::random_element());
+    }
+    // the edge cases of the affine additions: empty buckets, and running sums which double or cancel
+    for (size_t i = 0; i < num_rounds; ++i) {
+        AffineElement* round_buckets = &buckets[i * num_buckets];
+        round_buckets[num_buckets - 1].self_set_infinity();
+        round_buckets[7].self_set_infinity();
+        round_buckets[100] = round_buckets[101];
+        round_buckets[200] = -round_buckets[201];
+        round_buckets[150] = round_buckets[151] + round_buckets[151];
+    }
+    buckets[num_buckets].self_set_infinity();
+    for (size_t k = 0; k < num_buckets; ++k) {
+        buckets[(2 * num_buckets) + k].self_set_infinity();
+    }
+
+    const auto round_sums = scalar_multiplication::combine_buckets<Curve>(buckets.data(), num_rounds, num_buckets);
+    ASSERT_EQ(round_sums.size(), num_rounds);
+    for (size_t i = 0; i < num_rounds; ++i) {
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t k = 0; k < num_buckets; ++k) {
+            expected += Element(buckets[(i * num_buckets) + k]) * typename Curve::ScalarField((2 * k) + 1);
+        }
+        EXPECT_EQ(AffineElement(round_sums[i]), AffineElement(expected));
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, ConstructAdditionChains)
 {
     using Curve = TypeParam;
@@ -787,6 +826,111 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerSmall)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerChunked)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    constexpr size_t start_index = 1000;
+    constexpr size_t chunk_size = 1024;
+
+    std::vector<Fr> scalars(num_points - start_index);
+    std::vector<AffineElement> points(num_points * 2);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), points.data(), num_points);
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    Element expected = scalar_multiplication::pippenger<Curve>({ start_index, scalars }, points, state);
+
+    // The chunked variant only ever uses a runtime state for chunk_size points
+    scalar_multiplication::pippenger_runtime_state<Curve> chunk_state(chunk_size);
+    Element result = scalar_multiplication::pippenger_chunked<Curve>({ start_index, scalars }, points, chunk_state);
+
+    EXPECT_EQ(AffineElement(result), AffineElement(expected));
+    EXPECT_LT(scalar_multiplication::pippenger_runtime_state<Curve>::get_memory_footprint(chunk_size),
+              scalar_multiplication::pippenger_runtime_state<Curve>::get_memory_footprint(num_points));
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    std::vector<AffineElement> points(num_points * 2);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), points.data(), num_points);
+
+    // More vectors than a batch, of different spans: full, offset, short, empty, zero and small (even) scalars
+    const std::vector<std::pair<size_t, size_t>> spans = {
+        { 0, num_points }, { 1, num_points - 1 }, { 1000, 3000 }, { 4000, 5 }, { 17, 0 }, { 0, 2048 }, { 100, 4096 }
+    };
+    std::vector<std::vector<Fr>> scalars;
+    for (const auto& [start_index, size] : spans) {
+        scalars.emplace_back(size);
+        for (auto& scalar : scalars.back()) {
+            scalar = Fr::random_element();
+        }
+    }
+    for (size_t i = 0; i < scalars[5].size(); ++i) {
+        scalars[5][i] = i % 3 == 0 ? Fr(0) : Fr(i % 4);
+    }
+    std::vector<PolynomialSpan<const Fr>> scalar_spans;
+    for (size_t k = 0; k < spans.size(); ++k) {
+        scalar_spans.emplace_back(spans[k].first, scalars[k]);
+    }
+
+    const std::vector<Element> results = scalar_multiplication::pippenger_batch<Curve>(scalar_spans, points);
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    ASSERT_EQ(results.size(), spans.size());
+    for (size_t k = 0; k < spans.size(); ++k) {
+        const Element expected = scalar_multiplication::pippenger<Curve>(scalar_spans[k], points, state);
+        EXPECT_EQ(AffineElement(results[k]), AffineElement(expected));
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchEdgeCaseDbl)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 1024;
+
+    // Every point is the same, so points meet equal and opposite points in the buckets
+    std::vector<AffineElement> points(num_points * 2, AffineElement(Element::random_element()));
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), points.data(), num_points);
+    std::vector<Fr> scalars(num_points);
+    Fr scalar_sum = 0;
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = i % 2 == 0 ? Fr::random_element() : -scalars[i - 1];
+        scalar_sum += scalars[i];
+    }
+    std::vector<Fr> partial_scalars(scalars.begin(), scalars.begin() + num_points - 1);
+
+    const std::vector<PolynomialSpan<const Fr>> scalar_spans = { { 0, scalars }, { 0, partial_scalars } };
+    const std::vector<Element> results = scalar_multiplication::pippenger_batch<Curve>(scalar_spans, points);
+
+    EXPECT_TRUE(results[0].is_point_at_infinity());
+    EXPECT_EQ(AffineElement(results[1]), AffineElement(Element(points[0]) * scalars[num_points - 2]));
+    EXPECT_EQ(scalar_sum, Fr(0));
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerEdgeCaseDbl)
 {
     using Curve = TypeParam;
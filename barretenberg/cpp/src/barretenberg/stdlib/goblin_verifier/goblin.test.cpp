@@ -57,4 +57,29 @@ TEST_F(GoblinTests, MultipleCircuits)
     EXPECT_TRUE(verified);
 }
 
+/**
+ * @brief Check that a goblin proof constructed with the ECCVM and Translator provers running concurrently verifies
+ *
+ */
+TEST_F(GoblinTests, MultipleCircuitsPipelinedEccvmAndTranslator)
+{
+    GoblinProver goblin;
+    goblin.pipeline_eccvm_and_translator = true;
+
+    size_t NUM_CIRCUITS = 3;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        auto circuit = construct_mock_circuit(goblin.op_queue);
+        goblin.merge(circuit);
+    }
+
+    GoblinProof proof = goblin.prove();
+
+    auto eccvm_vkey = std::make_shared<ECCVMVerificationKey>(goblin.get_eccvm_proving_key());
+    auto translator_vkey = std::make_shared<TranslatorVerificationKey>(goblin.get_translator_proving_key());
+    GoblinVerifier goblin_verifier{ eccvm_vkey, translator_vkey };
+    bool verified = goblin_verifier.verify(proof);
+
+    EXPECT_TRUE(verified);
+}
+
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/787) Expand these tests.
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/commitment_schemes/kzg/kzg.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/ecc/fields/field_pack.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/flavor_macros.hpp"
 #include "barretenberg/flavor/relation_definitions.hpp"
@@ -461,19 +462,19 @@ class MegaFlavor {
             PROFILE_THIS_NAME("compute_logderivative_inverses");
 
             // Compute inverses for conventional lookups
-            LogDerivLookupRelation<FF>::compute_logderivative_inverse(
+            compute_logderivative_inverse<MegaFlavor, LogDerivLookupRelation<FF>>(
                 this->polynomials, relation_parameters, this->circuit_size);
 
             // Compute inverses for calldata reads
-            DatabusLookupRelation<FF>::compute_logderivative_inverse</*bus_idx=*/0>(
+            compute_logderivative_inverse<MegaFlavor, DatabusLookupRelation<FF>::BusColumnLookup</*bus_idx=*/0>>(
                 this->polynomials, relation_parameters, this->circuit_size);
 
             // Compute inverses for secondary_calldata reads
-            DatabusLookupRelation<FF>::compute_logderivative_inverse</*bus_idx=*/1>(
+            compute_logderivative_inverse<MegaFlavor, DatabusLookupRelation<FF>::BusColumnLookup</*bus_idx=*/1>>(
                 this->polynomials, relation_parameters, this->circuit_size);
 
             // Compute inverses for return data reads
-            DatabusLookupRelation<FF>::compute_logderivative_inverse</*bus_idx=*/2>(
+            compute_logderivative_inverse<MegaFlavor, DatabusLookupRelation<FF>::BusColumnLookup</*bus_idx=*/2>>(
                 this->polynomials, relation_parameters, this->circuit_size);
         }
 
@@ -561,7 +562,7 @@ class MegaFlavor {
                 ck = std::make_shared<CommitmentKey>(proving_key.circuit_size);
             }
             for (auto [polynomial, commitment] : zip_view(proving_key.polynomials.get_precomputed(), this->get_all())) {
-                commitment = ck->commit(polynomial);
+                commitment = ck->commit_auto(polynomial);
             }
         }
 
@@ -744,6 +745,11 @@ class MegaFlavor {
      * @brief A container for univariates produced during the hot loop in sumcheck.
      */
     using ExtendedEdges = ProverUnivariates<MAX_PARTIAL_RELATION_LENGTH>;
+    /**
+     * @brief A container for univariates over packs of field elements, on which the sumcheck prover evaluates the
+     * relations over several edges at once.
+     */
+    using PackedExtendedEdges = AllEntities<bb::Univariate<field_pack<FF::Params>, MAX_PARTIAL_RELATION_LENGTH>>;
 
     /**
      * @brief A container for the witness commitments.
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/commitment_schemes/kzg/kzg.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/ecc/fields/field_pack.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/flavor/flavor_macros.hpp"
 #include "barretenberg/flavor/repeated_commitments_data.hpp"
@@ -421,7 +422,7 @@ class UltraFlavor {
                 proving_key.commitment_key = std::make_shared<CommitmentKey>(proving_key.circuit_size);
             }
             for (auto [polynomial, commitment] : zip_view(proving_key.polynomials.get_precomputed(), this->get_all())) {
-                commitment = proving_key.commitment_key->commit(polynomial);
+                commitment = proving_key.commitment_key->commit_auto(polynomial);
             }
         }
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/964): Clean the boilerplate
@@ -566,6 +567,11 @@ class UltraFlavor {
      * @brief A container for univariates produced during the hot loop in sumcheck.
      */
     using ExtendedEdges = ProverUnivariates<MAX_PARTIAL_RELATION_LENGTH>;
+    /**
+     * @brief A container for univariates over packs of field elements, on which the sumcheck prover evaluates the
+     * relations over several edges at once.
+     */
+    using PackedExtendedEdges = AllEntities<bb::Univariate<field_pack<FF::Params>, MAX_PARTIAL_RELATION_LENGTH>>;
 
     /**
      * @brief A container for the witness commitments.
@@ -71,6 +71,11 @@ In Round \f$ i < d-1\f$, \ref partially_evaluate "partially evaluate" updates th
 P_N(u_0,\ldots, u_i, \vec \ell)\f$ for \f$\vec \ell \in \{0,1\}^{d-1-i}\f$.
 The details are specified in \ref partially_evaluate "the corresponding docs."
 
+If bb::SumcheckProverRound::fuse_fold is set, these updates, apart from the final one, are fused with the computation
+of the next round univariate by \ref bb::SumcheckProverRound::fold_and_compute_univariate "fold and compute univariate",
+which extends the edges of the next round as soon as they are folded instead of sweeping the book-keeping table a second
+time.
+
 ### Final Step
 After computing the last challenge \f$ u_{d-1} \f$ in Round \f$ d-1 \f$ and updating \f$
 \texttt{partially_evaluated_polynomials} \f$, the prover looks into the 'top' row of the table containing evaluations
@@ -120,6 +125,7 @@ template <typename Flavor> class SumcheckProver {
     using FF = typename Flavor::FF;
     using ProverPolynomials = typename Flavor::ProverPolynomials;
     using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
+    using Polynomial = typename Flavor::Polynomial;
     using ClaimedEvaluations = typename Flavor::AllValues;
 
     using Transcript = typename Flavor::Transcript;
@@ -163,6 +169,9 @@ template <typename Flavor> class SumcheckProver {
     u_i \f$, the first \f$2^{d-1-i}\f$ rows are updated using \ref bb::SumcheckProver< Flavor >::partially_evaluate
     "partially evaluate" method.
     *
+    * It is allocated by \ref allocate_partially_evaluated_polynomials "allocate_partially_evaluated_polynomials" when
+    * the full polynomials are first folded.
+    *
     * NOTE: With ~40 columns, prob only want to allocate 256 EdgeGroup's at once to keep stack under 1MB?
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
@@ -172,8 +181,7 @@ template <typename Flavor> class SumcheckProver {
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , round(multivariate_n){};
 
     /**
      * @brief Compute round univariate, place it in transcript, compute challenge, partially evaluate. Repeat
@@ -209,16 +217,16 @@ template <typename Flavor> class SumcheckProver {
                                                          zk_sumcheck_data,
                                                          row_disabling_polynomial);
         vinfo("starting sumcheck rounds...");
+        FF round_challenge;
         {
 
             PROFILE_THIS_NAME("rest of sumcheck round 1");
 
             // Place the evaluations of the round univariate into transcript.
             transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
             multivariate_challenge.emplace_back(round_challenge);
-            // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            // The sumcheck book-keeping table is populated in the next round, along with its univariate.
             // Prepare ZK Sumcheck data for the next round
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
@@ -228,25 +236,54 @@ template <typename Flavor> class SumcheckProver {
             round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
                                                       // release memory?        // All but final round
                                                       // We operate on partially_evaluated_polynomials in place.
+            round.compact_active_ranges();
         }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
 
             PROFILE_THIS_NAME("sumcheck loop");
 
-            // Write the round univariate to the transcript
-            round_univariate = round.compute_univariate(round_idx,
-                                                        partially_evaluated_polynomials,
-                                                        relation_parameters,
-                                                        gate_separators,
-                                                        alpha,
-                                                        zk_sumcheck_data,
-                                                        row_disabling_polynomial);
+            // Fold the polynomials of the previous round at its challenge into the book-keeping table and compute the
+            // round univariate, in the same pass if round.fuse_fold is set. The first fold reads the full polynomials,
+            // the next ones operate on partially_evaluated_polynomials in place.
+            if (!round.fuse_fold) {
+                if (round_idx == 1) {
+                    partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+                } else {
+                    partially_evaluate(partially_evaluated_polynomials, 2 * round.round_size, round_challenge);
+                }
+                round_univariate = round.compute_univariate(round_idx,
+                                                            partially_evaluated_polynomials,
+                                                            relation_parameters,
+                                                            gate_separators,
+                                                            alpha,
+                                                            zk_sumcheck_data,
+                                                            row_disabling_polynomial);
+            } else if (round_idx == 1) {
+                allocate_partially_evaluated_polynomials(full_polynomials.get_all());
+                round_univariate = round.fold_and_compute_univariate(round_idx,
+                                                                     full_polynomials,
+                                                                     partially_evaluated_polynomials,
+                                                                     round_challenge,
+                                                                     relation_parameters,
+                                                                     gate_separators,
+                                                                     alpha,
+                                                                     zk_sumcheck_data,
+                                                                     row_disabling_polynomial);
+            } else {
+                round_univariate = round.fold_and_compute_univariate(round_idx,
+                                                                     partially_evaluated_polynomials,
+                                                                     partially_evaluated_polynomials,
+                                                                     round_challenge,
+                                                                     relation_parameters,
+                                                                     gate_separators,
+                                                                     alpha,
+                                                                     zk_sumcheck_data,
+                                                                     row_disabling_polynomial);
+            }
             // Place evaluations of Sumcheck Round Univariate in the transcript
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
-            // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             // Prepare evaluation masking and libra structures for the next round (for ZK Flavors)
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
@@ -255,6 +292,13 @@ template <typename Flavor> class SumcheckProver {
 
             gate_separators.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
+            round.compact_active_ranges();
+        }
+        // Fold the polynomials of the final round at its challenge
+        if (multivariate_d == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        } else {
+            partially_evaluate(partially_evaluated_polynomials, 2, round_challenge);
         }
         vinfo("completed ", multivariate_d, " rounds of sumcheck");
 
@@ -321,19 +365,27 @@ template <typename Flavor> class SumcheckProver {
     \ell+1,j} - \texttt{partially_evaluated_polynomials}_{2\ell,j}) \f} where \f$\vec \ell \in \{0,1\}^{d-1-i}\f$.
      * After the final update, i.e. when \f$ i = d-1 \f$, the upper row of the table contains the evaluations of Honk
      * polynomials at the challenge point \f$ (u_0,\ldots, u_{d-1}) \f$.
+     * The rows of a polynomial outside of its backing memory, i.e. outside of [start_index, end_index), are zero, so
+     * only the rows of the book-keeping table from the fold of its start index up to the end of the column are
+     * written. In the first round, the rest of the book-keeping table is zero from its construction. This skips e.g.
+     * the unused rows of the selectors of a structured trace. The columns of the book-keeping table are backed from row
+     * 0, so that in subsequent rounds all of their backed rows within round_size / 2 are folded.
      * @param polynomials Honk polynomials at initialization; partially evaluated polynomials in subsequent rounds
      * @param round_size \f$2^{d-i}\f$
      * @param round_challenge \f$u_i\f$
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
-        auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
+        if (round_size == multivariate_n) {
+            allocate_partially_evaluated_polynomials(poly_view);
+        }
+        auto pep_view = partially_evaluated_polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j].at(i >> 1) = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
-            }
+            const size_t start = poly_view[j].start_index() >> 1;
+            const size_t end = std::min(round_size >> 1, pep_view[j].end_index());
+            round.fold_rows(poly_view[j], pep_view[j], start, end, round_challenge);
         });
     };
     /**
@@ -343,6 +395,9 @@ template <typename Flavor> class SumcheckProver {
     template <typename PolynomialT, std::size_t N>
     void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
     {
+        if (round_size == multivariate_n) {
+            allocate_partially_evaluated_polynomials(polynomials);
+        }
         auto pep_view = partially_evaluated_polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
@@ -353,6 +408,32 @@ template <typename Flavor> class SumcheckProver {
         });
     };
 
+    /**
+     * @brief Allocate the book-keeping table for the first fold of \p polynomials.
+     * @details The fold of a polynomial is zero from half of its end index on, so each column of the table is only
+     * backed up to there and is virtually zero up to \f$ n/2 \f$. This saves e.g. the zero tails of the databus, ecc
+     * op and lookup table columns. The columns are backed from row 0 on, since the folds of the next rounds move the
+     * non-zero rows towards the start of the table. Columns without a polynomial in \p polynomials are left empty.
+     *
+     * @param polynomials The full polynomials, or an array of their first columns.
+     */
+    void allocate_partially_evaluated_polynomials(const auto& polynomials)
+    {
+        const size_t table_size = multivariate_n >> 1;
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        for (size_t j = 0; j < pep_view.size(); j++) {
+            size_t end = 0;
+            if (j < polynomials.size()) {
+                if constexpr (requires { polynomials[j].end_index(); }) {
+                    end = polynomials[j].end_index();
+                } else {
+                    end = polynomials[j].size();
+                }
+            }
+            pep_view[j] = Polynomial(std::min((end + 1) >> 1, table_size), table_size);
+        }
+    }
+
     /**
     * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
     * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
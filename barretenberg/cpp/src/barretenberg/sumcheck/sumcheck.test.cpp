@@ -21,6 +21,7 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
     using FF = typename Flavor::FF;
     using ProverPolynomials = typename Flavor::ProverPolynomials;
     using RelationSeparator = Flavor::RelationSeparator;
+    using SumcheckRoundUnivariate = typename SumcheckProverRound<Flavor>::SumcheckRoundUnivariate;
     const size_t NUM_POLYNOMIALS = Flavor::NUM_ALL_ENTITIES;
     static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
 
@@ -169,6 +170,214 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    /**
+     * @brief Check that restricting the rounds to the active ranges of the trace does not change the proof when the
+     * polynomials vanish outside of these ranges, some of them being only backed on a part of the domain, whether
+     * the folds are fused with the round univariates or not.
+     */
+    void test_active_ranges()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+        const std::vector<std::pair<size_t, size_t>> active_ranges = { { 150, 561 }, { 64, 100 }, { 90, 131 } };
+
+        std::vector<Polynomial<FF>> polynomials;
+        for (size_t idx = 0; idx < NUM_POLYNOMIALS; idx++) {
+            // Alternate between polynomials backed on the whole domain and on the active part of the trace only
+            auto poly = idx % 2 == 0 ? Polynomial<FF>(multivariate_n) : Polynomial<FF>(497, multivariate_n, 64);
+            for (const auto& [start, end] : active_ranges) {
+                for (size_t row = start; row < end && row < poly.end_index(); row++) {
+                    poly.at(row) = FF::random_element();
+                }
+            }
+            polynomials.emplace_back(std::move(poly));
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(polynomials);
+
+        const auto prove = [&](bool use_active_ranges, bool fuse_fold) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.round.fuse_fold = fuse_fold;
+            if (use_active_ranges) {
+                sumcheck.round.set_active_ranges(active_ranges);
+            }
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            auto output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+            return std::make_pair(transcript->proof_data, output);
+        };
+
+        auto [proof, output] = prove(true, false);
+        EXPECT_EQ(proof, prove(false, false).first);
+        EXPECT_EQ(proof, prove(true, true).first);
+        EXPECT_EQ(proof, prove(false, true).first);
+
+        // The partially backed polynomials are correctly folded
+        for (auto [full_poly, claimed_eval] :
+             zip_view(full_polynomials.get_all(), output.claimed_evaluations.get_all())) {
+            Polynomial<FF> dense_poly(multivariate_n);
+            for (size_t row = full_poly.start_index(); row < full_poly.end_index(); row++) {
+                dense_poly.at(row) = full_poly[row];
+            }
+            std::span<const FF> challenge(output.challenge.data(), multivariate_d);
+            EXPECT_EQ(dense_poly.evaluate_mle(challenge), claimed_eval);
+        }
+    }
+
+    /**
+     * @brief Check that evaluating the relations over packs of edges does not change the proof, on the whole domain
+     * and on active ranges whose lengths are not multiples of the pack size.
+     * @details The polynomials vanish on some of the edges, where the relations may be skipped, so that the packs mix
+     * edges which are skipped when evaluated one by one with edges which are not.
+     */
+    void test_packed_edges()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+        const size_t trace_size = 561;
+        const std::vector<std::pair<size_t, size_t>> active_ranges = { { 150, 561 }, { 64, 100 }, { 90, 131 } };
+
+        std::vector<Polynomial<FF>> polynomials;
+        for (size_t idx = 0; idx < NUM_POLYNOMIALS; idx++) {
+            Polynomial<FF> poly(trace_size, multivariate_n);
+            for (size_t row = 0; row < trace_size; row++) {
+                const bool is_empty_edge = row >= 200 && row < 400 && (row / 2) % 3 == 0;
+                poly.at(row) = is_empty_edge ? FF::zero() : FF::random_element();
+            }
+            polynomials.emplace_back(std::move(poly));
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(polynomials);
+        const auto relation_parameters = RelationParameters<FF>::get_random();
+        ZKSumcheckData<Flavor> zk_sumcheck_data;
+        if constexpr (Flavor::HasZK) {
+            zk_sumcheck_data = ZKSumcheckData<Flavor>(multivariate_d, Flavor::Transcript::prover_init_empty());
+        }
+
+        const auto prove = [&](bool pack_edges, bool use_active_ranges) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            sumcheck.round.pack_edges = pack_edges;
+            if (use_active_ranges) {
+                sumcheck.round.set_active_ranges(active_ranges);
+            }
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges, zk_sumcheck_data);
+            return transcript->proof_data;
+        };
+
+        for (bool use_active_ranges : { false, true }) {
+            EXPECT_EQ(prove(true, use_active_ranges), prove(false, use_active_ranges));
+        }
+    }
+
+    /**
+     * @brief Check that folding the book-keeping table while computing the next round univariate matches folding it
+     * first and computing the univariate afterwards, both from the full polynomials and in place.
+     */
+    void test_fold_and_compute_univariate()
+    {
+        const size_t multivariate_d(10);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Every other polynomial has a zero tail of varying length, so that its column of the book-keeping table is
+        // only partially backed
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t idx = 0; idx < NUM_POLYNOMIALS; idx++) {
+            const size_t size = idx % 2 == 0 ? multivariate_n : multivariate_n / 4 + 3 * idx;
+            random_polynomials[idx] = Polynomial<FF>(size, multivariate_n);
+            for (auto& coeff : random_polynomials[idx].coeffs()) {
+                coeff = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        RelationSeparator alpha;
+        for (auto& alpha_i : alpha) {
+            alpha_i = FF::random_element();
+        }
+        std::vector<FF> gate_challenges(multivariate_d);
+        for (auto& challenge : gate_challenges) {
+            challenge = FF::random_element();
+        }
+        const auto relation_parameters = RelationParameters<FF>::get_random();
+
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        auto expected = SumcheckProver<Flavor>(multivariate_n, transcript);
+        auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+        GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+        size_t round_size = multivariate_n;
+        for (size_t round_idx = 1; round_idx < 4; round_idx++) {
+            const FF challenge = FF::random_element();
+            gate_separators.partially_evaluate(challenge);
+            if (round_idx == 1) {
+                expected.partially_evaluate(full_polynomials, round_size, challenge);
+            } else {
+                expected.partially_evaluate(expected.partially_evaluated_polynomials, round_size, challenge);
+            }
+            round_size >>= 1;
+            expected.round.round_size = round_size;
+            sumcheck.round.round_size = round_size;
+            auto expected_univariate = expected.round.compute_univariate(round_idx,
+                                                                         expected.partially_evaluated_polynomials,
+                                                                         relation_parameters,
+                                                                         gate_separators,
+                                                                         alpha,
+                                                                         {},
+                                                                         {});
+
+            SumcheckRoundUnivariate univariate;
+            if (round_idx == 1) {
+                sumcheck.allocate_partially_evaluated_polynomials(full_polynomials.get_all());
+                for (auto [poly, full_poly] :
+                     zip_view(sumcheck.partially_evaluated_polynomials.get_all(), full_polynomials.get_all())) {
+                    EXPECT_EQ(poly.end_index(), (full_poly.end_index() + 1) / 2);
+                    EXPECT_EQ(poly.virtual_size(), multivariate_n / 2);
+                }
+                univariate = sumcheck.round.fold_and_compute_univariate(round_idx,
+                                                                        full_polynomials,
+                                                                        sumcheck.partially_evaluated_polynomials,
+                                                                        challenge,
+                                                                        relation_parameters,
+                                                                        gate_separators,
+                                                                        alpha,
+                                                                        {},
+                                                                        {});
+            } else {
+                univariate = sumcheck.round.fold_and_compute_univariate(round_idx,
+                                                                        sumcheck.partially_evaluated_polynomials,
+                                                                        sumcheck.partially_evaluated_polynomials,
+                                                                        challenge,
+                                                                        relation_parameters,
+                                                                        gate_separators,
+                                                                        alpha,
+                                                                        {},
+                                                                        {});
+            }
+            EXPECT_EQ(univariate, expected_univariate);
+            for (auto [poly, expected_poly] : zip_view(sumcheck.partially_evaluated_polynomials.get_all(),
+                                                       expected.partially_evaluated_polynomials.get_all())) {
+                for (size_t row = 0; row < round_size; row++) {
+                    EXPECT_EQ(poly[row], expected_poly[row]);
+                }
+            }
+        }
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -390,6 +599,23 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+// Test that skipping the inactive rows of the trace does not change the proof
+TYPED_TEST(SumcheckTests, ActiveRanges)
+{
+    SKIP_IF_ZK();
+    this->test_active_ranges();
+}
+// Test the round univariates computed while folding the book-keeping table
+TYPED_TEST(SumcheckTests, FoldAndComputeUnivariate)
+{
+    SKIP_IF_ZK();
+    this->test_fold_and_compute_univariate();
+}
+// Test that evaluating the relations over packs of edges does not change the proof
+TYPED_TEST(SumcheckTests, PackedEdges)
+{
+    this->test_packed_edges();
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
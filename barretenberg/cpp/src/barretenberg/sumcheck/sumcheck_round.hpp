@@ -1,14 +1,24 @@
 #pragma once
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_pack.hpp"
+#include "barretenberg/ecc/fields/field_vec.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/gate_separator.hpp"
 #include "barretenberg/polynomials/row_disabling_polynomial.hpp"
+#include "barretenberg/relations/nested_containers.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/stdlib/primitives/bool/bool.hpp"
 #include "zk_sumcheck_data.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
 namespace bb {
 
 /*! \brief Imlementation of the Sumcheck prover round.
@@ -31,6 +41,24 @@ polynomials to \f$ T^i(X_i)\f$
 
  */
 
+/**
+ * @brief The containers in which the Sumcheck prover evaluates the relations over packs of field_pack::NUM_LANES edges,
+ * for the flavors which define univariates over packs of field elements.
+ */
+template <typename Flavor> struct SumcheckPackedAccumulators {
+    using PackedFF = field_pack<typename Flavor::FF::Params>;
+    using TupleOfTuplesOfUnivariates =
+        typename RebindUnivariates<typename Flavor::SumcheckTupleOfTuplesOfUnivariates, PackedFF>::type;
+
+    typename Flavor::PackedExtendedEdges extended_edges;
+    // The contributions of the edges of the current pack to each relation
+    TupleOfTuplesOfUnivariates relation_univariates;
+    // The contributions of all packs, each edge scaled by its gate separator
+    TupleOfTuplesOfUnivariates univariate_accumulators;
+
+    SumcheckPackedAccumulators() { RelationUtils<Flavor>::zero_univariates(univariate_accumulators); }
+};
+
 template <typename Flavor> class SumcheckProverRound {
 
     using Utils = bb::RelationUtils<Flavor>;
@@ -63,6 +91,44 @@ template <typename Flavor> class SumcheckProverRound {
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
     using SumcheckRoundUnivariate = bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>;
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
+    using PackedFF = field_pack<typename FF::Params>;
+    /**
+     * @brief Whether the relations may be evaluated over packs of PackedFF::NUM_LANES edges, see \ref accumulate_edges
+     * "accumulate edges".
+     */
+    static constexpr bool HAS_PACKED_EDGES = requires { typename Flavor::PackedExtendedEdges; };
+    using PackedAccumulators =
+        std::conditional_t<HAS_PACKED_EDGES, SumcheckPackedAccumulators<Flavor>, std::monostate>;
+    /**
+     * @brief Whether the relations are evaluated over packs of edges. By default, they are if the Flavor allows it and
+     * field_vec has a vector backend on this CPU, without which the packs are slower than the field arithmetic.
+     */
+    bool pack_edges = HAS_PACKED_EDGES && field_vec<typename FF::Params>::has_ifma();
+    /**
+     * @brief Whether the prover folds each round into the book-keeping table while computing the next round univariate,
+     * see \ref fold_and_compute_univariate "fold and compute univariate". It saves a sweep of the table per round but
+     * was measured no faster than folding and computing the univariate separately, so it is off by default.
+     */
+    bool fuse_fold = false;
+    /**
+     * @brief Number of edges folded at once by \ref fold_and_compute_univariate "fold and compute univariate", such
+     * that the folded rows of all polynomials, about 64KiB, stay in cache until their edges are extended. It is a
+     * multiple of the number of lanes of the vector fold, see \ref fold_rows "fold rows".
+     */
+    static constexpr size_t FOLD_BLOCK_SIZE =
+        std::max(field_vec<typename FF::Params>::NUM_LANES,
+                 (size_t{ 1 } << 16) / (2 * Flavor::NUM_ALL_ENTITIES * sizeof(FF)) /
+                     field_vec<typename FF::Params>::NUM_LANES * field_vec<typename FF::Params>::NUM_LANES);
+    using Range = std::pair<size_t, size_t>;
+    /**
+     * @brief Sorted disjoint ranges of rows of the current round, each consisting of whole edges, outside of which the
+     * rows are inactive. Empty if every row of the round has to be processed.
+     * @details A row is inactive if all relations vanish on it as well as on any linear combination of inactive rows,
+     * e.g. the unused rows of a structured trace (see ExecutionTraceUsageTracker). Edges made of two inactive rows do
+     * not contribute to the round univariate. A row of the next round is a combination of the two rows of an edge, so
+     * the ranges are compacted to half their indices whenever the round size is halved.
+     */
+    std::vector<Range> active_ranges;
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -74,6 +140,113 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the computation of the round univariates to the given ranges of rows of the first round.
+     * @details The ranges may overlap and need not be sorted. In ZK Flavors, the disabled rows at the end of the trace
+     * are always considered active since they hold the random masking values.
+     *
+     * @param ranges Ranges [start, end) of rows outside of which all rows are inactive.
+     */
+    void set_active_ranges(std::vector<Range> ranges)
+    {
+        active_ranges.clear();
+        if (ranges.empty()) {
+            return;
+        }
+        if constexpr (Flavor::HasZK) {
+            ranges.emplace_back(round_size - std::min(round_size, size_t{ 4 }), round_size);
+        }
+        active_ranges = construct_edge_ranges(std::move(ranges), round_size);
+    }
+
+    /**
+     * @brief Map the active ranges onto the rows of the next round. Must be called once the round size is halved.
+     */
+    void compact_active_ranges()
+    {
+        for (auto& [start, end] : active_ranges) {
+            start >>= 1;
+            end >>= 1;
+        }
+        active_ranges = construct_edge_ranges(std::move(active_ranges), round_size);
+    }
+
+    /**
+     * @brief Distribute the edges contained in a set of sorted disjoint ranges evenly across a given number of threads.
+     * @details All threads get the same number of edges apart from the last ones which get the remainder.
+     *
+     * @param ranges Sorted disjoint ranges of rows, each consisting of whole edges.
+     * @param num_threads
+     * @return std::vector<std::vector<Range>> The ranges of rows processed by each thread
+     */
+    static std::vector<std::vector<Range>> construct_thread_ranges(const std::vector<Range>& ranges,
+                                                                   const size_t num_threads)
+    {
+        size_t num_rows = 0;
+        for (const auto& [start, end] : ranges) {
+            num_rows += end - start;
+        }
+        const size_t num_edges = num_rows >> 1;
+        const size_t rows_per_thread = 2 * ((num_edges + num_threads - 1) / num_threads);
+
+        std::vector<std::vector<Range>> thread_ranges(num_threads);
+        size_t thread_idx = 0;
+        size_t thread_space_remaining = rows_per_thread;
+        for (auto [start, end] : ranges) {
+            while (start < end) {
+                const size_t chunk = std::min(end - start, thread_space_remaining);
+                thread_ranges[thread_idx].emplace_back(start, start + chunk);
+                start += chunk;
+                thread_space_remaining -= chunk;
+                if (thread_space_remaining == 0) {
+                    thread_idx++;
+                    thread_space_remaining = rows_per_thread;
+                }
+            }
+        }
+        return thread_ranges;
+    }
+
+    /**
+     * @brief Split the edges \f$ [\text{level\_start}, \text{level\_end}) \f$ of a level of \ref
+     * fold_and_compute_univariate "fold and compute univariate" into one interval of consecutive edges per thread, such
+     * that the threads accumulate the same number of active edges, as in \ref compute_univariate "compute univariate".
+     * @details The inactive edges are folded by the thread of the interval they fall into; folding is cheap compared to
+     * accumulating the relations. A level without active edges is split evenly.
+     *
+     * @return std::vector<size_t> The bounds of the intervals, i.e. thread \f$ t \f$ processes the edges
+     * \f$ [\text{bounds}[t], \text{bounds}[t + 1]) \f$.
+     */
+    std::vector<size_t> construct_level_bounds(const size_t level_start,
+                                               const size_t level_end,
+                                               const size_t min_iterations_per_thread) const
+    {
+        std::vector<Range> level_ranges;
+        for (const auto& [start, end] : active_ranges) {
+            if (start < 2 * level_end && end > 2 * level_start) {
+                level_ranges.emplace_back(std::max(start, 2 * level_start), std::min(end, 2 * level_end));
+            }
+        }
+        if (level_ranges.empty()) {
+            level_ranges.emplace_back(2 * level_start, 2 * level_end);
+        }
+        size_t num_active_rows = 0;
+        for (const auto& [start, end] : level_ranges) {
+            num_active_rows += end - start;
+        }
+        const size_t num_threads = bb::calculate_num_threads(num_active_rows >> 1, min_iterations_per_thread);
+        const std::vector<std::vector<Range>> thread_ranges = construct_thread_ranges(level_ranges, num_threads);
+
+        std::vector<size_t> bounds(num_threads + 1, level_end);
+        bounds[0] = level_start;
+        for (size_t thread_idx = 1; thread_idx < num_threads; thread_idx++) {
+            if (!thread_ranges[thread_idx].empty()) {
+                bounds[thread_idx] = thread_ranges[thread_idx].front().first >> 1;
+            }
+        }
+        return bounds;
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -113,6 +286,28 @@ template <typename Flavor> class SumcheckProverRound {
         }
     }
 
+    /**
+     * @brief Extend the PackedFF::NUM_LANES consecutive edges starting at \p edge_idx, lane i holding the edge
+     * \f$ (\text{edge\_idx} + 2i, \text{edge\_idx} + 2i + 1) \f$, like \ref extend_edges "extend edges".
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    static void extend_packed_edges(auto& extended_edges,
+                                    const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                                    const size_t edge_idx)
+    {
+        std::array<FF, PackedFF::NUM_LANES> values_at_0;
+        std::array<FF, PackedFF::NUM_LANES> values_at_1;
+        for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
+            for (size_t lane = 0; lane < PackedFF::NUM_LANES; lane++) {
+                values_at_0[lane] = multivariate[edge_idx + 2 * lane];
+                values_at_1[lane] = multivariate[edge_idx + 2 * lane + 1];
+            }
+            extended_edge.value_at(0) = PackedFF::load(values_at_0);
+            extended_edge.value_at(1) = PackedFF::load(values_at_1);
+            extended_edge.template self_extend_from<2>();
+        }
+    }
+
     /**
      * @brief Return the evaluations of the univariate round polynomials \f$ \tilde{S}_{i} (X_{i}) \f$  at \f$ X_{i } =
      0,\ldots, D \f$. Most likely, \f$ D \f$ is around  \f$ 12 \f$. At the
@@ -151,9 +346,17 @@ template <typename Flavor> class SumcheckProverRound {
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
         // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        // If the active ranges of the trace are known, only the edges containing an active row are processed and the
+        // work is distributed so that each thread handles the same number of them.
+        const std::vector<Range> edge_ranges =
+            active_ranges.empty() ? std::vector<Range>{ { 0, round_size } } : active_ranges;
+        size_t num_active_rows = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_active_rows += end - start;
+        }
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads_pow2(num_active_rows, min_iterations_per_thread);
+        const std::vector<std::vector<Range>> thread_ranges = construct_thread_ranges(edge_ranges, num_threads);
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -164,48 +367,172 @@ template <typename Flavor> class SumcheckProverRound {
         // Construct extended edge containers; one per thread
         std::vector<ExtendedEdges> extended_edges;
         extended_edges.resize(num_threads);
+        std::vector<PackedAccumulators> packed_accumulators(pack_edges ? num_threads : 0);
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+            for (const auto& [start, end] : thread_ranges[thread_idx]) {
+                accumulate_edges(thread_univariate_accumulators[thread_idx],
+                                 extended_edges[thread_idx],
+                                 pack_edges ? &packed_accumulators[thread_idx] : nullptr,
+                                 polynomials,
+                                 start,
+                                 end,
+                                 relation_parameters,
+                                 gate_sparators);
             }
         });
+        add_packed_accumulators(thread_univariate_accumulators, packed_accumulators);
 
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        return batch_round_univariate(thread_univariate_accumulators,
+                                      round_idx,
+                                      polynomials,
+                                      relation_parameters,
+                                      gate_sparators,
+                                      alpha,
+                                      zk_sumcheck_data,
+                                      row_disabling_poly);
+    }
+
+    /**
+     * @brief Fold the rows \f$ [\text{row\_start}, \text{row\_end}) \f$ of a column of the book-keeping table at
+     * \f$ u \f$, i.e. \f$ \text{target}[r] = \text{source}[2r] + u \cdot (\text{source}[2r + 1] - \text{source}[2r])
+     * \f$.
+     * @details The rows whose source rows are both backed are folded by the vector kernel of field_vec, the others,
+     * at the ends of the backed range of \p source, one by one. \p target may be \p source.
+     */
+    static void fold_rows(
+        const auto& source, auto& target, const size_t row_start, const size_t row_end, const FF& challenge)
+    {
+        const size_t backed_start = std::clamp((source.start_index() + 1) >> 1, row_start, row_end);
+        const size_t backed_end = std::clamp(source.end_index() >> 1, backed_start, row_end);
+        for (size_t row = row_start; row < backed_start; row++) {
+            target.at(row) = source[2 * row] + challenge * (source[2 * row + 1] - source[2 * row]);
         }
-        // For ZK Flavors: The evaluations of the round univariates are masked by the evaluations of Libra univariates
-        // and corrected by subtracting the contribution from the disabled rows
-        if constexpr (Flavor::HasZK) {
-            const auto contribution_from_disabled_rows = compute_disabled_contribution(
-                polynomials, relation_parameters, gate_sparators, alpha, round_idx, row_disabling_poly);
-            const auto libra_round_univariate = compute_libra_round_univariate(zk_sumcheck_data, round_idx);
-            // Batch the univariate contributions from each sub-relation to obtain the round univariate
-            const auto round_univariate =
-                batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
-            // Mask the round univariate
-            return round_univariate + libra_round_univariate - contribution_from_disabled_rows;
+        if (backed_start < backed_end) {
+            field_vec<typename FF::Params>::fold_pairs(
+                std::span<FF>(&target.at(backed_start), backed_end - backed_start),
+                std::span<const FF>(&source[2 * backed_start], 2 * (backed_end - backed_start)),
+                challenge);
         }
-        // Batch the univariate contributions from each sub-relation to obtain the round univariate
-        else {
-            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
+        for (size_t row = backed_end; row < row_end; row++) {
+            target.at(row) = source[2 * row] + challenge * (source[2 * row + 1] - source[2 * row]);
         }
     }
 
+    /**
+     * @brief Fold the polynomials of the previous round at its challenge into the book-keeping table and compute the
+     * round univariate of the current round in the same pass.
+     * @details Computing the round univariate with \ref compute_univariate "compute univariate" after \ref
+     * bb::SumcheckProver::partially_evaluate "partially evaluate" sweeps the book-keeping table twice: once to fold it
+     * and once to extend its edges. Here, the edges \f$ (2\ell, 2\ell + 1) \f$ of the current round are obtained by
+     * folding the rows \f$ 4\ell, \ldots, 4\ell + 3 \f$ of the previous round in blocks of #FOLD_BLOCK_SIZE edges. A
+     * block is folded polynomial by polynomial, which keeps the reads sequential, and its edges are then extended and
+     * accumulated while the folded rows are still in cache.
+     *
+     * The book-keeping table may be folded in place, i.e. \p polynomials may be \p partially_evaluated_polynomials.
+     * The edge \f$ \ell \f$ writes the rows \f$ 2\ell, 2\ell + 1 \f$ which are read by the edge \f$ \ell / 2 \f$.
+     * Hence the edges are processed in levels \f$ [E, 2E) \f$ of increasing \f$ E \f$: within a level, the rows read
+     * and written are disjoint so that the edges can be distributed across threads, and the rows written by a level
+     * are only read by the previous ones.
+     *
+     * All backed rows are folded, the relations are only accumulated over the \ref active_ranges "active ranges".
+     *
+     * @param polynomials The polynomials of the previous round, of size \f$ 2 \f$ #round_size.
+     * @param partially_evaluated_polynomials The book-keeping table, whose first #round_size rows are set to the
+     * polynomials of the current round.
+     * @param previous_round_challenge The challenge at which the previous round is folded.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename PartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate fold_and_compute_univariate(
+        const size_t round_idx,
+        const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+        PartiallyEvaluatedMultivariates& partially_evaluated_polynomials,
+        const FF& previous_round_challenge,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_sparators,
+        const RelationSeparator alpha,
+        ZKSumcheckData<Flavor> zk_sumcheck_data, // only populated when Flavor HasZK
+        RowDisablingPolynomial<FF> row_disabling_poly)
+    {
+        PROFILE_THIS_NAME("fold_and_compute_univariate");
+
+        const size_t num_edges = round_size >> 1;
+        size_t min_iterations_per_thread = 1 << 5; // min number of edges for which we'll spin up a unique thread
+        const size_t max_num_threads = bb::calculate_num_threads(num_edges, min_iterations_per_thread);
+
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(max_num_threads);
+        for (auto& accum : thread_univariate_accumulators) {
+            Utils::zero_univariates(accum);
+        }
+        std::vector<ExtendedEdges> extended_edges(max_num_threads);
+        std::vector<PackedAccumulators> packed_accumulators(pack_edges ? max_num_threads : 0);
+
+        auto source_view = polynomials.get_all();
+        auto target_view = partially_evaluated_polynomials.get_all();
+        const auto fold_and_accumulate_edges = [&](size_t thread_idx, size_t start, size_t end) {
+            // First active range ending after the current row
+            auto range_it = std::upper_bound(active_ranges.begin(),
+                                             active_ranges.end(),
+                                             2 * start,
+                                             [](size_t row, const Range& range) { return row < range.second; });
+            for (size_t block_start = start; block_start < end; block_start += FOLD_BLOCK_SIZE) {
+                const size_t block_end = std::min(end, block_start + FOLD_BLOCK_SIZE);
+                // Fold the block column by column, so that the reads are sequential, into rows which stay in cache
+                for (auto [source, target] : zip_view(source_view, target_view)) {
+                    // The rows past the end of a column of the book-keeping table are zero
+                    const size_t row_end = std::min(2 * block_end, target.end_index());
+                    fold_rows(source, target, 2 * block_start, row_end, previous_round_challenge);
+                }
+                const auto accumulate_block_edges = [&](size_t row_start, size_t row_end) {
+                    accumulate_edges(thread_univariate_accumulators[thread_idx],
+                                     extended_edges[thread_idx],
+                                     pack_edges ? &packed_accumulators[thread_idx] : nullptr,
+                                     partially_evaluated_polynomials,
+                                     row_start,
+                                     row_end,
+                                     relation_parameters,
+                                     gate_sparators);
+                };
+                if (active_ranges.empty()) {
+                    accumulate_block_edges(2 * block_start, 2 * block_end);
+                    continue;
+                }
+                // Only accumulate the edges of the block in the active ranges
+                for (auto it = range_it; it != active_ranges.end() && it->first < 2 * block_end; it++) {
+                    accumulate_block_edges(std::max(it->first, 2 * block_start), std::min(it->second, 2 * block_end));
+                }
+                while (range_it != active_ranges.end() && range_it->second <= 2 * block_end) {
+                    range_it++;
+                }
+            }
+        };
+
+        // The first edges are processed in order by a single thread, then the levels [E, 2E) are each distributed
+        // across threads by their active edges
+        size_t level_start = std::min(num_edges, min_iterations_per_thread);
+        fold_and_accumulate_edges(0, 0, level_start);
+        while (level_start < num_edges) {
+            const size_t level_end = std::min(num_edges, 2 * level_start);
+            const std::vector<size_t> bounds =
+                construct_level_bounds(level_start, level_end, min_iterations_per_thread);
+            parallel_for(bounds.size() - 1, [&](size_t thread_idx) {
+                fold_and_accumulate_edges(thread_idx, bounds[thread_idx], bounds[thread_idx + 1]);
+            });
+            level_start = level_end;
+        }
+        add_packed_accumulators(thread_univariate_accumulators, packed_accumulators);
+
+        return batch_round_univariate(thread_univariate_accumulators,
+                                      round_idx,
+                                      partially_evaluated_polynomials,
+                                      relation_parameters,
+                                      gate_sparators,
+                                      alpha,
+                                      zk_sumcheck_data,
+                                      row_disabling_poly);
+    }
+
     /*!
      * @brief For ZK Flavors: A method disabling the last 4 rows of the ProverPolynomials
      *
@@ -349,6 +676,135 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
   private:
+    /**
+     * @brief Sum the per-thread accumulators and batch them into the round univariate, masked and corrected for the
+     * disabled rows in ZK Flavors.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate batch_round_univariate(
+        std::vector<SumcheckTupleOfTuplesOfUnivariates>& thread_univariate_accumulators,
+        const size_t round_idx,
+        ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_sparators,
+        const RelationSeparator alpha,
+        ZKSumcheckData<Flavor>& zk_sumcheck_data,
+        RowDisablingPolynomial<FF>& row_disabling_poly)
+    {
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+        // For ZK Flavors: The evaluations of the round univariates are masked by the evaluations of Libra univariates
+        // and corrected by subtracting the contribution from the disabled rows
+        if constexpr (Flavor::HasZK) {
+            const auto contribution_from_disabled_rows = compute_disabled_contribution(
+                polynomials, relation_parameters, gate_sparators, alpha, round_idx, row_disabling_poly);
+            const auto libra_round_univariate = compute_libra_round_univariate(zk_sumcheck_data, round_idx);
+            // Batch the univariate contributions from each sub-relation to obtain the round univariate
+            const auto round_univariate =
+                batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
+            // Mask the round univariate
+            return round_univariate + libra_round_univariate - contribution_from_disabled_rows;
+        }
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        else {
+            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_sparators);
+        }
+    }
+
+    /**
+     * @brief Accumulate the contributions of the edges of the rows \f$ [\text{row\_start}, \text{row\_end}) \f$ to
+     * the relations.
+     * @details Each edge \f$ \ell \f$ is extended and its univariate contribution to every relation, scaled by the
+     * corresponding \f$ pow_{\beta} \f$ contribution, is added to the accumulators for \f$ \tilde{S}^i(X_i) \f$. If
+     * \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$
+     * pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+     *
+     * If \p packed_accumulators is given, the edges are processed in packs of PackedFF::NUM_LANES consecutive edges, on
+     * which the relations run once for all lanes, and only the remaining ones one by one.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void accumulate_edges(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
+                          ExtendedEdges& extended_edges,
+                          PackedAccumulators* packed_accumulators,
+                          const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                          const size_t row_start,
+                          const size_t row_end,
+                          const bb::RelationParameters<FF>& relation_parameters,
+                          const bb::GateSeparatorPolynomial<FF>& gate_sparators)
+    {
+        size_t edge_idx = row_start;
+        if constexpr (HAS_PACKED_EDGES) {
+            for (; packed_accumulators != nullptr && edge_idx + 2 * PackedFF::NUM_LANES <= row_end;
+                 edge_idx += 2 * PackedFF::NUM_LANES) {
+                extend_packed_edges(packed_accumulators->extended_edges, polynomials, edge_idx);
+                std::array<FF, PackedFF::NUM_LANES> scaling_factors;
+                for (size_t lane = 0; lane < PackedFF::NUM_LANES; lane++) {
+                    scaling_factors[lane] = gate_sparators[((edge_idx >> 1) + lane) * gate_sparators.periodicity];
+                }
+                accumulate_packed_relation_univariates(
+                    *packed_accumulators, relation_parameters, PackedFF::load(scaling_factors));
+            }
+        }
+        for (; edge_idx < row_end; edge_idx += 2) {
+            extend_edges(extended_edges, polynomials, edge_idx);
+            accumulate_relation_univariates(univariate_accumulators,
+                                            extended_edges,
+                                            relation_parameters,
+                                            gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+        }
+    }
+
+    /**
+     * @brief Add the contributions accumulated over packs of edges by each thread to its accumulators.
+     */
+    static void add_packed_accumulators(std::vector<SumcheckTupleOfTuplesOfUnivariates>& thread_univariate_accumulators,
+                                        const std::vector<PackedAccumulators>& packed_accumulators)
+    {
+        if constexpr (HAS_PACKED_EDGES) {
+            if (packed_accumulators.empty()) {
+                return;
+            }
+            for (auto [accumulators, packed] : zip_view(thread_univariate_accumulators, packed_accumulators)) {
+                auto add_lanes = [&]<size_t relation_idx, size_t subrelation_idx>(auto& univariate) {
+                    const auto& packed_univariate =
+                        std::get<subrelation_idx>(std::get<relation_idx>(packed.univariate_accumulators));
+                    for (size_t idx = 0; idx < univariate.evaluations.size(); idx++) {
+                        univariate.evaluations[idx] += packed_univariate.evaluations[idx].sum();
+                    }
+                };
+                Utils::apply_to_tuple_of_tuples(accumulators, add_lanes);
+            }
+        }
+    }
+
+    /**
+     * @brief Convert a set of ranges of rows into sorted disjoint ranges of whole edges within the round.
+     */
+    static std::vector<Range> construct_edge_ranges(std::vector<Range> ranges, const size_t round_size)
+    {
+        for (auto& [start, end] : ranges) {
+            start = std::min(start & ~size_t{ 1 }, round_size);
+            end = std::min(end + (end & 1), round_size);
+        }
+        std::sort(ranges.begin(), ranges.end());
+
+        std::vector<Range> edge_ranges;
+        for (const Range& range : ranges) {
+            if (range.first >= range.second) {
+                continue;
+            }
+            // Merge the ranges that overlap or are contiguous
+            if (!edge_ranges.empty() && range.first <= edge_ranges.back().second) {
+                edge_ranges.back().second = std::max(edge_ranges.back().second, range.second);
+            } else {
+                edge_ranges.push_back(range);
+            }
+        }
+        return edge_ranges;
+    }
+
     /**
      * @brief In Round \f$ i \f$, for a given point \f$ \vec \ell \in \{0,1\}^{d-1 - i}\f$, calculate the contribution
      * of each sub-relation to \f$ T^i(X_i) \f$.
@@ -401,6 +857,55 @@ template <typename Flavor> class SumcheckProverRound {
                 univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
+
+    /**
+     * @brief Calculate the contribution of each sub-relation over a pack of edges, like \ref
+     * accumulate_relation_univariates "accumulate relation univariates" does for a single edge.
+     *
+     * @details The relations scale their contributions by a single field element, so they are evaluated with a
+     * scaling factor of one and the contributions of the linearly independent sub-relations are then scaled by the
+     * scaling factor of each lane. A skippable relation is only skipped if it is on all lanes, the contributions of the
+     * other lanes being the ones a skipped edge would have had, zero.
+     *
+     * @param scaling_factors The scaling factor of the edge of each lane.
+     */
+    template <size_t relation_idx = 0>
+    static void accumulate_packed_relation_univariates(SumcheckPackedAccumulators<Flavor>& packed_accumulators,
+                                                       const bb::RelationParameters<FF>& relation_parameters,
+                                                       const PackedFF& scaling_factors)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        const auto& extended_edges = packed_accumulators.extended_edges;
+        bool skip = false;
+        if constexpr (isSkippable<Relation, decltype(extended_edges)>) {
+            skip = Relation::skip(extended_edges);
+        }
+        if (!skip) {
+            auto& relation_univariates = std::get<relation_idx>(packed_accumulators.relation_univariates);
+            std::apply(
+                [](auto&... univariates) {
+                    (std::fill(univariates.evaluations.begin(), univariates.evaluations.end(), PackedFF::zero()),
+                     ...);
+                },
+                relation_univariates);
+            Relation::accumulate(relation_univariates, extended_edges, relation_parameters, FF(1));
+
+            auto& univariate_accumulators = std::get<relation_idx>(packed_accumulators.univariate_accumulators);
+            constexpr_for<0, std::tuple_size_v<std::decay_t<decltype(relation_univariates)>>, 1>(
+                [&]<size_t subrelation_idx>() {
+                    auto& contribution = std::get<subrelation_idx>(relation_univariates);
+                    if constexpr (subrelation_is_linearly_independent<Relation, subrelation_idx>()) {
+                        contribution *= scaling_factors;
+                    }
+                    std::get<subrelation_idx>(univariate_accumulators) += contribution;
+                });
+        }
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            accumulate_packed_relation_univariates<relation_idx + 1>(
+                packed_accumulators, relation_parameters, scaling_factors);
+        }
+    }
 };
 
 /*!\brief Implementation of the Sumcheck Verifier Round
@@ -14,9 +14,11 @@ namespace bb {
  * */
 template <IsUltraFlavor Flavor>
 DeciderProver_<Flavor>::DeciderProver_(const std::shared_ptr<DeciderPK>& proving_key,
-                                       const std::shared_ptr<Transcript>& transcript)
+                                       const std::shared_ptr<Transcript>& transcript,
+                                       const ExecutionTraceUsageTracker& trace_usage_tracker)
     : proving_key(std::move(proving_key))
     , transcript(transcript)
+    , trace_usage_tracker(trace_usage_tracker)
 {}
 
 /**
@@ -29,6 +31,10 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
     auto sumcheck = Sumcheck(polynomial_size, transcript);
+    // Skip the rows of a structured trace that are not used by any of the circuits accumulated into the proving key
+    if (trace_usage_tracker.trace_settings.structure) {
+        sumcheck.round.set_active_ranges(trace_usage_tracker.active_ranges);
+    }
     {
 
         PROFILE_THIS_NAME("sumcheck.prove");
@@ -106,12 +106,13 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
             witness_commitments.w_o = proving_key->proving_key.commitment_key->commit_structured(
                 proving_key->proving_key.polynomials.w_o, proving_key->proving_key.active_block_ranges);
         } else {
-            witness_commitments.w_l =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_l);
-            witness_commitments.w_r =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_r);
-            witness_commitments.w_o =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_o);
+            const std::array<PolynomialSpan<const FF>, 3> wires = { proving_key->proving_key.polynomials.w_l,
+                                                                    proving_key->proving_key.polynomials.w_r,
+                                                                    proving_key->proving_key.polynomials.w_o };
+            auto commitments = proving_key->proving_key.commitment_key->commit_batch(wires);
+            witness_commitments.w_l = commitments[0];
+            witness_commitments.w_r = commitments[1];
+            witness_commitments.w_o = commitments[2];
         }
     }
 
@@ -129,7 +130,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
                                                              commitment_labels.get_ecc_op_wires())) {
             {
                 PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                commitment = proving_key->proving_key.commitment_key->commit(polynomial);
+                commitment = proving_key->proving_key.commitment_key->commit_auto(polynomial);
             }
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
@@ -141,7 +142,7 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
                       commitment_labels.get_databus_entities())) {
             {
                 PROFILE_THIS_NAME("COMMIT::databus");
-                commitment = proving_key->proving_key.commitment_key->commit(polynomial);
+                commitment = proving_key->proving_key.commitment_key->commit_auto(polynomial);
             }
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
@@ -167,10 +168,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
     // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
     {
         PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
-        witness_commitments.lookup_read_counts =
-            proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_counts);
-        witness_commitments.lookup_read_tags =
-            proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_tags);
+        witness_commitments.lookup_read_counts = proving_key->proving_key.commitment_key->commit_auto(
+            proving_key->proving_key.polynomials.lookup_read_counts);
+        witness_commitments.lookup_read_tags = proving_key->proving_key.commitment_key->commit_auto(
+            proving_key->proving_key.polynomials.lookup_read_tags);
     }
     {
         PROFILE_THIS_NAME("COMMIT::wires");
@@ -1,9 +1,12 @@
 // AUTOGENERATED FILE
 #include "circuit_builder.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <mutex>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/thread.hpp"
@@ -15,9 +18,51 @@
 #include "barretenberg/relations/generic_permutation/generic_permutation_relation.hpp"
 #include "barretenberg/vm/stats.hpp"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace bb::avm {
 
 AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() const
+{
+    return compute_polynomials([](size_t) {});
+}
+
+AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials_and_clear_trace()
+{
+    size_t num_released_rows = 0;
+    auto polys = compute_polynomials([&](size_t num_copied_rows) {
+        release_rows(num_released_rows, num_copied_rows);
+        num_released_rows = num_copied_rows;
+    });
+    clear_trace();
+    return polys;
+}
+
+/**
+ * @brief Returns the memory of the rows in [begin, end) to the OS. Only the pages lying entirely in the rows
+ * copied so far are released, the rows in them must not be read afterwards.
+ */
+void AvmCircuitBuilder::release_rows([[maybe_unused]] size_t begin, [[maybe_unused]] size_t end)
+{
+#ifdef __linux__
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto data = reinterpret_cast<uintptr_t>(rows.data());
+    // Rounding begin down releases the page straddling the previous block boundary, which is fully copied by now.
+    // The page holding the start of the allocation may be shared with other heap data and is kept.
+    const uintptr_t first_page = (data + page_size - 1) & ~(page_size - 1);
+    const uintptr_t from = std::max(first_page, (data + begin * sizeof(Row)) & ~(page_size - 1));
+    const uintptr_t to = (data + end * sizeof(Row)) & ~(page_size - 1);
+    if (to > from) {
+        madvise(reinterpret_cast<void*>(from), to - from, MADV_DONTNEED);
+    }
+#endif
+}
+
+AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials(
+    const std::function<void(size_t)>& on_rows_copied) const
 {
     const size_t num_rows = get_estimated_num_finalized_gates();
     const size_t circuit_subgroup_size = get_circuit_subgroup_size();
@@ -41,27 +86,15 @@ AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() co
         polys_to_cols_unshifted_idx[i] = names_to_col_idx.at(labels[i]);
     }
 
-    // Allocate mem for each column
-    AVM_TRACK_TIME("circuit_builder/init_polys_to_be_shifted", ({
-                       for (auto& poly : polys.get_to_be_shifted()) {
-                           poly = Polynomial{ /*memory size*/ num_rows - 1,
-                                              /*largest possible index*/ circuit_subgroup_size,
-                                              /*make shiftable with offset*/ 1 };
-                       }
-                   }));
+    // An array which stores for each column of the trace the smallest size of the
+    // truncated column containing all non-zero elements.
+    // It is used to allocate the polynomials without memory overhead for the tail of zeros.
+    std::array<size_t, Row::SIZE> col_nonzero_size{};
 
-    // catch-all with fully formed polynomials
-    AVM_TRACK_TIME("circuit_builder/init_polys_unshifted", ({
-                       auto unshifted = polys.get_unshifted();
-
-                       // An array which stores for each column of the trace the smallest size of the
-                       // truncated column containing all non-zero elements.
-                       // It is used to allocate the polynomials without memory overhead for the tail of zeros.
-                       std::array<size_t, Row::SIZE> col_nonzero_size{};
-
-                       // Computation of size of columns.
-                       // Non-parallel version takes 0.5 second for a trace size of 200k rows.
-                       // A parallel version might be considered in the future.
+    // Computation of size of columns.
+    // Non-parallel version takes 0.5 second for a trace size of 200k rows.
+    // A parallel version might be considered in the future.
+    AVM_TRACK_TIME("circuit_builder/compute_col_nonzero_size", ({
                        for (size_t i = 0; i < num_rows; i++) {
                            const auto row = rows[i].as_vector();
                            for (size_t col = 0; col < Row::SIZE; col++) {
@@ -70,32 +103,49 @@ AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() co
                                }
                            }
                        }
-
-                       // Set of the labels for derived/inverse polynomials.
-                       const auto derived_labels = polys.get_derived_labels();
-                       std::set<std::string> derived_labels_set(derived_labels.begin(), derived_labels.end());
-
-                       bb::parallel_for(num_unshifted, [&](size_t i) {
-                           auto& poly = unshifted[i];
-                           const auto col_idx = polys_to_cols_unshifted_idx[i];
-                           const bool is_derived = derived_labels_set.contains(labels[i]);
-
-                           if (poly.is_empty()) {
-                               // Not set above. Non-derived unshifted polynomials are initialized below. The
-                               // non-derived ones do need to be initialized with zeros and are fully allocated (size ==
-                               // num_rows).
-                               poly = is_derived
-                                          ? Polynomial::create_non_parallel_zero_init(num_rows, circuit_subgroup_size)
-                                          : Polynomial{ col_nonzero_size[col_idx],
-                                                        circuit_subgroup_size,
-                                                        Polynomial::DontZeroMemory::FLAG };
-                           }
-                       });
                    }));
 
+    // Allocate mem for each column. The memory is not zeroed as every backed index is set from the rows below, so
+    // that the pages of a polynomial are only touched as the rows are copied (and released).
+    AVM_TRACK_TIME(
+        "circuit_builder/init_polys_unshifted", ({
+            auto unshifted = polys.get_unshifted();
+
+            // Set of the labels for derived/inverse polynomials.
+            const auto derived_labels = polys.get_derived_labels();
+            std::set<std::string> derived_labels_set(derived_labels.begin(), derived_labels.end());
+
+            // Set of the to-be-shifted polynomials, which are made shiftable with an offset of 1.
+            std::unordered_set<const Polynomial*> to_be_shifted_set;
+            for (const auto& poly : polys.get_to_be_shifted()) {
+                to_be_shifted_set.insert(&poly);
+            }
+
+            bb::parallel_for(num_unshifted, [&](size_t i) {
+                auto& poly = unshifted[i];
+                const auto col_idx = polys_to_cols_unshifted_idx[i];
+
+                // The derived polynomials are not part of the rows, they are allocated once the rows are copied.
+                if (derived_labels_set.contains(labels[i])) {
+                    return;
+                }
+                if (to_be_shifted_set.contains(&poly)) {
+                    // The first row of a shifted column is zero.
+                    poly = Polynomial{ /*memory size*/ std::max<size_t>(col_nonzero_size[col_idx], 1) - 1,
+                                       /*largest possible index*/ circuit_subgroup_size,
+                                       /*make shiftable with offset*/ 1,
+                                       Polynomial::DontZeroMemory::FLAG };
+                } else {
+                    poly = Polynomial{ col_nonzero_size[col_idx],
+                                       circuit_subgroup_size,
+                                       Polynomial::DontZeroMemory::FLAG };
+                }
+            });
+        }));
+
     AVM_TRACK_TIME(
         "circuit_builder/set_polys_unshifted", ({
-            bb::parallel_for(rows.size(), [&](size_t i) {
+            const auto set_row = [&](size_t i) {
                 polys.byte_lookup_sel_bin.set_if_valid_index(i, rows[i].byte_lookup_sel_bin);
                 polys.byte_lookup_table_byte_lengths.set_if_valid_index(i, rows[i].byte_lookup_table_byte_lengths);
                 polys.byte_lookup_table_in_tags.set_if_valid_index(i, rows[i].byte_lookup_table_in_tags);
@@ -813,9 +863,36 @@ AvmCircuitBuilder::ProverPolynomials AvmCircuitBuilder::compute_polynomials() co
                 polys.lookup_ret_value_counts.set_if_valid_index(i, rows[i].lookup_ret_value_counts);
                 polys.incl_main_tag_err_counts.set_if_valid_index(i, rows[i].incl_main_tag_err_counts);
                 polys.incl_mem_tag_err_counts.set_if_valid_index(i, rows[i].incl_mem_tag_err_counts);
-            });
+            };
+            for (size_t block_start = 0; block_start < num_rows; block_start += ROWS_PER_BLOCK) {
+                const size_t block_end = std::min(block_start + ROWS_PER_BLOCK, num_rows);
+                bb::parallel_for(block_end - block_start, [&](size_t j) { set_row(block_start + j); });
+                on_rows_copied(block_end);
+            }
         }));
 
+    // The inverses are only allocated once all the rows are copied, hence released by
+    // compute_polynomials_and_clear_trace. They are zero outside of the rows where the selectors of their relation
+    // are backed, so only these rows are allocated.
+    AVM_TRACK_TIME("circuit_builder/init_polys_derived", ({
+                       bb::constexpr_for<0, std::tuple_size_v<Flavor::LookupRelations>, 1>([&]<size_t relation_idx>() {
+                           using Relation = std::tuple_element_t<relation_idx, Flavor::LookupRelations>;
+                           size_t start = num_rows;
+                           size_t end = 0;
+                           const auto extend_active_range = [&](const Polynomial& selector) {
+                               if (!selector.is_empty()) {
+                                   start = std::min(start, selector.start_index());
+                                   end = std::max(end, selector.end_index());
+                               }
+                           };
+                           std::apply([&](const auto&... selector) { (extend_active_range(selector), ...); },
+                                      Relation::get_inverse_selector_entities(std::as_const(polys)));
+                           Relation::get_inverse_polynomial(polys) =
+                               start < end ? Polynomial{ end - start, circuit_subgroup_size, start }
+                                           : Polynomial{ 0, circuit_subgroup_size };
+                       });
+                   }));
+
     AVM_TRACK_TIME("circuit_builder/set_polys_shifted", ({
                        for (auto [shifted, to_be_shifted] : zip_view(polys.get_shifted(), polys.get_to_be_shifted())) {
                            shifted = to_be_shifted.shifted();
@@ -1,6 +1,7 @@
 // AUTOGENERATED FILE
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "flavor.hpp"
@@ -32,6 +33,9 @@ class AvmCircuitBuilder {
     }
 
     ProverPolynomials compute_polynomials() const;
+    // Same as compute_polynomials() but the trace is consumed: the memory of the rows is released as they are copied
+    // into the polynomials, so that the whole trace and all the polynomials are never held at the same time.
+    ProverPolynomials compute_polynomials_and_clear_trace();
 
     bool check_circuit() const;
 
@@ -40,8 +44,15 @@ class AvmCircuitBuilder {
     size_t get_circuit_subgroup_size() const { return CIRCUIT_SUBGROUP_SIZE; }
 
   private:
+    // The rows are copied into the polynomials in blocks of this many rows.
+    constexpr static size_t ROWS_PER_BLOCK = 1 << 12;
+
     size_t num_rows = 0;
     std::vector<Row> rows;
+
+    // Calls on_rows_copied(n) each time the first n rows have been copied into the polynomials.
+    ProverPolynomials compute_polynomials(const std::function<void(size_t)>& on_rows_copied) const;
+    void release_rows(size_t begin, size_t end);
 };
 
 } // namespace bb::avm
\ No newline at end of file
@@ -11,7 +11,8 @@ void AvmComposer::compute_witness(CircuitConstructor& circuit)
         return;
     }
 
-    auto polynomials = circuit.compute_polynomials();
+    // The trace is not needed once the polynomials are computed, consuming it keeps the peak memory down.
+    auto polynomials = circuit.compute_polynomials_and_clear_trace();
 
     for (auto [key_poly, prover_poly] : zip_view(proving_key->get_all(), polynomials.get_unshifted())) {
         ASSERT(flavor_get_label(*proving_key, key_poly) == flavor_get_label(polynomials, prover_poly));
@@ -0,0 +1,85 @@
+#include "barretenberg/vm/avm/generated/circuit_builder.hpp"
+#include "barretenberg/vm/avm/generated/flavor.hpp"
+#include "barretenberg/vm/avm/generated/full_row.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace tests_avm {
+
+using namespace bb;
+using namespace bb::avm;
+
+namespace {
+
+// Value in KiB of the given field of /proc/self/status, 0 if it can not be read
+size_t read_status_kib(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind(field, 0) == 0) {
+            return std::stoul(line.substr(field.size()));
+        }
+    }
+    return 0;
+}
+
+// Reset the peak resident set size to the current one (Linux only)
+void reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+} // namespace
+
+/**
+ * @brief The trace is released while it is copied into the polynomials, and the polynomials are only allocated
+ * where the columns are non-zero, so that computing them out of a sparse trace barely grows the peak memory.
+ */
+TEST(AvmCircuitBuilder, computePolynomialsAndClearTracePeakMemory)
+{
+#ifndef __linux__
+    GTEST_SKIP() << "The peak resident set size is only measured on Linux";
+#endif
+    using FF = AvmFlavor::FF;
+    using Row = AvmFullRow<FF>;
+    constexpr size_t NUM_ROWS = 1 << 13;
+
+    // A trace with a few non-zero columns: a clock, a to-be-shifted column and the selector of a permutation which is
+    // only on in the first half of the trace.
+    std::vector<Row> trace(NUM_ROWS);
+    for (size_t i = 1; i < NUM_ROWS; i++) {
+        trace[i].main_clk = i;
+        trace[i].binary_acc_ia = i;
+        trace[i].main_sel_alu = i < NUM_ROWS / 2 ? 1 : 0;
+    }
+    const size_t trace_kib = NUM_ROWS * sizeof(Row) / 1024;
+
+    AvmCircuitBuilder circuit_builder;
+    circuit_builder.set_trace(std::move(trace));
+
+    reset_peak_rss();
+    const size_t peak_before_kib = read_status_kib("VmHWM:");
+    if (peak_before_kib == 0 || peak_before_kib > read_status_kib("VmRSS:") + (trace_kib / 100)) {
+        GTEST_SKIP() << "The peak resident set size can not be measured";
+    }
+    auto polys = circuit_builder.compute_polynomials_and_clear_trace();
+    const size_t peak_after_kib = read_status_kib("VmHWM:");
+
+    // Zero-filling the to-be-shifted and derived polynomials over the whole trace would take a fifth of the trace.
+    EXPECT_LT(peak_after_kib, peak_before_kib + (trace_kib / 10));
+
+    for (size_t i = 0; i < NUM_ROWS; i++) {
+        EXPECT_EQ(polys.main_clk[i], FF(i));
+        EXPECT_EQ(polys.binary_acc_ia_shift[i], i + 1 < NUM_ROWS ? FF(i + 1) : FF(0));
+    }
+    EXPECT_EQ(polys.perm_main_alu_inv.end_index(), NUM_ROWS / 2);
+    EXPECT_TRUE(polys.perm_main_bin_inv.is_empty());
+}
+
+} // namespace tests_avm
@@ -2419,4 +2419,63 @@ TEST_F(AvmExecutionTests, truncatedInstructionNoOperand)
     ASSERT_EQ(error, AvmError::PARSING_ERROR);
 }
 
+// Positive test that the pre-decoded bytecode agrees with parsing at every pc, including the pcs that static parsing
+// does not reach: those in the middle of an instruction and the ones after an invalid opcode.
+TEST_F(AvmExecutionTests, decodedBytecodeMatchesParse)
+{
+    std::string bytecode_hex = to_hex(OpCode::SET_16) +           // opcode SET
+                               "00"                               // Indirect flag
+                               "00AA"                             // dst_offset 170
+                               + to_hex(AvmMemoryTag::U16) +      //
+                               "B813"                             // val 47123
+                               + to_hex(OpCode::SET_128) +        // opcode SET
+                               "00"                               // Indirect flag
+                               "0033"                             // dst_offset 51
+                               + to_hex(AvmMemoryTag::U128) +     //
+                               "0123456789ABCDEF0011223344556677" // val
+                               + to_hex(OpCode::ADD_16) +         // opcode ADD
+                               "00"                               // Indirect flag
+                               "00AA"                             // addr a 170
+                               "0033"                             // addr b 51
+                               "0001"                             // addr c 1
+                               "AB"                               // Invalid opcode byte
+                               "0000";                            // ret offset 0
+
+    auto bytecode = hex_to_bytes(bytecode_hex);
+    const DecodedBytecode decoded(bytecode);
+    ASSERT_EQ(decoded.size(), bytecode.size());
+
+    for (uint32_t pc = 0; pc < bytecode.size(); pc++) {
+        const auto [expected, expected_error] = Deserialization::parse(bytecode, pc);
+        const auto [inst, error] = decoded.get_instruction(pc);
+        EXPECT_EQ(error, expected_error) << "pc " << pc;
+        EXPECT_EQ(inst.op_code, expected.op_code) << "pc " << pc;
+    }
+
+    const auto set_16 = decoded.get_instruction(0).instruction;
+    EXPECT_EQ(set_16.op_code, OpCode::SET_16);
+    EXPECT_EQ(set_16.operand<uint16_t>(1), 170);
+    EXPECT_EQ(set_16.operand<AvmMemoryTag>(2), AvmMemoryTag::U16);
+    EXPECT_EQ(set_16.operand<uint16_t>(3), 47123);
+
+    const uint32_t set_128_pc = Deserialization::get_pc_increment(OpCode::SET_16);
+    const auto set_128 = decoded.get_instruction(set_128_pc).instruction;
+    EXPECT_EQ(set_128.op_code, OpCode::SET_128);
+    EXPECT_EQ(set_128.operand<uint16_t>(1), 51);
+    EXPECT_EQ(set_128.operand<AvmMemoryTag>(2), AvmMemoryTag::U128);
+    const uint128_t value = (uint128_t{ 0x0123456789ABCDEF } << 64) + uint128_t{ 0x0011223344556677 };
+    EXPECT_EQ(set_128.operand<FF>(3), FF(uint256_t::from_uint128(value)));
+
+    const uint32_t add_pc = set_128_pc + Deserialization::get_pc_increment(OpCode::SET_128);
+    const auto add = decoded.get_instruction(add_pc).instruction;
+    EXPECT_EQ(add.op_code, OpCode::ADD_16);
+    EXPECT_EQ(add.operand<uint8_t>(0), 0);
+    EXPECT_EQ(add.operand<uint16_t>(1), 170);
+    EXPECT_EQ(add.operand<uint16_t>(2), 51);
+    EXPECT_EQ(add.operand<uint16_t>(3), 1);
+
+    const uint32_t invalid_pc = add_pc + Deserialization::get_pc_increment(OpCode::ADD_16);
+    EXPECT_EQ(decoded.get_instruction(invalid_pc).error, AvmError::INVALID_OPCODE);
+}
+
 } // namespace tests_avm
@@ -0,0 +1,110 @@
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/vm/avm/generated/circuit_builder.hpp"
+#include "barretenberg/vm/avm/generated/flavor.hpp"
+#include "barretenberg/vm/avm/tests/helpers.test.hpp"
+#include "barretenberg/vm/avm/trace/common.hpp"
+#include "common.test.hpp"
+
+#include <array>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace tests_avm {
+
+using namespace bb;
+using namespace bb::avm;
+using namespace bb::avm_trace;
+
+namespace {
+
+using LookupRelations = AvmFlavor::LookupRelations;
+constexpr size_t NUM_LOOKUP_RELATIONS = std::tuple_size_v<LookupRelations>;
+
+/**
+ * @brief The inverse polynomials of all lookup and permutation relations, computed one row at a time from the whole
+ * row of the polynomials, and batch inverted in a single pass. This is how compute_logderivative_inverse used to
+ * compute them before the rows were split into chunks.
+ */
+std::array<Polynomial<FF>, NUM_LOOKUP_RELATIONS> compute_serial_inverses(const AvmFlavor::ProverPolynomials& polys,
+                                                                         const RelationParameters<FF>& params,
+                                                                         const size_t num_rows)
+{
+    std::array<Polynomial<FF>, NUM_LOOKUP_RELATIONS> inverses;
+    for (auto& inverse : inverses) {
+        inverse = Polynomial<FF>(num_rows);
+    }
+    for (size_t i = 0; i < num_rows; ++i) {
+        const auto row = polys.get_row(i);
+        bb::constexpr_for<0, NUM_LOOKUP_RELATIONS, 1>([&]<size_t relation_idx>() {
+            using Relation = std::tuple_element_t<relation_idx, LookupRelations>;
+            if (!Relation::operation_exists_at_row(row)) {
+                return;
+            }
+            FF denominator = 1;
+            bb::constexpr_for<0, Relation::READ_TERMS, 1>([&]<size_t read_index> {
+                denominator *= Relation::template compute_read_term<FF, read_index>(row, params);
+            });
+            bb::constexpr_for<0, Relation::WRITE_TERMS, 1>([&]<size_t write_index> {
+                denominator *= Relation::template compute_write_term<FF, write_index>(row, params);
+            });
+            inverses[relation_idx].at(i) = denominator;
+        });
+    }
+    for (auto& inverse : inverses) {
+        FF::batch_invert(inverse.coeffs());
+    }
+    return inverses;
+}
+
+} // namespace
+
+/**
+ * @brief The inverses computed row-parallel from the input columns of each relation are the ones of the serial
+ * computation, on the trace of a program which exercises the ALU, the comparisons, the bitwise operations and the
+ * range checks.
+ */
+TEST(AvmLogDerivativeInverse, chunkedInversesMatchSerial)
+{
+    auto trace_builder = AvmTraceBuilder(generate_base_public_inputs())
+                             .set_full_precomputed_tables(false)
+                             .set_range_check_required(false);
+    trace_builder.op_set(0, 19, 0, AvmMemoryTag::U64);
+    trace_builder.op_set(0, 15, 1, AvmMemoryTag::U64);
+    trace_builder.op_add(0, 0, 1, 2);
+    trace_builder.op_mul(0, 2, 1, 3);
+    trace_builder.op_lt(0, 1, 3, 4);
+    trace_builder.op_and(0, 3, 0, 5);
+    trace_builder.op_xor(0, 5, 1, 6);
+    trace_builder.op_set(0, 1, 100, AvmMemoryTag::U32);
+    trace_builder.op_return(0, 6, 100);
+    auto trace = trace_builder.finalize();
+
+    AvmCircuitBuilder circuit_builder;
+    circuit_builder.set_trace(std::move(trace));
+    auto polys = circuit_builder.compute_polynomials();
+    const size_t num_rows = circuit_builder.get_estimated_num_finalized_gates();
+
+    const RelationParameters<FF> params{
+        .beta = FF::random_element(),
+        .gamma = FF::random_element(),
+    };
+    const auto expected_inverses = compute_serial_inverses(polys, params, num_rows);
+
+    size_t num_nonzero_inverses = 0;
+    bb::constexpr_for<0, NUM_LOOKUP_RELATIONS, 1>([&]<size_t relation_idx>() {
+        using Relation = std::tuple_element_t<relation_idx, LookupRelations>;
+        bb::compute_logderivative_inverse<AvmFlavor, Relation>(polys, params, num_rows);
+
+        const auto& inverse = Relation::get_inverse_polynomial(polys);
+        const auto& expected_inverse = expected_inverses[relation_idx];
+        for (size_t i = 0; i < num_rows; ++i) {
+            ASSERT_EQ(inverse[i], expected_inverse[i]) << Relation::NAME << " differs at row " << i;
+            num_nonzero_inverses += expected_inverse[i].is_zero() ? 0 : 1;
+        }
+    });
+    // Sanity check that the trace has lookups and permutations to invert
+    EXPECT_GT(num_nonzero_inverses, 0);
+}
+
+} // namespace tests_avm
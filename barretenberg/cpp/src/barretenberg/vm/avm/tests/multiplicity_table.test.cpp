@@ -0,0 +1,55 @@
+#include "barretenberg/vm/avm/trace/multiplicity_table.hpp"
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+namespace tests_avm {
+
+using namespace bb::avm_trace;
+
+TEST(AvmMultiplicityTable, countsAndMerges)
+{
+    MultiplicityTable<uint16_t> table;
+    MultiplicityTable<uint16_t> other;
+    EXPECT_EQ(MultiplicityTable<uint16_t>::domain_size(), 1 << 16);
+
+    table[7]++;
+    table[7]++;
+    table[UINT16_MAX]++;
+    other[7]++;
+    other[3] += 5;
+    table.merge(other);
+
+    EXPECT_EQ(table[3], 5);
+    EXPECT_EQ(table[7], 3);
+    EXPECT_EQ(table[UINT16_MAX], 1);
+    EXPECT_EQ(table[8], 0);
+
+    // Only the non-zero counts are visited, in key order
+    std::vector<std::pair<uint16_t, uint32_t>> visited;
+    table.for_each_nonzero([&](uint16_t key, uint32_t count) { visited.emplace_back(key, count); });
+    std::vector<std::pair<uint16_t, uint32_t>> expected = { { 3, 5 }, { 7, 3 }, { UINT16_MAX, 1 } };
+    EXPECT_EQ(visited, expected);
+
+    table.clear();
+    visited.clear();
+    table.for_each_nonzero([&](uint16_t key, uint32_t count) { visited.emplace_back(key, count); });
+    EXPECT_TRUE(visited.empty());
+}
+
+TEST(AvmMultiplicityTable, enumKeys)
+{
+    MultiplicityTable<OpCode, static_cast<size_t>(OpCode::LAST_OPCODE_SENTINEL)> table;
+    table[OpCode::ADD_8]++;
+    table[OpCode::RETURN]++;
+    table[OpCode::RETURN]--;
+
+    std::vector<OpCode> visited;
+    table.for_each_nonzero([&](OpCode opcode, uint32_t) { visited.push_back(opcode); });
+    EXPECT_EQ(visited, std::vector<OpCode>{ OpCode::ADD_8 });
+}
+
+} // namespace tests_avm
@@ -0,0 +1,80 @@
+#include "barretenberg/vm/avm/trace/paged_memory.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+namespace tests_avm {
+
+using namespace bb::avm_trace;
+
+namespace {
+struct Word {
+    uint64_t val = 0;
+    uint8_t tag = 0;
+};
+using Memory = PagedMemory<Word, 4>;
+} // namespace
+
+TEST(AvmPagedMemory, readsAndWrites)
+{
+    Memory memory;
+    EXPECT_EQ(memory.get(12345).val, 0);
+    EXPECT_EQ(memory.num_pages(), 0);
+
+    memory.set(3, { 30, 1 });
+    memory.set(UINT32_MAX, { 40, 2 });
+    EXPECT_EQ(memory.get(3).val, 30);
+    EXPECT_EQ(memory.get(3).tag, 1);
+    EXPECT_EQ(memory.get(UINT32_MAX).val, 40);
+    EXPECT_EQ(memory.get(4).val, 0);
+    EXPECT_EQ(memory.num_pages(), 2);
+
+    memory.set(3, { 31, 1 });
+    EXPECT_EQ(memory.get(3).val, 31);
+
+    memory.clear();
+    EXPECT_EQ(memory.get(3).val, 0);
+    EXPECT_EQ(memory.num_pages(), 0);
+}
+
+TEST(AvmPagedMemory, slicesAcrossPages)
+{
+    Memory memory;
+    // Spans three pages of 16 words
+    const uint32_t base = 10;
+    const uint32_t size = 30;
+    memory.for_each_in_slice(base, size, [&](uint32_t addr, Word& word) { word.val = addr * 2; });
+    EXPECT_EQ(memory.num_pages(), 3);
+
+    std::vector<uint32_t> addresses;
+    std::as_const(memory).for_each_in_slice(base - 2, size + 4, [&](uint32_t addr, Word const& word) {
+        addresses.push_back(addr);
+        const bool in_slice = addr >= base && addr < base + size;
+        EXPECT_EQ(word.val, in_slice ? addr * 2 : 0);
+    });
+    EXPECT_EQ(addresses.size(), size + 4);
+    EXPECT_EQ(addresses.front(), base - 2);
+    EXPECT_EQ(addresses.back(), base + size + 1);
+
+    // Reading does not allocate the pages that were never written
+    std::as_const(memory).for_each_in_slice(1000, 100, [](uint32_t, Word const&) {});
+    EXPECT_EQ(memory.num_pages(), 3);
+}
+
+TEST(AvmPagedMemory, sliceWrapsAround)
+{
+    Memory memory;
+    memory.for_each_in_slice(UINT32_MAX - 1, 4, [&](uint32_t addr, Word& word) { word.val = uint64_t{ addr } + 1; });
+
+    std::vector<uint32_t> addresses;
+    std::as_const(memory).for_each_in_slice(UINT32_MAX - 1, 4, [&](uint32_t addr, Word const& word) {
+        addresses.push_back(addr);
+        EXPECT_EQ(word.val, uint64_t{ addr } + 1);
+    });
+    EXPECT_EQ(addresses, (std::vector<uint32_t>{ UINT32_MAX - 1, UINT32_MAX, 0, 1 }));
+    EXPECT_EQ(memory.get(1).val, 2);
+}
+
+} // namespace tests_avm
@@ -4,11 +4,11 @@
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
 #include "barretenberg/vm/avm/trace/gadgets/cmp.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_table.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 #include <array>
 #include <cstdint>
 #include <optional>
-#include <unordered_map>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -63,8 +63,8 @@ class AvmAluTraceBuilder {
         bool cmp_op_is_eq = false;
     };
 
-    std::array<std::unordered_map<uint8_t, uint32_t>, 2> u8_range_chk_counters;
-    std::array<std::unordered_map<uint8_t, uint32_t>, 2> u8_pow_2_counters;
+    std::array<MultiplicityTable<uint8_t>, 2> u8_range_chk_counters;
+    std::array<MultiplicityTable<uint8_t>, 2> u8_pow_2_counters;
 
     AvmAluTraceBuilder() = default;
     size_t size() const { return alu_trace.size(); }
@@ -192,9 +192,8 @@ void AvmBinaryTraceBuilder::finalize(std::vector<AvmFullRow<FF>>& main_trace)
 
 void AvmBinaryTraceBuilder::finalize_lookups(std::vector<AvmFullRow<FF>>& main_trace)
 {
-    for (auto const& [clk, count] : byte_operation_counter) {
-        main_trace.at(clk).lookup_byte_operations_counts = count;
-    }
+    byte_operation_counter.for_each_nonzero(
+        [&](uint32_t clk, uint32_t count) { main_trace.at(clk).lookup_byte_operations_counts = count; });
 
     for (uint8_t avm_in_tag = static_cast<uint8_t>(AvmMemoryTag::U1);
          avm_in_tag <= static_cast<uint8_t>(AvmMemoryTag::U128);
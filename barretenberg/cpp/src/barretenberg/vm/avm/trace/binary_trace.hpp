@@ -3,8 +3,10 @@
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_table.hpp"
 
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 
 namespace bb::avm_trace {
 
@@ -29,8 +31,12 @@ class AvmBinaryTraceBuilder {
         uint8_t bin_ic_bytes = 0;
     };
 
-    std::unordered_map<uint32_t, uint32_t> byte_operation_counter;
-    std::unordered_map<uint32_t, uint32_t> byte_length_counter;
+    // Indexed by the row of the bytes table: (op_id << 16) + (a << 8) + b, for the AND, OR and XOR op_ids
+    static constexpr size_t BYTE_OPERATIONS_TABLE_SIZE = size_t{ 3 } << 16;
+    using ByteOperationCounter = MultiplicityTable<uint32_t, BYTE_OPERATIONS_TABLE_SIZE>;
+
+    ByteOperationCounter byte_operation_counter;
+    MultiplicityTable<uint8_t> byte_length_counter;
 
     AvmBinaryTraceBuilder() = default;
 
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -364,4 +365,29 @@ ParsedBytecode Deserialization::parse_bytecode_statically(const std::vector<uint
     };
 }
 
+DecodedBytecode::DecodedBytecode(std::vector<uint8_t> raw_bytecode)
+    : bytecode(std::move(raw_bytecode))
+    , instruction_index(bytecode.size(), NOT_DECODED)
+{
+    // On a parsing error only the instructions before it are decoded, the rest are left to get_instruction
+    const ParsedBytecode parsed = Deserialization::parse_bytecode_statically(bytecode);
+    instructions.reserve(parsed.instructions.size());
+    uint32_t pc = 0;
+    for (const auto& instruction : parsed.instructions) {
+        instruction_index[pc] = static_cast<uint32_t>(instructions.size());
+        instructions.emplace_back(instruction);
+        pc += Deserialization::get_pc_increment(instruction.op_code);
+    }
+}
+
+DecodedInstructionWithError DecodedBytecode::get_instruction(uint32_t pc) const
+{
+    if (pc < instruction_index.size() && instruction_index[pc] != NOT_DECODED) {
+        return DecodedInstructionWithError{ .instruction = instructions[instruction_index[pc]],
+                                            .error = AvmError::NO_ERROR };
+    }
+    const auto [instruction, error] = Deserialization::parse(bytecode, pc);
+    return DecodedInstructionWithError{ .instruction = DecodedInstruction(instruction), .error = error };
+}
+
 } // namespace bb::avm_trace
@@ -4,6 +4,7 @@
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 #include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -28,4 +29,29 @@ class Deserialization {
     static uint32_t get_pc_increment(OpCode opcode);
 };
 
+/**
+ * @brief Bytecode decoded once, ahead of execution. The instructions found by parse_bytecode_statically are held in
+ * their compact form and looked up by pc, rather than being parsed each time they are executed.
+ */
+class DecodedBytecode {
+  public:
+    explicit DecodedBytecode(std::vector<uint8_t> raw_bytecode);
+
+    size_t size() const { return bytecode.size(); }
+
+    /**
+     * @brief Returns the instruction starting at pc. A pc that static parsing did not reach, i.e. one in the middle
+     * of an instruction or beyond a parsing error, is parsed on demand.
+     */
+    DecodedInstructionWithError get_instruction(uint32_t pc) const;
+
+  private:
+    static constexpr uint32_t NOT_DECODED = std::numeric_limits<uint32_t>::max();
+
+    std::vector<uint8_t> bytecode;
+    std::vector<DecodedInstruction> instructions;
+    // The position in instructions of the instruction starting at each pc, or NOT_DECODED
+    std::vector<uint32_t> instruction_index;
+};
+
 } // namespace bb::avm_trace
@@ -242,9 +242,7 @@ std::tuple<bb::avm::AvmFlavor::VerificationKey, HonkProof> Execution::prove(AvmP
     auto composer = AVM_TRACK_TIME_V("prove/create_composer", bb::avm::AvmComposer());
     auto prover = AVM_TRACK_TIME_V("prove/create_prover", composer.create_prover(circuit_builder));
     auto verifier = AVM_TRACK_TIME_V("prove/create_verifier", composer.create_verifier(circuit_builder));
-    // Reclaim memory. Ideally this would be done as soon as the polynomials are created, but the above flow requires
-    // the trace both in creation of the prover and the verifier.
-    circuit_builder.clear_trace();
+    // The trace was consumed when the witness polynomials were computed in create_prover.
 
     vinfo("------- PROVING EXECUTION -------");
     // Proof structure: public_inputs | calldata_size | calldata | returndata_size | returndata | raw proof
@@ -446,8 +444,8 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
     };
     trace_builder.allocate_gas_for_call(l2_gas_allocated_to_enqueued_call, da_gas_allocated_to_enqueued_call);
     // Find the bytecode based on contract address of the public call request
-    std::vector<uint8_t> bytecode =
-        trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address, check_bytecode_membership);
+    const DecodedBytecode* bytecode = &trace_builder.get_decoded_bytecode(
+        trace_builder.current_ext_call_ctx.contract_address, check_bytecode_membership);
 
     // Copied version of pc maintained in trace builder. The value of pc is evolving based
     // on opcode logic and therefore is not maintained here. However, the next opcode in the execution
@@ -456,8 +454,8 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
     std::stack<uint32_t> debug_counter_stack;
     uint32_t counter = 0;
     trace_builder.set_call_ptr(context_id);
-    while ((pc = trace_builder.get_pc()) < bytecode.size()) {
-        auto [inst, parse_error] = Deserialization::parse(bytecode, pc);
+    while ((pc = trace_builder.get_pc()) < bytecode->size()) {
+        auto [inst, parse_error] = bytecode->get_instruction(pc);
 
         // FIXME: properly handle case when an instruction fails parsing
         // especially first instruction in bytecode
@@ -466,262 +464,265 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
             break;
         }
 
-        debug("[PC:" + std::to_string(pc) + "] [IC:" + std::to_string(counter++) + "] " + inst.to_string() +
-              " (gasLeft l2=" + std::to_string(trace_builder.get_l2_gas_left()) + ")");
+        // Only build the message when it is printed, this runs once per executed instruction
+        if (debug_logging) {
+            debug("[PC:" + std::to_string(pc) + "] [IC:" + std::to_string(counter) + "] " + inst.to_string() +
+                  " (gasLeft l2=" + std::to_string(trace_builder.get_l2_gas_left()) + ")");
+        }
+        counter++;
 
         switch (inst.op_code) {
             // Compute
             // Compute - Arithmetic
         case OpCode::ADD_8:
-            error = trace_builder.op_add(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_add(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::ADD_8);
             break;
         case OpCode::ADD_16:
-            error = trace_builder.op_add(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_add(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::ADD_16);
             break;
         case OpCode::SUB_8:
-            error = trace_builder.op_sub(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_sub(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::SUB_8);
             break;
         case OpCode::SUB_16:
-            error = trace_builder.op_sub(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_sub(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::SUB_16);
             break;
         case OpCode::MUL_8:
-            error = trace_builder.op_mul(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_mul(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::MUL_8);
             break;
         case OpCode::MUL_16:
-            error = trace_builder.op_mul(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_mul(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::MUL_16);
             break;
         case OpCode::DIV_8:
-            error = trace_builder.op_div(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_div(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::DIV_8);
             break;
         case OpCode::DIV_16:
-            error = trace_builder.op_div(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_div(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::DIV_16);
             break;
         case OpCode::FDIV_8:
-            error = trace_builder.op_fdiv(std::get<uint8_t>(inst.operands.at(0)),
-                                          std::get<uint8_t>(inst.operands.at(1)),
-                                          std::get<uint8_t>(inst.operands.at(2)),
-                                          std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_fdiv(inst.operand<uint8_t>(0),
+                                          inst.operand<uint8_t>(1),
+                                          inst.operand<uint8_t>(2),
+                                          inst.operand<uint8_t>(3),
                                           OpCode::FDIV_8);
             break;
         case OpCode::FDIV_16:
-            error = trace_builder.op_fdiv(std::get<uint8_t>(inst.operands.at(0)),
-                                          std::get<uint16_t>(inst.operands.at(1)),
-                                          std::get<uint16_t>(inst.operands.at(2)),
-                                          std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_fdiv(inst.operand<uint8_t>(0),
+                                          inst.operand<uint16_t>(1),
+                                          inst.operand<uint16_t>(2),
+                                          inst.operand<uint16_t>(3),
                                           OpCode::FDIV_16);
             break;
         case OpCode::EQ_8:
-            error = trace_builder.op_eq(std::get<uint8_t>(inst.operands.at(0)),
-                                        std::get<uint8_t>(inst.operands.at(1)),
-                                        std::get<uint8_t>(inst.operands.at(2)),
-                                        std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_eq(inst.operand<uint8_t>(0),
+                                        inst.operand<uint8_t>(1),
+                                        inst.operand<uint8_t>(2),
+                                        inst.operand<uint8_t>(3),
                                         OpCode::EQ_8);
             break;
         case OpCode::EQ_16:
-            error = trace_builder.op_eq(std::get<uint8_t>(inst.operands.at(0)),
-                                        std::get<uint16_t>(inst.operands.at(1)),
-                                        std::get<uint16_t>(inst.operands.at(2)),
-                                        std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_eq(inst.operand<uint8_t>(0),
+                                        inst.operand<uint16_t>(1),
+                                        inst.operand<uint16_t>(2),
+                                        inst.operand<uint16_t>(3),
                                         OpCode::EQ_16);
             break;
         case OpCode::LT_8:
-            error = trace_builder.op_lt(std::get<uint8_t>(inst.operands.at(0)),
-                                        std::get<uint8_t>(inst.operands.at(1)),
-                                        std::get<uint8_t>(inst.operands.at(2)),
-                                        std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_lt(inst.operand<uint8_t>(0),
+                                        inst.operand<uint8_t>(1),
+                                        inst.operand<uint8_t>(2),
+                                        inst.operand<uint8_t>(3),
                                         OpCode::LT_8);
             break;
         case OpCode::LT_16:
-            error = trace_builder.op_lt(std::get<uint8_t>(inst.operands.at(0)),
-                                        std::get<uint16_t>(inst.operands.at(1)),
-                                        std::get<uint16_t>(inst.operands.at(2)),
-                                        std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_lt(inst.operand<uint8_t>(0),
+                                        inst.operand<uint16_t>(1),
+                                        inst.operand<uint16_t>(2),
+                                        inst.operand<uint16_t>(3),
                                         OpCode::LT_16);
             break;
         case OpCode::LTE_8:
-            error = trace_builder.op_lte(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_lte(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::LTE_8);
             break;
         case OpCode::LTE_16:
-            error = trace_builder.op_lte(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_lte(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::LTE_16);
             break;
         case OpCode::AND_8:
-            error = trace_builder.op_and(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_and(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::AND_8);
             break;
         case OpCode::AND_16:
-            error = trace_builder.op_and(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_and(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::AND_16);
             break;
         case OpCode::OR_8:
-            error = trace_builder.op_or(std::get<uint8_t>(inst.operands.at(0)),
-                                        std::get<uint8_t>(inst.operands.at(1)),
-                                        std::get<uint8_t>(inst.operands.at(2)),
-                                        std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_or(inst.operand<uint8_t>(0),
+                                        inst.operand<uint8_t>(1),
+                                        inst.operand<uint8_t>(2),
+                                        inst.operand<uint8_t>(3),
                                         OpCode::OR_8);
             break;
         case OpCode::OR_16:
-            error = trace_builder.op_or(std::get<uint8_t>(inst.operands.at(0)),
-                                        std::get<uint16_t>(inst.operands.at(1)),
-                                        std::get<uint16_t>(inst.operands.at(2)),
-                                        std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_or(inst.operand<uint8_t>(0),
+                                        inst.operand<uint16_t>(1),
+                                        inst.operand<uint16_t>(2),
+                                        inst.operand<uint16_t>(3),
                                         OpCode::OR_16);
             break;
         case OpCode::XOR_8:
-            error = trace_builder.op_xor(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_xor(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::XOR_8);
             break;
         case OpCode::XOR_16:
-            error = trace_builder.op_xor(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_xor(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::XOR_16);
             break;
         case OpCode::NOT_8:
-            error = trace_builder.op_not(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
+            error = trace_builder.op_not(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
                                          OpCode::NOT_8);
             break;
         case OpCode::NOT_16:
-            error = trace_builder.op_not(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
+            error = trace_builder.op_not(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
                                          OpCode::NOT_16);
             break;
         case OpCode::SHL_8:
-            error = trace_builder.op_shl(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_shl(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::SHL_8);
             break;
         case OpCode::SHL_16:
-            error = trace_builder.op_shl(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_shl(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::SHL_16);
             break;
         case OpCode::SHR_8:
-            error = trace_builder.op_shr(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
+            error = trace_builder.op_shr(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
+                                         inst.operand<uint8_t>(3),
                                          OpCode::SHR_8);
             break;
         case OpCode::SHR_16:
-            error = trace_builder.op_shr(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
+            error = trace_builder.op_shr(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
+                                         inst.operand<uint16_t>(3),
                                          OpCode::SHR_16);
             break;
 
             // Compute - Type Conversions
         case OpCode::CAST_8:
-            error = trace_builder.op_cast(std::get<uint8_t>(inst.operands.at(0)),
-                                          std::get<uint8_t>(inst.operands.at(1)),
-                                          std::get<uint8_t>(inst.operands.at(2)),
-                                          std::get<AvmMemoryTag>(inst.operands.at(3)),
+            error = trace_builder.op_cast(inst.operand<uint8_t>(0),
+                                          inst.operand<uint8_t>(1),
+                                          inst.operand<uint8_t>(2),
+                                          inst.operand<AvmMemoryTag>(3),
                                           OpCode::CAST_8);
             break;
         case OpCode::CAST_16:
-            error = trace_builder.op_cast(std::get<uint8_t>(inst.operands.at(0)),
-                                          std::get<uint16_t>(inst.operands.at(1)),
-                                          std::get<uint16_t>(inst.operands.at(2)),
-                                          std::get<AvmMemoryTag>(inst.operands.at(3)),
+            error = trace_builder.op_cast(inst.operand<uint8_t>(0),
+                                          inst.operand<uint16_t>(1),
+                                          inst.operand<uint16_t>(2),
+                                          inst.operand<AvmMemoryTag>(3),
                                           OpCode::CAST_16);
             break;
 
             // Execution Environment
             // TODO(https://github.com/AztecProtocol/aztec-packages/issues/6284): support indirect for below
         case OpCode::GETENVVAR_16:
-            error = trace_builder.op_get_env_var(std::get<uint8_t>(inst.operands.at(0)),
-                                                 std::get<uint16_t>(inst.operands.at(1)),
-                                                 std::get<uint8_t>(inst.operands.at(2)));
+            error = trace_builder.op_get_env_var(inst.operand<uint8_t>(0),
+                                                 inst.operand<uint16_t>(1),
+                                                 inst.operand<uint8_t>(2));
             break;
 
             // Execution Environment - Calldata
         case OpCode::CALLDATACOPY:
-            error = trace_builder.op_calldata_copy(std::get<uint8_t>(inst.operands.at(0)),
-                                                   std::get<uint16_t>(inst.operands.at(1)),
-                                                   std::get<uint16_t>(inst.operands.at(2)),
-                                                   std::get<uint16_t>(inst.operands.at(3)));
+            error = trace_builder.op_calldata_copy(inst.operand<uint8_t>(0),
+                                                   inst.operand<uint16_t>(1),
+                                                   inst.operand<uint16_t>(2),
+                                                   inst.operand<uint16_t>(3));
             break;
 
         case OpCode::RETURNDATASIZE:
-            error = trace_builder.op_returndata_size(std::get<uint8_t>(inst.operands.at(0)),
-                                                     std::get<uint16_t>(inst.operands.at(1)));
+            error = trace_builder.op_returndata_size(inst.operand<uint8_t>(0), inst.operand<uint16_t>(1));
             break;
 
         case OpCode::RETURNDATACOPY:
-            error = trace_builder.op_returndata_copy(std::get<uint8_t>(inst.operands.at(0)),
-                                                     std::get<uint16_t>(inst.operands.at(1)),
-                                                     std::get<uint16_t>(inst.operands.at(2)),
-                                                     std::get<uint16_t>(inst.operands.at(3)));
+            error = trace_builder.op_returndata_copy(inst.operand<uint8_t>(0),
+                                                     inst.operand<uint16_t>(1),
+                                                     inst.operand<uint16_t>(2),
+                                                     inst.operand<uint16_t>(3));
             break;
 
             // Machine State - Internal Control Flow
         case OpCode::JUMP_32:
-            error = trace_builder.op_jump(std::get<uint32_t>(inst.operands.at(0)));
+            error = trace_builder.op_jump(inst.operand<uint32_t>(0));
             break;
         case OpCode::JUMPI_32:
-            error = trace_builder.op_jumpi(std::get<uint8_t>(inst.operands.at(0)),
-                                           std::get<uint16_t>(inst.operands.at(1)),
-                                           std::get<uint32_t>(inst.operands.at(2)));
+            error = trace_builder.op_jumpi(inst.operand<uint8_t>(0),
+                                           inst.operand<uint16_t>(1),
+                                           inst.operand<uint32_t>(2));
             break;
         case OpCode::INTERNALCALL:
-            error = trace_builder.op_internal_call(std::get<uint32_t>(inst.operands.at(0)));
+            error = trace_builder.op_internal_call(inst.operand<uint32_t>(0));
             break;
         case OpCode::INTERNALRETURN:
             error = trace_builder.op_internal_return();
@@ -729,166 +730,164 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
 
             // Machine State - Memory
         case OpCode::SET_8: {
-            error = trace_builder.op_set(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(3)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<AvmMemoryTag>(inst.operands.at(2)),
+            error = trace_builder.op_set(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(3),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<AvmMemoryTag>(2),
                                          OpCode::SET_8);
             break;
         }
         case OpCode::SET_16: {
-            error = trace_builder.op_set(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(3)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<AvmMemoryTag>(inst.operands.at(2)),
+            error = trace_builder.op_set(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(3),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<AvmMemoryTag>(2),
                                          OpCode::SET_16);
             break;
         }
         case OpCode::SET_32: {
-            error = trace_builder.op_set(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint32_t>(inst.operands.at(3)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<AvmMemoryTag>(inst.operands.at(2)),
+            error = trace_builder.op_set(inst.operand<uint8_t>(0),
+                                         inst.operand<uint32_t>(3),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<AvmMemoryTag>(2),
                                          OpCode::SET_32);
             break;
         }
         case OpCode::SET_64: {
-            error = trace_builder.op_set(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint64_t>(inst.operands.at(3)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<AvmMemoryTag>(inst.operands.at(2)),
+            error = trace_builder.op_set(inst.operand<uint8_t>(0),
+                                         inst.operand<uint64_t>(3),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<AvmMemoryTag>(2),
                                          OpCode::SET_64);
             break;
         }
         case OpCode::SET_128: {
-            error = trace_builder.op_set(std::get<uint8_t>(inst.operands.at(0)),
-                                         uint256_t::from_uint128(std::get<uint128_t>(inst.operands.at(3))),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<AvmMemoryTag>(inst.operands.at(2)),
+            error = trace_builder.op_set(inst.operand<uint8_t>(0),
+                                         inst.operand<FF>(3),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<AvmMemoryTag>(2),
                                          OpCode::SET_128);
             break;
         }
         case OpCode::SET_FF: {
-            error = trace_builder.op_set(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<FF>(inst.operands.at(3)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<AvmMemoryTag>(inst.operands.at(2)),
+            error = trace_builder.op_set(inst.operand<uint8_t>(0),
+                                         inst.operand<FF>(3),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<AvmMemoryTag>(2),
                                          OpCode::SET_FF);
             break;
         }
         case OpCode::MOV_8:
-            error = trace_builder.op_mov(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint8_t>(inst.operands.at(1)),
-                                         std::get<uint8_t>(inst.operands.at(2)),
+            error = trace_builder.op_mov(inst.operand<uint8_t>(0),
+                                         inst.operand<uint8_t>(1),
+                                         inst.operand<uint8_t>(2),
                                          OpCode::MOV_8);
             break;
         case OpCode::MOV_16:
-            error = trace_builder.op_mov(std::get<uint8_t>(inst.operands.at(0)),
-                                         std::get<uint16_t>(inst.operands.at(1)),
-                                         std::get<uint16_t>(inst.operands.at(2)),
+            error = trace_builder.op_mov(inst.operand<uint8_t>(0),
+                                         inst.operand<uint16_t>(1),
+                                         inst.operand<uint16_t>(2),
                                          OpCode::MOV_16);
             break;
 
             // World State
         case OpCode::SLOAD:
-            error = trace_builder.op_sload(std::get<uint8_t>(inst.operands.at(0)),
-                                           std::get<uint16_t>(inst.operands.at(1)),
-                                           std::get<uint16_t>(inst.operands.at(2)));
+            error = trace_builder.op_sload(inst.operand<uint8_t>(0),
+                                           inst.operand<uint16_t>(1),
+                                           inst.operand<uint16_t>(2));
             break;
         case OpCode::SSTORE:
-            error = trace_builder.op_sstore(std::get<uint8_t>(inst.operands.at(0)),
-                                            std::get<uint16_t>(inst.operands.at(1)),
-                                            std::get<uint16_t>(inst.operands.at(2)));
+            error = trace_builder.op_sstore(inst.operand<uint8_t>(0),
+                                            inst.operand<uint16_t>(1),
+                                            inst.operand<uint16_t>(2));
             break;
         case OpCode::NOTEHASHEXISTS:
-            error = trace_builder.op_note_hash_exists(std::get<uint8_t>(inst.operands.at(0)),
-                                                      std::get<uint16_t>(inst.operands.at(1)),
-                                                      std::get<uint16_t>(inst.operands.at(2)),
-                                                      std::get<uint16_t>(inst.operands.at(3)));
+            error = trace_builder.op_note_hash_exists(inst.operand<uint8_t>(0),
+                                                      inst.operand<uint16_t>(1),
+                                                      inst.operand<uint16_t>(2),
+                                                      inst.operand<uint16_t>(3));
             break;
         case OpCode::EMITNOTEHASH:
-            error = trace_builder.op_emit_note_hash(std::get<uint8_t>(inst.operands.at(0)),
-                                                    std::get<uint16_t>(inst.operands.at(1)));
+            error = trace_builder.op_emit_note_hash(inst.operand<uint8_t>(0), inst.operand<uint16_t>(1));
             break;
         case OpCode::NULLIFIEREXISTS:
-            error = trace_builder.op_nullifier_exists(std::get<uint8_t>(inst.operands.at(0)),
-                                                      std::get<uint16_t>(inst.operands.at(1)),
-                                                      std::get<uint16_t>(inst.operands.at(2)),
-                                                      std::get<uint16_t>(inst.operands.at(3)));
+            error = trace_builder.op_nullifier_exists(inst.operand<uint8_t>(0),
+                                                      inst.operand<uint16_t>(1),
+                                                      inst.operand<uint16_t>(2),
+                                                      inst.operand<uint16_t>(3));
             break;
         case OpCode::EMITNULLIFIER:
-            error = trace_builder.op_emit_nullifier(std::get<uint8_t>(inst.operands.at(0)),
-                                                    std::get<uint16_t>(inst.operands.at(1)));
+            error = trace_builder.op_emit_nullifier(inst.operand<uint8_t>(0), inst.operand<uint16_t>(1));
             break;
 
         case OpCode::L1TOL2MSGEXISTS:
-            error = trace_builder.op_l1_to_l2_msg_exists(std::get<uint8_t>(inst.operands.at(0)),
-                                                         std::get<uint16_t>(inst.operands.at(1)),
-                                                         std::get<uint16_t>(inst.operands.at(2)),
-                                                         std::get<uint16_t>(inst.operands.at(3)));
+            error = trace_builder.op_l1_to_l2_msg_exists(inst.operand<uint8_t>(0),
+                                                         inst.operand<uint16_t>(1),
+                                                         inst.operand<uint16_t>(2),
+                                                         inst.operand<uint16_t>(3));
             break;
         case OpCode::GETCONTRACTINSTANCE:
-            error = trace_builder.op_get_contract_instance(std::get<uint8_t>(inst.operands.at(0)),
-                                                           std::get<uint16_t>(inst.operands.at(1)),
-                                                           std::get<uint16_t>(inst.operands.at(2)),
-                                                           std::get<uint16_t>(inst.operands.at(3)),
-                                                           std::get<uint8_t>(inst.operands.at(4)));
+            error = trace_builder.op_get_contract_instance(inst.operand<uint8_t>(0),
+                                                           inst.operand<uint16_t>(1),
+                                                           inst.operand<uint16_t>(2),
+                                                           inst.operand<uint16_t>(3),
+                                                           inst.operand<uint8_t>(4));
             break;
 
             // Accrued Substate
         case OpCode::EMITUNENCRYPTEDLOG:
-            error = trace_builder.op_emit_unencrypted_log(std::get<uint8_t>(inst.operands.at(0)),
-                                                          std::get<uint16_t>(inst.operands.at(1)),
-                                                          std::get<uint16_t>(inst.operands.at(2)));
+            error = trace_builder.op_emit_unencrypted_log(inst.operand<uint8_t>(0),
+                                                          inst.operand<uint16_t>(1),
+                                                          inst.operand<uint16_t>(2));
             break;
         case OpCode::SENDL2TOL1MSG:
-            error = trace_builder.op_emit_l2_to_l1_msg(std::get<uint8_t>(inst.operands.at(0)),
-                                                       std::get<uint16_t>(inst.operands.at(1)),
-                                                       std::get<uint16_t>(inst.operands.at(2)));
+            error = trace_builder.op_emit_l2_to_l1_msg(inst.operand<uint8_t>(0),
+                                                       inst.operand<uint16_t>(1),
+                                                       inst.operand<uint16_t>(2));
             break;
 
             // Control Flow - Contract Calls
         case OpCode::CALL: {
-            error = trace_builder.op_call(std::get<uint16_t>(inst.operands.at(0)),
-                                          std::get<uint16_t>(inst.operands.at(1)),
-                                          std::get<uint16_t>(inst.operands.at(2)),
-                                          std::get<uint16_t>(inst.operands.at(3)),
-                                          std::get<uint16_t>(inst.operands.at(4)),
-                                          std::get<uint16_t>(inst.operands.at(5)));
+            error = trace_builder.op_call(inst.operand<uint16_t>(0),
+                                          inst.operand<uint16_t>(1),
+                                          inst.operand<uint16_t>(2),
+                                          inst.operand<uint16_t>(3),
+                                          inst.operand<uint16_t>(4),
+                                          inst.operand<uint16_t>(5));
             // TODO: what if an error is encountered on return or call which have already modified stack?
             // We hack it in here the logic to change contract address that we are processing
-            bytecode = trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address,
-                                                  /*check_membership=*/false);
+            bytecode = &trace_builder.get_decoded_bytecode(trace_builder.current_ext_call_ctx.contract_address,
+                                                           /*check_membership=*/false);
             debug_counter_stack.push(counter);
             counter = 0;
             break;
         }
         case OpCode::STATICCALL: {
-            error = trace_builder.op_static_call(std::get<uint16_t>(inst.operands.at(0)),
-                                                 std::get<uint16_t>(inst.operands.at(1)),
-                                                 std::get<uint16_t>(inst.operands.at(2)),
-                                                 std::get<uint16_t>(inst.operands.at(3)),
-                                                 std::get<uint16_t>(inst.operands.at(4)),
-                                                 std::get<uint16_t>(inst.operands.at(5)));
+            error = trace_builder.op_static_call(inst.operand<uint16_t>(0),
+                                                 inst.operand<uint16_t>(1),
+                                                 inst.operand<uint16_t>(2),
+                                                 inst.operand<uint16_t>(3),
+                                                 inst.operand<uint16_t>(4),
+                                                 inst.operand<uint16_t>(5));
             // We hack it in here the logic to change contract address that we are processing
-            bytecode = trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address,
-                                                  /*check_membership=*/false);
+            bytecode = &trace_builder.get_decoded_bytecode(trace_builder.current_ext_call_ctx.contract_address,
+                                                           /*check_membership=*/false);
             debug_counter_stack.push(counter);
             counter = 0;
             break;
         }
         case OpCode::RETURN: {
-            auto ret = trace_builder.op_return(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint16_t>(inst.operands.at(1)),
-                                               std::get<uint16_t>(inst.operands.at(2)));
+            auto ret = trace_builder.op_return(inst.operand<uint8_t>(0),
+                                               inst.operand<uint16_t>(1),
+                                               inst.operand<uint16_t>(2));
             // did the return opcode hit an exceptional halt?
             error = ret.error;
             if (ret.is_top_level) {
                 returndata.insert(returndata.end(), ret.return_data.begin(), ret.return_data.end());
             } else if (is_ok(error)) {
                 // switch back to caller's bytecode
-                bytecode = trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address,
-                                                      /*check_membership=*/false);
+                bytecode = &trace_builder.get_decoded_bytecode(trace_builder.current_ext_call_ctx.contract_address,
+                                                               /*check_membership=*/false);
                 counter = debug_counter_stack.top();
                 debug_counter_stack.pop();
             }
@@ -897,9 +896,9 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
         }
         case OpCode::REVERT_8: {
             info("HIT REVERT_8  ", "[PC=" + std::to_string(pc) + "] " + inst.to_string());
-            auto ret = trace_builder.op_revert(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint8_t>(inst.operands.at(1)),
-                                               std::get<uint8_t>(inst.operands.at(2)));
+            auto ret = trace_builder.op_revert(inst.operand<uint8_t>(0),
+                                               inst.operand<uint8_t>(1),
+                                               inst.operand<uint8_t>(2));
             // error is only set here if the revert opcode hit an exceptional halt
             // revert itself does not trigger "error"
             error = ret.error;
@@ -907,8 +906,8 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
                 returndata.insert(returndata.end(), ret.return_data.begin(), ret.return_data.end());
             } else if (is_ok(error)) {
                 // switch back to caller's bytecode
-                bytecode = trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address,
-                                                      /*check_membership=*/false);
+                bytecode = &trace_builder.get_decoded_bytecode(trace_builder.current_ext_call_ctx.contract_address,
+                                                               /*check_membership=*/false);
                 counter = debug_counter_stack.top();
                 debug_counter_stack.pop();
             }
@@ -917,9 +916,9 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
         }
         case OpCode::REVERT_16: {
             info("HIT REVERT_16 ", "[PC=" + std::to_string(pc) + "] " + inst.to_string());
-            auto ret = trace_builder.op_revert(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint16_t>(inst.operands.at(1)),
-                                               std::get<uint16_t>(inst.operands.at(2)));
+            auto ret = trace_builder.op_revert(inst.operand<uint8_t>(0),
+                                               inst.operand<uint16_t>(1),
+                                               inst.operand<uint16_t>(2));
             // error is only set here if the revert opcode hit an exceptional halt
             // revert itself does not trigger "error"
             error = ret.error;
@@ -927,8 +926,8 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
                 returndata.insert(returndata.end(), ret.return_data.begin(), ret.return_data.end());
             } else if (is_ok(error)) {
                 // switch back to caller's bytecode
-                bytecode = trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address,
-                                                      /*check_membership=*/false);
+                bytecode = &trace_builder.get_decoded_bytecode(trace_builder.current_ext_call_ctx.contract_address,
+                                                               /*check_membership=*/false);
                 counter = debug_counter_stack.top();
                 debug_counter_stack.pop();
             }
@@ -938,61 +937,61 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
 
             // Misc
         case OpCode::DEBUGLOG:
-            error = trace_builder.op_debug_log(std::get<uint8_t>(inst.operands.at(0)),
-                                               std::get<uint16_t>(inst.operands.at(1)),
-                                               std::get<uint16_t>(inst.operands.at(2)),
-                                               std::get<uint16_t>(inst.operands.at(3)),
-                                               std::get<uint16_t>(inst.operands.at(4)));
+            error = trace_builder.op_debug_log(inst.operand<uint8_t>(0),
+                                               inst.operand<uint16_t>(1),
+                                               inst.operand<uint16_t>(2),
+                                               inst.operand<uint16_t>(3),
+                                               inst.operand<uint16_t>(4));
             break;
 
             // Gadgets
         case OpCode::POSEIDON2PERM:
-            error = trace_builder.op_poseidon2_permutation(std::get<uint8_t>(inst.operands.at(0)),
-                                                           std::get<uint16_t>(inst.operands.at(1)),
-                                                           std::get<uint16_t>(inst.operands.at(2)));
+            error = trace_builder.op_poseidon2_permutation(inst.operand<uint8_t>(0),
+                                                           inst.operand<uint16_t>(1),
+                                                           inst.operand<uint16_t>(2));
 
             break;
 
         case OpCode::SHA256COMPRESSION:
-            error = trace_builder.op_sha256_compression(std::get<uint8_t>(inst.operands.at(0)),
-                                                        std::get<uint16_t>(inst.operands.at(1)),
-                                                        std::get<uint16_t>(inst.operands.at(2)),
-                                                        std::get<uint16_t>(inst.operands.at(3)));
+            error = trace_builder.op_sha256_compression(inst.operand<uint8_t>(0),
+                                                        inst.operand<uint16_t>(1),
+                                                        inst.operand<uint16_t>(2),
+                                                        inst.operand<uint16_t>(3));
             break;
 
         case OpCode::KECCAKF1600:
-            error = trace_builder.op_keccakf1600(std::get<uint8_t>(inst.operands.at(0)),
-                                                 std::get<uint16_t>(inst.operands.at(1)),
-                                                 std::get<uint16_t>(inst.operands.at(2)));
+            error = trace_builder.op_keccakf1600(inst.operand<uint8_t>(0),
+                                                 inst.operand<uint16_t>(1),
+                                                 inst.operand<uint16_t>(2));
 
             break;
 
         case OpCode::ECADD:
-            error = trace_builder.op_ec_add(std::get<uint16_t>(inst.operands.at(0)),
-                                            std::get<uint16_t>(inst.operands.at(1)),
-                                            std::get<uint16_t>(inst.operands.at(2)),
-                                            std::get<uint16_t>(inst.operands.at(3)),
-                                            std::get<uint16_t>(inst.operands.at(4)),
-                                            std::get<uint16_t>(inst.operands.at(5)),
-                                            std::get<uint16_t>(inst.operands.at(6)),
-                                            std::get<uint16_t>(inst.operands.at(7)));
+            error = trace_builder.op_ec_add(inst.operand<uint16_t>(0),
+                                            inst.operand<uint16_t>(1),
+                                            inst.operand<uint16_t>(2),
+                                            inst.operand<uint16_t>(3),
+                                            inst.operand<uint16_t>(4),
+                                            inst.operand<uint16_t>(5),
+                                            inst.operand<uint16_t>(6),
+                                            inst.operand<uint16_t>(7));
             break;
         case OpCode::MSM:
-            error = trace_builder.op_variable_msm(std::get<uint8_t>(inst.operands.at(0)),
-                                                  std::get<uint16_t>(inst.operands.at(1)),
-                                                  std::get<uint16_t>(inst.operands.at(2)),
-                                                  std::get<uint16_t>(inst.operands.at(3)),
-                                                  std::get<uint16_t>(inst.operands.at(4)));
+            error = trace_builder.op_variable_msm(inst.operand<uint8_t>(0),
+                                                  inst.operand<uint16_t>(1),
+                                                  inst.operand<uint16_t>(2),
+                                                  inst.operand<uint16_t>(3),
+                                                  inst.operand<uint16_t>(4));
             break;
 
             // Conversions
         case OpCode::TORADIXBE:
-            error = trace_builder.op_to_radix_be(std::get<uint16_t>(inst.operands.at(0)),
-                                                 std::get<uint16_t>(inst.operands.at(1)),
-                                                 std::get<uint16_t>(inst.operands.at(2)),
-                                                 std::get<uint16_t>(inst.operands.at(3)),
-                                                 std::get<uint16_t>(inst.operands.at(4)),
-                                                 std::get<uint16_t>(inst.operands.at(5)));
+            error = trace_builder.op_to_radix_be(inst.operand<uint16_t>(0),
+                                                 inst.operand<uint16_t>(1),
+                                                 inst.operand<uint16_t>(2),
+                                                 inst.operand<uint16_t>(3),
+                                                 inst.operand<uint16_t>(4),
+                                                 inst.operand<uint16_t>(5));
             break;
 
         default:
@@ -1022,8 +1021,8 @@ AvmError Execution::execute_enqueued_call(AvmTraceBuilder& trace_builder,
             }
             // otherwise, handle exceptional halt and proceed with execution in caller/parent
             // We hack it in here the logic to change contract address that we are processing
-            bytecode = trace_builder.get_bytecode(trace_builder.current_ext_call_ctx.contract_address,
-                                                  /*check_membership=*/false);
+            bytecode = &trace_builder.get_decoded_bytecode(trace_builder.current_ext_call_ctx.contract_address,
+                                                           /*check_membership=*/false);
             counter = debug_counter_stack.top();
             debug_counter_stack.pop();
 
@@ -44,12 +44,13 @@ void FixedBytesTable::finalize(std::vector<AvmFullRow<FF>>& main_trace) const
     finalize_byte_length(main_trace);
 }
 
-void FixedBytesTable::finalize_for_testing(std::vector<AvmFullRow<FF>>& main_trace,
-                                           const std::unordered_map<uint32_t, uint32_t>& byte_operation_counter) const
+void FixedBytesTable::finalize_for_testing(
+    std::vector<AvmFullRow<FF>>& main_trace,
+    const AvmBinaryTraceBuilder::ByteOperationCounter& byte_operation_counter) const
 {
     // Generate ByteLength Lookup table of instruction tags to the number of bytes
     // {U8: 1, U16: 2, U32: 4, U64: 8, U128: 16}
-    for (auto const& [clk, count] : byte_operation_counter) {
+    byte_operation_counter.for_each_nonzero([&](uint32_t clk, uint32_t count) {
         // from the clk we can derive the a and b inputs
         auto b = static_cast<uint8_t>(clk);
         auto a = static_cast<uint8_t>(clk >> 8);
@@ -81,7 +82,7 @@ void FixedBytesTable::finalize_for_testing(std::vector<AvmFullRow<FF>>& main_tra
             main_trace.at(clk).byte_lookup_table_output = bit_op;
         }
         // Add the counter value stored throughout the execution
-    }
+    });
 
     finalize_byte_length(main_trace);
 }
@@ -28,19 +28,12 @@ void AvmRangeCheckBuilder::combine_range_builders(AvmRangeCheckBuilder const& ot
     // Update counters
     // U16 counters
     for (size_t i = 0; i < 8; i++) {
-        const auto& row = other.u16_range_chk_counters[i];
-        for (auto const& [key, value] : row) {
-            u16_range_chk_counters[i][key] += value;
-        }
+        u16_range_chk_counters[i].merge(other.u16_range_chk_counters[i]);
     }
     // Powers of 2 counter
-    for (auto const& [key, value] : other.powers_of_2_counts) {
-        powers_of_2_counts[key] += value;
-    }
+    powers_of_2_counts.merge(other.powers_of_2_counts);
     // Dyn diff counter
-    for (auto const& [key, value] : other.dyn_diff_counts) {
-        dyn_diff_counts[key] += value;
-    }
+    dyn_diff_counts.merge(other.dyn_diff_counts);
 }
 
 /**************************************************************************************************
@@ -3,6 +3,7 @@
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/vm/avm/generated/relations/range_check.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_table.hpp"
 #include <cstdint>
 
 enum class EventEmitter { ALU, MEMORY, GAS_L2, GAS_DA, CMP_LO, CMP_HI, NON_FF_GT };
@@ -44,9 +45,9 @@ class AvmRangeCheckBuilder {
         bool operator<(RangeCheckEntry const& other) const { return clk < other.clk; }
     };
 
-    std::array<std::unordered_map<uint16_t, uint32_t>, 8> u16_range_chk_counters;
-    std::unordered_map<uint8_t, uint32_t> powers_of_2_counts;
-    std::unordered_map<uint16_t, uint32_t> dyn_diff_counts;
+    std::array<MultiplicityTable<uint16_t>, 8> u16_range_chk_counters;
+    MultiplicityTable<uint8_t> powers_of_2_counts;
+    MultiplicityTable<uint16_t> dyn_diff_counts;
 
     // This function just enqueues a range check event, we handle processing them later in finalize.
     bool assert_range(uint128_t value, uint8_t num_bits, EventEmitter e, uint64_t clk);
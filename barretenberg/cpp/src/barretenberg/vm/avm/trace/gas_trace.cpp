@@ -281,9 +281,9 @@ void AvmGasTraceBuilder::finalize_lookups(std::vector<AvmFullRow<FF>>& main_trac
 {
     // Finalise gas left lookup counts
     // TODO: find the right place for this. This is not really over the main trace, but over the opcode trace.
-    for (auto const& [opcode, count] : gas_opcode_lookup_counter) {
+    gas_opcode_lookup_counter.for_each_nonzero([&](OpCode opcode, uint32_t count) {
         main_trace.at(static_cast<uint8_t>(opcode)).lookup_opcode_gas_counts = count;
-    }
+    });
 }
 
 } // namespace bb::avm_trace
@@ -1,12 +1,17 @@
 #pragma once
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
 #include "barretenberg/vm/avm/trace/errors.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -56,4 +61,74 @@ struct InstructionWithError {
     AvmError error;
 };
 
+/**
+ * @brief Fixed size form of an Instruction used for dispatch during execution. Operands that fit in 64 bits are
+ * stored unboxed and the 128 bit or field immediate of a SET is stored as a field element, so that reading an operand
+ * involves neither a variant access nor a bounds check.
+ */
+class DecodedInstruction {
+  public:
+    // ECADD has the most operands
+    static constexpr size_t MAX_OPERANDS = 8;
+
+    OpCode op_code = OpCode::LAST_OPCODE_SENTINEL;
+
+    DecodedInstruction() = default;
+    explicit DecodedInstruction(const Instruction& instruction)
+        : op_code(instruction.op_code)
+        , num_operands(static_cast<uint8_t>(instruction.operands.size()))
+    {
+        ASSERT(instruction.operands.size() <= MAX_OPERANDS);
+        for (size_t i = 0; i < instruction.operands.size(); i++) {
+            std::visit([&](const auto& value) { set_operand(i, value); }, instruction.operands[i]);
+        }
+    }
+
+    /**
+     * @brief Returns operand i as its wire type. A 128 bit or field immediate is returned as an FF.
+     */
+    template <typename T> T operand(size_t i) const
+    {
+        if constexpr (std::is_same_v<T, FF>) {
+            return field_operand;
+        } else {
+            return static_cast<T>(operands[i]);
+        }
+    }
+
+    std::string to_string() const
+    {
+        std::string str = bb::avm_trace::to_string(op_code);
+        for (size_t i = 0; i < num_operands; i++) {
+            str += " ";
+            str += i == field_operand_index ? "someff" : std::to_string(operands[i]);
+        }
+        return str;
+    }
+
+  private:
+    uint8_t num_operands = 0;
+    size_t field_operand_index = MAX_OPERANDS;
+    std::array<uint64_t, MAX_OPERANDS> operands{};
+    FF field_operand{};
+
+    template <typename T> void set_operand(size_t i, const T& value)
+    {
+        if constexpr (std::is_same_v<T, FF>) {
+            field_operand = value;
+            field_operand_index = i;
+        } else if constexpr (std::is_same_v<T, uint128_t>) {
+            field_operand = FF(uint256_t::from_uint128(value));
+            field_operand_index = i;
+        } else {
+            operands[i] = static_cast<uint64_t>(value);
+        }
+    }
+};
+
+struct DecodedInstructionWithError {
+    DecodedInstruction instruction;
+    AvmError error;
+};
+
 } // namespace bb::avm_trace
@@ -15,7 +15,9 @@ void AvmMemTraceBuilder::reset()
 {
     mem_trace.clear();
     mem_trace.shrink_to_fit(); // Reclaim memory.
-    memory.fill({});
+    for (auto& mem_space : memory) {
+        mem_space.clear();
+    }
 }
 
 /**
@@ -168,8 +170,7 @@ bool AvmMemTraceBuilder::load_from_mem_trace(uint8_t space_id,
                                              AvmMemoryTag w_in_tag,
                                              MemOpOwner mem_op_owner)
 {
-    auto& mem_space = memory.at(space_id);
-    AvmMemoryTag m_tag = mem_space.contains(addr) ? mem_space.at(addr).tag : AvmMemoryTag::FF;
+    AvmMemoryTag m_tag = memory.at(space_id).get(addr).tag;
 
     if (m_tag == r_in_tag) {
         insert_in_mem_trace(space_id, clk, sub_clk, addr, val, m_tag, r_in_tag, w_in_tag, false, mem_op_owner);
@@ -239,8 +240,7 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_mov_opcode(uint8_
                                                                           uint32_t const clk,
                                                                           uint32_t const addr)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry mem_entry = mem_space.contains(addr) ? mem_space.at(addr) : MemEntry{};
+    MemEntry mem_entry = memory.at(space_id).get(addr);
 
     auto mem_trace_entry = MemoryTraceEntry({
         .m_space_id = space_id,
@@ -275,8 +275,7 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_jumpi_opcode(uint
                                                                             uint32_t clk,
                                                                             uint32_t cond_addr)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry cond_mem_entry = mem_space.contains(cond_addr) ? mem_space.at(cond_addr) : MemEntry{};
+    MemEntry cond_mem_entry = memory.at(space_id).get(cond_addr);
 
     auto mem_trace_entry = MemoryTraceEntry({
         .m_space_id = space_id,
@@ -314,8 +313,7 @@ AvmMemTraceBuilder::MemEntry AvmMemTraceBuilder::read_and_load_cast_opcode(uint8
                                                                            uint32_t addr,
                                                                            AvmMemoryTag w_in_tag)
 {
-    auto& mem_space = memory.at(space_id);
-    MemEntry mem_entry = mem_space.contains(addr) ? mem_space.at(addr) : MemEntry{};
+    MemEntry mem_entry = memory.at(space_id).get(addr);
 
     auto mem_trace_entry = MemoryTraceEntry({
         .m_space_id = space_id,
@@ -371,8 +369,7 @@ AvmMemTraceBuilder::MemRead AvmMemTraceBuilder::read_and_load_from_memory(uint8_
         sub_clk = SUB_CLK_LOAD_D;
         break;
     }
-    auto& mem_space = memory.at(space_id);
-    FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
+    FF val = memory.at(space_id).get(addr).val;
     bool tagMatch = load_from_mem_trace(space_id, clk, sub_clk, addr, val, r_in_tag, w_in_tag, mem_op_owner);
 
     return MemRead{
@@ -402,8 +399,7 @@ AvmMemTraceBuilder::MemRead AvmMemTraceBuilder::indirect_read_and_load_from_memo
         break;
     }
 
-    auto& mem_space = memory.at(space_id);
-    FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
+    FF val = memory.at(space_id).get(addr).val;
     bool tagMatch = load_from_mem_trace(space_id, clk, sub_clk, addr, val, AvmMemoryTag::U32, AvmMemoryTag::FF);
 
     return MemRead{
@@ -445,10 +441,10 @@ void AvmMemTraceBuilder::write_calldata_copy(std::vector<FF> const& calldata,
                                              uint32_t copy_size,
                                              uint32_t direct_dst_offset)
 {
-    for (uint32_t i = 0; i < copy_size; i++) {
-        auto addr = direct_dst_offset + i;
-        auto val = calldata.at(cd_offset + i);
-        write_in_simulated_mem_table(space_id, addr, val, AvmMemoryTag::FF);
+    // The memory words are written and the trace entries added in a single pass over the slice.
+    memory.at(space_id).for_each_in_slice(direct_dst_offset, copy_size, [&](uint32_t addr, MemEntry& mem_entry) {
+        const auto& val = calldata.at(cd_offset + (addr - direct_dst_offset));
+        mem_entry = MemEntry{ val, AvmMemoryTag::FF };
         insert_in_mem_trace(space_id,
                             clk,
                             SUB_CLK_STORE_A, // Specific re-use of this value for calldatacopy write slice.
@@ -459,7 +455,7 @@ void AvmMemTraceBuilder::write_calldata_copy(std::vector<FF> const& calldata,
                             AvmMemoryTag::FF,
                             true,
                             MemOpOwner::SLICE);
-    }
+    });
 }
 
 std::vector<FF> AvmMemTraceBuilder::read_return_opcode(uint32_t clk,
@@ -468,26 +464,24 @@ std::vector<FF> AvmMemTraceBuilder::read_return_opcode(uint32_t clk,
                                                        uint32_t ret_size)
 {
     std::vector<FF> returndata;
-    for (uint32_t i = 0; i < ret_size; i++) {
-        auto addr = direct_ret_offset + i;
-        auto& mem_space = memory.at(space_id);
-        FF val = mem_space.contains(addr) ? mem_space.at(addr).val : 0;
-        AvmMemoryTag tag = mem_space.contains(addr) ? mem_space.at(addr).tag : AvmMemoryTag::FF;
-
+    returndata.reserve(ret_size);
+    // Reading through a const reference does not allocate the pages that were never written.
+    auto const& mem_space = memory.at(space_id);
+    mem_space.for_each_in_slice(direct_ret_offset, ret_size, [&](uint32_t addr, MemEntry const& mem_entry) {
         // No tag checking is performed for RETURN opcode.
         insert_in_mem_trace(space_id,
                             clk,
                             SUB_CLK_LOAD_A, // Specific re-use of this value for return read slice.
                             addr,
-                            val,
-                            tag,
+                            mem_entry.val,
+                            mem_entry.tag,
                             AvmMemoryTag::FF,
                             AvmMemoryTag::FF,
                             false,
                             MemOpOwner::SLICE);
 
-        returndata.push_back(val);
-    }
+        returndata.push_back(mem_entry.val);
+    });
     return returndata;
 }
 
@@ -527,14 +521,7 @@ void AvmMemTraceBuilder::write_in_simulated_mem_table(uint8_t space_id,
                                                       FF const& val,
                                                       AvmMemoryTag w_in_tag)
 {
-    MemEntry memEntry{ val, w_in_tag };
-    auto& mem_space = memory.at(space_id);
-    auto it = mem_space.find(addr);
-    if (it != mem_space.end()) {
-        it->second = memEntry;
-    } else {
-        mem_space.emplace(addr, memEntry);
-    }
+    memory.at(space_id).set(addr, MemEntry{ val, w_in_tag });
 }
 
 } // namespace bb::avm_trace
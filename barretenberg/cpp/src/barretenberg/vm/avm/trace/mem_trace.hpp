@@ -1,6 +1,8 @@
 #pragma once
 
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_table.hpp"
+#include "barretenberg/vm/avm/trace/paged_memory.hpp"
 
 #include <cstdint>
 
@@ -106,19 +108,28 @@ class AvmMemTraceBuilder {
     std::vector<FF> read_return_opcode(uint32_t clk, uint8_t space_id, uint32_t direct_ret_offset, uint32_t ret_size);
 
     // DO NOT USE FOR REAL OPERATIONS
-    FF unconstrained_read(uint8_t space_id, uint32_t addr) { return memory[space_id][addr].val; }
-    AvmMemoryTag unconstrained_get_memory_tag(uint8_t space_id, uint32_t addr) { return memory[space_id][addr].tag; }
+    FF unconstrained_read(uint8_t space_id, uint32_t addr) const { return memory.at(space_id).get(addr).val; }
+    AvmMemoryTag unconstrained_get_memory_tag(uint8_t space_id, uint32_t addr) const
+    {
+        return memory.at(space_id).get(addr).tag;
+    }
+    // Calls func(val) for the values at addresses addr, ..., addr + size - 1. DO NOT USE FOR REAL OPERATIONS
+    template <typename Func>
+    void unconstrained_read_slice(uint8_t space_id, uint32_t addr, uint32_t size, Func&& func) const
+    {
+        memory.at(space_id).for_each_in_slice(addr, size, [&](uint32_t, MemEntry const& entry) { func(entry.val); });
+    }
 
     // Counters for memory diff range checks
-    std::unordered_map<uint16_t, uint32_t> mem_rng_chk_u16_0_counts;
-    std::unordered_map<uint16_t, uint32_t> mem_rng_chk_u16_1_counts;
-    std::unordered_map<uint8_t, uint32_t> mem_rng_chk_u8_counts;
+    MultiplicityTable<uint16_t> mem_rng_chk_u16_0_counts;
+    MultiplicityTable<uint16_t> mem_rng_chk_u16_1_counts;
+    MultiplicityTable<uint8_t> mem_rng_chk_u8_counts;
 
   private:
     std::vector<MemoryTraceEntry> mem_trace; // Entries will be sorted by m_clk, m_sub_clk after finalize().
 
-    // Global Memory table (used for simulation): (space_id, (address, mem_entry))
-    std::array<std::unordered_map<uint32_t, MemEntry>, NUM_MEM_SPACES> memory;
+    // Global Memory table (used for simulation): one paged memory per space_id
+    std::array<PagedMemory<MemEntry>, NUM_MEM_SPACES> memory;
 
     static void debug_mem_trace_entry(MemoryTraceEntry entry);
 
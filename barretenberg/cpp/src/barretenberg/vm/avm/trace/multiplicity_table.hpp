@@ -0,0 +1,65 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::avm_trace {
+
+/**
+ * @brief Lookup multiplicities for a small key domain, e.g. the values of an 8 or 16-bit range check or an opcode.
+ * @details The counts are held in a flat array indexed by the key, so counting is a single increment and finalizing
+ * the lookups is a linear scan in key order. A gadget that is populated by several threads can keep one table per
+ * thread and merge them before finalizing.
+ *
+ * @tparam Key an unsigned integer or enum type.
+ * @tparam DOMAIN_SIZE the number of keys, every key must be less than it. Defaults to the full range of Key.
+ */
+template <typename Key, size_t DOMAIN_SIZE = size_t{ 1 } << (8 * sizeof(Key))> class MultiplicityTable {
+  public:
+    MultiplicityTable()
+        : counts(DOMAIN_SIZE, 0)
+    {}
+
+    static constexpr size_t domain_size() { return DOMAIN_SIZE; }
+
+    uint32_t& operator[](Key key) { return counts[index(key)]; }
+    uint32_t operator[](Key key) const { return counts[index(key)]; }
+
+    void clear() { std::fill(counts.begin(), counts.end(), 0); }
+
+    // Adds the counts of another table, e.g. one populated by a different thread
+    void merge(const MultiplicityTable& other)
+    {
+        for (size_t i = 0; i < DOMAIN_SIZE; i++) {
+            counts[i] += other.counts[i];
+        }
+    }
+
+    /**
+     * @brief Calls func(key, count) for every key with a non-zero count, in increasing key order
+     */
+    template <typename Func> void for_each_nonzero(Func&& func) const
+    {
+        for (size_t i = 0; i < DOMAIN_SIZE; i++) {
+            if (counts[i] != 0) {
+                func(static_cast<Key>(i), counts[i]);
+            }
+        }
+    }
+
+  private:
+    std::vector<uint32_t> counts;
+
+    static size_t index(Key key)
+    {
+        const auto i = static_cast<size_t>(key);
+        ASSERT(i < DOMAIN_SIZE);
+        return i;
+    }
+};
+
+} // namespace bb::avm_trace
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::avm_trace {
+
+/**
+ * @brief The memory of a single address space, i.e. of a single context, for a 32-bit address range.
+ * @details The address range is split into fixed-size pages which are allocated on the first write to one of their
+ * addresses. The pages are found through a two-level page table, so that a few high addresses do not cost a table
+ * covering the whole range. Reading a word is a few array lookups and reading an address that was never written
+ * returns a default constructed entry. The slice accessors walk the slice page by page so that each page is looked up
+ * once.
+ *
+ * @tparam Entry the content of a memory word, e.g. a value and its tag.
+ * @tparam PAGE_BITS log2 of the number of words per page.
+ */
+template <typename Entry, size_t PAGE_BITS = 10> class PagedMemory {
+  public:
+    static constexpr size_t PAGE_SIZE = size_t{ 1 } << PAGE_BITS;
+    // The page number is split into an index in the top-level table and an index in a directory of pages.
+    static constexpr size_t DIRECTORY_BITS = (32 - PAGE_BITS) / 2;
+    static constexpr size_t DIRECTORY_SIZE = size_t{ 1 } << DIRECTORY_BITS;
+
+    Entry get(uint32_t addr) const
+    {
+        const auto* words = find_page(page_index(addr));
+        return words == nullptr ? Entry{} : (*words)[page_offset(addr)];
+    }
+
+    void set(uint32_t addr, Entry const& entry) { allocated_page(page_index(addr))[page_offset(addr)] = entry; }
+
+    void clear() { directories.clear(); }
+
+    // Number of allocated pages
+    size_t num_pages() const
+    {
+        size_t count = 0;
+        for (auto const& directory : directories) {
+            count += static_cast<size_t>(
+                std::count_if(directory.begin(), directory.end(), [](auto const& words) { return !words.empty(); }));
+        }
+        return count;
+    }
+
+    /**
+     * @brief Calls func(addr, entry) for the addresses addr, addr + 1, ..., addr + size - 1 in this order. Addresses
+     * wrap around modulo 2^32. The entries of addresses that were never written are default constructed.
+     */
+    template <typename Func> void for_each_in_slice(uint32_t addr, uint32_t size, Func&& func) const
+    {
+        const Entry empty{};
+        walk_slice(addr, size, [&](size_t page, size_t offset, size_t chunk) {
+            const auto* words = find_page(page);
+            for (size_t i = 0; i < chunk; i++) {
+                func(addr, words == nullptr ? empty : (*words)[offset + i]);
+                addr++;
+            }
+        });
+    }
+
+    /**
+     * @brief Same as the const version but the entries can be modified, e.g. to write a slice. The pages covering the
+     * slice are allocated.
+     */
+    template <typename Func> void for_each_in_slice(uint32_t addr, uint32_t size, Func&& func)
+    {
+        walk_slice(addr, size, [&](size_t page, size_t offset, size_t chunk) {
+            auto& words = allocated_page(page);
+            for (size_t i = 0; i < chunk; i++) {
+                func(addr, words[offset + i]);
+                addr++;
+            }
+        });
+    }
+
+  private:
+    // Indexed by (page number >> DIRECTORY_BITS), then by the low bits of the page number. Directories and pages
+    // which are not allocated are empty.
+    std::vector<std::vector<std::vector<Entry>>> directories;
+
+    static size_t page_index(uint32_t addr) { return static_cast<size_t>(addr) >> PAGE_BITS; }
+    static size_t page_offset(uint32_t addr) { return static_cast<size_t>(addr) & (PAGE_SIZE - 1); }
+
+    const std::vector<Entry>* find_page(size_t page) const
+    {
+        const size_t dir = page >> DIRECTORY_BITS;
+        if (dir >= directories.size() || directories[dir].empty()) {
+            return nullptr;
+        }
+        const auto& words = directories[dir][page & (DIRECTORY_SIZE - 1)];
+        return words.empty() ? nullptr : &words;
+    }
+
+    std::vector<Entry>& allocated_page(size_t page)
+    {
+        const size_t dir = page >> DIRECTORY_BITS;
+        if (dir >= directories.size()) {
+            directories.resize(dir + 1);
+        }
+        if (directories[dir].empty()) {
+            directories[dir].resize(DIRECTORY_SIZE);
+        }
+        auto& words = directories[dir][page & (DIRECTORY_SIZE - 1)];
+        if (words.empty()) {
+            words.resize(PAGE_SIZE);
+        }
+        return words;
+    }
+
+    // Splits the slice into runs of consecutive words within a page: walk(page, offset in page, number of words)
+    template <typename Walk> static void walk_slice(uint32_t addr, uint32_t size, Walk&& walk)
+    {
+        size_t remaining = size;
+        while (remaining > 0) {
+            const size_t offset = page_offset(addr);
+            const size_t chunk = std::min(remaining, PAGE_SIZE - offset);
+            walk(page_index(addr), offset, chunk);
+            addr += static_cast<uint32_t>(chunk);
+            remaining -= chunk;
+        }
+    }
+};
+
+} // namespace bb::avm_trace
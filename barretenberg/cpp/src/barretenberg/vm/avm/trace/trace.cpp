@@ -16,6 +16,7 @@
 
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -60,14 +61,13 @@ uint32_t finalize_rng_chks_for_testing(std::vector<Row>& main_trace,
 {
     // Build the main_trace, and add any new rows with specific clks that line up with lookup reads
 
-    // Is there a "spread-like" operator in cpp or can I make it generic of the first param of the unordered map
-    std::vector<std::unordered_map<uint8_t, uint32_t>> u8_rng_chks = {
+    std::vector<std::reference_wrapper<MultiplicityTable<uint8_t> const>> u8_rng_chks = {
         alu_trace_builder.u8_range_chk_counters[0], alu_trace_builder.u8_range_chk_counters[1],
         alu_trace_builder.u8_pow_2_counters[0],     alu_trace_builder.u8_pow_2_counters[1],
         rng_chk_trace_builder.powers_of_2_counts,   mem_trace_builder.mem_rng_chk_u8_counts,
     };
 
-    std::vector<std::reference_wrapper<std::unordered_map<uint16_t, uint32_t> const>> u16_rng_chks;
+    std::vector<std::reference_wrapper<MultiplicityTable<uint16_t> const>> u16_rng_chks;
 
     u16_rng_chks.emplace_back(rng_chk_trace_builder.dyn_diff_counts);
     u16_rng_chks.emplace_back(mem_trace_builder.mem_rng_chk_u16_0_counts);
@@ -81,16 +81,12 @@ uint32_t finalize_rng_chks_for_testing(std::vector<Row>& main_trace,
                         gas_trace_builder.rem_gas_rng_check_counts.end());
 
     auto custom_clk = std::set<uint32_t>{};
-    for (auto const& row : u8_rng_chks) {
-        for (auto const& [key, value] : row) {
-            custom_clk.insert(key);
-        }
+    for (auto row : u8_rng_chks) {
+        row.get().for_each_nonzero([&](uint8_t key, uint32_t) { custom_clk.insert(key); });
     }
 
     for (auto row : u16_rng_chks) {
-        for (auto const& [key, value] : row.get()) {
-            custom_clk.insert(key);
-        }
+        row.get().for_each_nonzero([&](uint16_t key, uint32_t) { custom_clk.insert(key); });
     }
 
     for (auto const& [clk, count] : mem_trace_builder.m_tag_err_lookup_counts) {
@@ -157,12 +153,12 @@ void AvmTraceBuilder::rollback_to_non_revertible_checkpoint()
     merkle_tree_trace_builder.rollback_to_non_revertible_checkpoint();
 }
 
-std::vector<uint8_t> AvmTraceBuilder::get_bytecode(const FF contract_address, bool check_membership)
+const std::vector<uint8_t>& AvmTraceBuilder::get_bytecode(const FF contract_address, bool check_membership)
 {
     auto clk = static_cast<uint32_t>(main_trace.size()) + 1;
 
     // Find the bytecode based on contract address of the public call request
-    const AvmContractBytecode bytecode_hint =
+    const AvmContractBytecode& bytecode_hint =
         *std::ranges::find_if(execution_hints.all_contract_bytecode, [contract_address](const auto& contract) {
             return contract.contract_instance.address == contract_address;
         });
@@ -215,6 +211,21 @@ std::vector<uint8_t> AvmTraceBuilder::get_bytecode(const FF contract_address, bo
     throw std::runtime_error("Bytecode not found");
 }
 
+/**
+ * @brief Returns the bytecode of the contract decoded for execution. The membership check, if requested, is performed
+ * on every call exactly as in get_bytecode, only the decoding is cached.
+ */
+const DecodedBytecode& AvmTraceBuilder::get_decoded_bytecode(const FF contract_address, bool check_membership)
+{
+    const std::vector<uint8_t>& bytecode = get_bytecode(contract_address, check_membership);
+    auto it = decoded_bytecode_cache.find(contract_address);
+    if (it == decoded_bytecode_cache.end()) {
+        it = decoded_bytecode_cache.emplace(contract_address, DecodedBytecode(bytecode)).first;
+    }
+    // References to the elements of an unordered_map remain valid as it grows
+    return it->second;
+}
+
 uint32_t AvmTraceBuilder::get_inserted_note_hashes_count()
 {
     return merkle_tree_trace_builder.get_tree_snapshots().note_hash_tree.size -
@@ -536,9 +547,10 @@ void AvmTraceBuilder::read_slice_from_memory(AddressWithMode addr, size_t slice_
         base_addr = static_cast<uint32_t>(mem_trace_builder.unconstrained_read(call_ptr, base_addr));
     }
 
-    for (uint32_t i = 0; i < slice_len; i++) {
-        slice.push_back(static_cast<T>(mem_trace_builder.unconstrained_read(call_ptr, base_addr + i)));
-    }
+    mem_trace_builder.unconstrained_read_slice(call_ptr,
+                                               base_addr,
+                                               static_cast<uint32_t>(slice_len),
+                                               [&](FF const& val) { slice.push_back(static_cast<T>(val)); });
 }
 
 template <typename T>
@@ -4970,209 +4982,221 @@ std::vector<Row> AvmTraceBuilder::finalize(bool apply_end_gas_assertions)
     size_t main_trace_size_pre_padding = main_trace.size();
     main_trace.resize(*trace_size);
 
-    /**********************************************************************************************
-     * MEMORY TRACE INCLUSION
-     **********************************************************************************************/
-
-    // We compute in the main loop the timestamp and global address for next row.
-    // Perform initialization for index 0 outside of the loop provided that mem trace exists.
-    if (mem_trace_size > 0) {
-        main_trace.at(0).mem_tsp =
-            FF(AvmMemTraceBuilder::NUM_SUB_CLK * mem_trace.at(0).m_clk + mem_trace.at(0).m_sub_clk);
-
-        main_trace.at(0).mem_glob_addr =
-            FF(mem_trace.at(0).m_addr + (static_cast<uint64_t>(mem_trace.at(0).m_space_id) << 32));
-    }
-
-    for (size_t i = 0; i < mem_trace_size; i++) {
-        auto const& src = mem_trace.at(i);
-        auto& dest = main_trace.at(i);
-
-        dest.mem_sel_mem = FF(1);
-        dest.mem_clk = FF(src.m_clk);
-        dest.mem_addr = FF(src.m_addr);
-        dest.mem_space_id = FF(src.m_space_id);
-        dest.mem_val = src.m_val;
-        dest.mem_rw = FF(static_cast<uint32_t>(src.m_rw));
-        dest.mem_r_in_tag = FF(static_cast<uint32_t>(src.r_in_tag));
-        dest.mem_w_in_tag = FF(static_cast<uint32_t>(src.w_in_tag));
-        dest.mem_tag = FF(static_cast<uint32_t>(src.m_tag));
-        dest.mem_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
-        dest.mem_one_min_inv = src.m_one_min_inv;
-        dest.mem_sel_mov_ia_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ia_to_ic));
-        dest.mem_sel_mov_ib_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ib_to_ic));
-        dest.mem_sel_op_slice = FF(static_cast<uint32_t>(src.m_sel_op_slice));
-
-        dest.incl_mem_tag_err_counts = FF(static_cast<uint32_t>(src.m_tag_err_count_relevant));
-
-        // TODO: Should be a cleaner way to do this in the future. Perhaps an "into_canonical" function in
-        // mem_trace_builder
-        if (!src.m_sel_op_slice) {
-            switch (src.m_sub_clk) {
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_A:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_a = 1 : dest.mem_sel_op_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_A:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_a = 1 : dest.mem_sel_op_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_B:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_b = 1 : dest.mem_sel_op_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_B:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_b = 1 : dest.mem_sel_op_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_C:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_c = 1 : dest.mem_sel_op_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_C:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_c = 1 : dest.mem_sel_op_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_LOAD_D:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_d = 1 : dest.mem_sel_op_d = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_STORE_D:
-                src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_d = 1 : dest.mem_sel_op_d = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_A:
-                dest.mem_sel_resolve_ind_addr_a = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_B:
-                dest.mem_sel_resolve_ind_addr_b = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_C:
-                dest.mem_sel_resolve_ind_addr_c = 1;
-                break;
-            case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_D:
-                dest.mem_sel_resolve_ind_addr_d = 1;
-                break;
-            default:
-                break;
-            }
-        }
-
-        if (src.m_sel_op_slice) {
-            dest.mem_skip_check_tag = dest.mem_sel_op_b * (-dest.mem_sel_mov_ib_to_ic + 1) + dest.mem_sel_op_slice;
-        }
-
-        if (i + 1 < mem_trace_size) {
-            auto const& next = mem_trace.at(i + 1);
-            auto& dest_next = main_trace.at(i + 1);
-            dest_next.mem_tsp = FF(AvmMemTraceBuilder::NUM_SUB_CLK * next.m_clk + next.m_sub_clk);
-            dest_next.mem_glob_addr = FF(next.m_addr + (static_cast<uint64_t>(next.m_space_id) << 32));
-
-            FF diff{};
-            if (dest_next.mem_glob_addr == dest.mem_glob_addr) {
-                diff = dest_next.mem_tsp - dest.mem_tsp;
-            } else {
-                diff = dest_next.mem_glob_addr - dest.mem_glob_addr;
-                dest.mem_lastAccess = FF(1);
-            }
-            dest.mem_sel_rng_chk = FF(1);
-
-            // Mem Address row differences are range checked to 40 bits, and the inter-trace index is the timestamp
-            // Decomposition of diff
-            dest.mem_diff = diff;
-            auto diff_u64 = static_cast<uint64_t>(diff);
-            // 16 bit decomposition
-            auto mem_u16_r0 = static_cast<uint16_t>(diff_u64);
-            dest.mem_u16_r0 = FF(mem_u16_r0);
-            mem_trace_builder.mem_rng_chk_u16_0_counts[mem_u16_r0]++;
-            // Next 16 bits
-            auto mem_u16_r1 = static_cast<uint16_t>(diff_u64 >> 16);
-            dest.mem_u16_r1 = FF(mem_u16_r1);
-            mem_trace_builder.mem_rng_chk_u16_1_counts[mem_u16_r1]++;
-            // Final 8 bits
-            auto mem_u8_r0 = static_cast<uint8_t>(diff_u64 >> 32);
-            dest.mem_u8_r0 = FF(mem_u8_r0);
-            mem_trace_builder.mem_rng_chk_u8_counts[mem_u8_r0]++;
-
-        } else {
-            dest.mem_lastAccess = FF(1);
-            dest.mem_last = FF(1);
-        }
-    }
-    /**********************************************************************************************
-     * ALU TRACE INCLUSION
-     **********************************************************************************************/
-    // Finalize cmp gadget of the ALU trace
+    // The cmp gadget of the ALU trace may be longer than the main trace
     auto cmp_trace_size = alu_trace_builder.cmp_builder.get_cmp_trace_size();
     if (main_trace_size < cmp_trace_size) {
         main_trace_size = cmp_trace_size;
         main_trace.resize(cmp_trace_size, {});
     }
-    std::vector<AvmCmpBuilder::CmpEntry> cmp_trace = alu_trace_builder.cmp_builder.finalize();
-    auto cmp_trace_canonical = alu_trace_builder.cmp_builder.into_canonical(cmp_trace);
-    for (size_t i = 0; i < cmp_trace_canonical.size(); i++) {
-        alu_trace_builder.cmp_builder.merge_into(main_trace.at(i), cmp_trace_canonical.at(i));
-    }
-
-    alu_trace_builder.finalize(main_trace);
 
     /**********************************************************************************************
-     * GADGET TABLES INCLUSION
+     * MEMORY TRACE INCLUSION
      **********************************************************************************************/
 
-    // Add Conversion Gadget table
-    for (size_t i = 0; i < conv_trace_size; i++) {
-        auto const& src = conv_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.conversion_sel_to_radix_be = FF(static_cast<uint8_t>(src.to_radix_be_sel));
-        dest.conversion_clk = FF(src.conversion_clk);
-        dest.conversion_input = src.input;
-        dest.conversion_radix = FF(src.radix);
-        dest.conversion_num_limbs = FF(src.num_limbs);
-        dest.conversion_output_bits = FF(src.output_bits);
-    }
-
-    // Add SHA256 Gadget table
-    for (size_t i = 0; i < sha256_trace_size; i++) {
-        auto const& src = sha256_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.sha256_clk = FF(src.clk);
-        dest.sha256_input = src.input[0];
-        // TODO: This will need to be enabled later
-        // dest.sha256_output = src.output[0];
-        dest.sha256_sel_sha256_compression = FF(1);
-        dest.sha256_state = src.state[0];
-    }
-
-    // Add Poseidon2 Gadget table
-    for (size_t i = 0; i < poseidon2_trace_size; i++) {
-        auto& dest = main_trace.at(i);
-        auto const& src = poseidon2_trace.at(i);
-        dest.poseidon2_clk = FF(src.clk);
-        merge_into(dest, src);
-    }
-
-    // Add KeccakF1600 Gadget table
-    for (size_t i = 0; i < keccak_trace_size; i++) {
-        auto const& src = keccak_trace.at(i);
-        auto& dest = main_trace.at(i);
-        dest.keccakf1600_clk = FF(src.clk);
-        dest.keccakf1600_input = FF(src.input[0]);
-        // TODO: This will need to be enabled later
-        // dest.keccakf1600_output = src.output[0];
-        dest.keccakf1600_sel_keccakf1600 = FF(1);
-    }
+    // The memory trace is included in chunks of rows on the thread pool. Each chunk counts the range checks of the
+    // address and timestamp differences in its own tables, which are merged afterwards.
+    struct MemRangeCheckCounts {
+        MultiplicityTable<uint16_t> u16_0;
+        MultiplicityTable<uint16_t> u16_1;
+        MultiplicityTable<uint8_t> u8;
+    };
+    const auto mem_rng_chk_counts = parallel_for_heuristic(
+        mem_trace_size,
+        MemRangeCheckCounts{},
+        [&](size_t i, MemRangeCheckCounts& counts) {
+            auto const& src = mem_trace.at(i);
+            auto& dest = main_trace.at(i);
+
+            dest.mem_tsp = FF(AvmMemTraceBuilder::NUM_SUB_CLK * src.m_clk + src.m_sub_clk);
+            dest.mem_glob_addr = FF(src.m_addr + (static_cast<uint64_t>(src.m_space_id) << 32));
+            dest.mem_sel_mem = FF(1);
+            dest.mem_clk = FF(src.m_clk);
+            dest.mem_addr = FF(src.m_addr);
+            dest.mem_space_id = FF(src.m_space_id);
+            dest.mem_val = src.m_val;
+            dest.mem_rw = FF(static_cast<uint32_t>(src.m_rw));
+            dest.mem_r_in_tag = FF(static_cast<uint32_t>(src.r_in_tag));
+            dest.mem_w_in_tag = FF(static_cast<uint32_t>(src.w_in_tag));
+            dest.mem_tag = FF(static_cast<uint32_t>(src.m_tag));
+            dest.mem_tag_err = FF(static_cast<uint32_t>(src.m_tag_err));
+            dest.mem_one_min_inv = src.m_one_min_inv;
+            dest.mem_sel_mov_ia_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ia_to_ic));
+            dest.mem_sel_mov_ib_to_ic = FF(static_cast<uint32_t>(src.m_sel_mov_ib_to_ic));
+            dest.mem_sel_op_slice = FF(static_cast<uint32_t>(src.m_sel_op_slice));
+
+            dest.incl_mem_tag_err_counts = FF(static_cast<uint32_t>(src.m_tag_err_count_relevant));
+
+            // TODO: Should be a cleaner way to do this in the future. Perhaps an "into_canonical" function in
+            // mem_trace_builder
+            if (!src.m_sel_op_slice) {
+                switch (src.m_sub_clk) {
+                case AvmMemTraceBuilder::SUB_CLK_LOAD_A:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_a = 1 : dest.mem_sel_op_a = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_STORE_A:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_a = 1 : dest.mem_sel_op_a = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_LOAD_B:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_b = 1 : dest.mem_sel_op_b = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_STORE_B:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_b = 1 : dest.mem_sel_op_b = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_LOAD_C:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_c = 1 : dest.mem_sel_op_c = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_STORE_C:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_c = 1 : dest.mem_sel_op_c = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_LOAD_D:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_read_d = 1 : dest.mem_sel_op_d = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_STORE_D:
+                    src.poseidon_mem_op ? dest.mem_sel_op_poseidon_write_d = 1 : dest.mem_sel_op_d = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_A:
+                    dest.mem_sel_resolve_ind_addr_a = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_B:
+                    dest.mem_sel_resolve_ind_addr_b = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_C:
+                    dest.mem_sel_resolve_ind_addr_c = 1;
+                    break;
+                case AvmMemTraceBuilder::SUB_CLK_IND_LOAD_D:
+                    dest.mem_sel_resolve_ind_addr_d = 1;
+                    break;
+                default:
+                    break;
+                }
+            }
 
-    /**********************************************************************************************
-     * SLICE TRACE INCLUSION
-     **********************************************************************************************/
-    for (size_t i = 0; i < slice_trace_size; i++) {
-        merge_into(main_trace.at(i), slice_trace.at(i));
-    }
+            if (src.m_sel_op_slice) {
+                dest.mem_skip_check_tag = dest.mem_sel_op_b * (-dest.mem_sel_mov_ib_to_ic + 1) + dest.mem_sel_op_slice;
+            }
 
-    /**********************************************************************************************
-     * BINARY TRACE INCLUSION
-     **********************************************************************************************/
+            if (i + 1 < mem_trace_size) {
+                // The timestamp and global address of the next row are recomputed rather than read from the main trace,
+                // as the next row may belong to another chunk.
+                auto const& next = mem_trace.at(i + 1);
+                const FF next_tsp = FF(AvmMemTraceBuilder::NUM_SUB_CLK * next.m_clk + next.m_sub_clk);
+                const FF next_glob_addr = FF(next.m_addr + (static_cast<uint64_t>(next.m_space_id) << 32));
+
+                FF diff{};
+                if (next_glob_addr == dest.mem_glob_addr) {
+                    diff = next_tsp - dest.mem_tsp;
+                } else {
+                    diff = next_glob_addr - dest.mem_glob_addr;
+                    dest.mem_lastAccess = FF(1);
+                }
+                dest.mem_sel_rng_chk = FF(1);
+
+                // Mem Address row differences are range checked to 40 bits, and the inter-trace index is the timestamp
+                // Decomposition of diff
+                dest.mem_diff = diff;
+                auto diff_u64 = static_cast<uint64_t>(diff);
+                // 16 bit decomposition
+                auto mem_u16_r0 = static_cast<uint16_t>(diff_u64);
+                dest.mem_u16_r0 = FF(mem_u16_r0);
+                counts.u16_0[mem_u16_r0]++;
+                // Next 16 bits
+                auto mem_u16_r1 = static_cast<uint16_t>(diff_u64 >> 16);
+                dest.mem_u16_r1 = FF(mem_u16_r1);
+                counts.u16_1[mem_u16_r1]++;
+                // Final 8 bits
+                auto mem_u8_r0 = static_cast<uint8_t>(diff_u64 >> 32);
+                dest.mem_u8_r0 = FF(mem_u8_r0);
+                counts.u8[mem_u8_r0]++;
 
-    bin_trace_builder.finalize(main_trace);
+            } else {
+                dest.mem_lastAccess = FF(1);
+                dest.mem_last = FF(1);
+            }
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 24);
+    for (auto const& counts : mem_rng_chk_counts) {
+        mem_trace_builder.mem_rng_chk_u16_0_counts.merge(counts.u16_0);
+        mem_trace_builder.mem_rng_chk_u16_1_counts.merge(counts.u16_1);
+        mem_trace_builder.mem_rng_chk_u8_counts.merge(counts.u8);
+    }
 
     /**********************************************************************************************
-     * GAS TRACE INCLUSION
+     * GADGET TRACES INCLUSION
      **********************************************************************************************/
 
-    gas_trace_builder.finalize(main_trace);
+    // Every gadget writes its own columns of the main trace and updates only its own builder, so the gadgets are
+    // included concurrently. None of them resizes the main trace.
+    const std::vector<std::function<void()>> gadget_tasks = {
+        // ALU trace and its cmp gadget
+        [&]() {
+            std::vector<AvmCmpBuilder::CmpEntry> cmp_trace = alu_trace_builder.cmp_builder.finalize();
+            auto cmp_trace_canonical = alu_trace_builder.cmp_builder.into_canonical(cmp_trace);
+            for (size_t i = 0; i < cmp_trace_canonical.size(); i++) {
+                alu_trace_builder.cmp_builder.merge_into(main_trace.at(i), cmp_trace_canonical.at(i));
+            }
+            alu_trace_builder.finalize(main_trace);
+        },
+        // Add Conversion Gadget table
+        [&]() {
+            for (size_t i = 0; i < conv_trace_size; i++) {
+                auto const& src = conv_trace.at(i);
+                auto& dest = main_trace.at(i);
+                dest.conversion_sel_to_radix_be = FF(static_cast<uint8_t>(src.to_radix_be_sel));
+                dest.conversion_clk = FF(src.conversion_clk);
+                dest.conversion_input = src.input;
+                dest.conversion_radix = FF(src.radix);
+                dest.conversion_num_limbs = FF(src.num_limbs);
+                dest.conversion_output_bits = FF(src.output_bits);
+            }
+        },
+        // Add SHA256 Gadget table
+        [&]() {
+            for (size_t i = 0; i < sha256_trace_size; i++) {
+                auto const& src = sha256_trace.at(i);
+                auto& dest = main_trace.at(i);
+                dest.sha256_clk = FF(src.clk);
+                dest.sha256_input = src.input[0];
+                // TODO: This will need to be enabled later
+                // dest.sha256_output = src.output[0];
+                dest.sha256_sel_sha256_compression = FF(1);
+                dest.sha256_state = src.state[0];
+            }
+        },
+        // Add Poseidon2 Gadget table
+        [&]() {
+            for (size_t i = 0; i < poseidon2_trace_size; i++) {
+                auto& dest = main_trace.at(i);
+                auto const& src = poseidon2_trace.at(i);
+                dest.poseidon2_clk = FF(src.clk);
+                merge_into(dest, src);
+            }
+        },
+        // Add KeccakF1600 Gadget table
+        [&]() {
+            for (size_t i = 0; i < keccak_trace_size; i++) {
+                auto const& src = keccak_trace.at(i);
+                auto& dest = main_trace.at(i);
+                dest.keccakf1600_clk = FF(src.clk);
+                dest.keccakf1600_input = FF(src.input[0]);
+                // TODO: This will need to be enabled later
+                // dest.keccakf1600_output = src.output[0];
+                dest.keccakf1600_sel_keccakf1600 = FF(1);
+            }
+        },
+        // Slice trace
+        [&]() {
+            for (size_t i = 0; i < slice_trace_size; i++) {
+                merge_into(main_trace.at(i), slice_trace.at(i));
+            }
+        },
+        // Binary trace
+        [&]() { bin_trace_builder.finalize(main_trace); },
+        // Gas trace
+        [&]() { gas_trace_builder.finalize(main_trace); },
+        // Bytecode hashing, which does not write to the main trace
+        [&]() { bytecode_trace_builder.build_bytecode_hash_columns(); },
+    };
+    parallel_for(gadget_tasks.size(), [&](size_t i) { gadget_tasks[i](); });
 
     if (apply_end_gas_assertions) {
         // Sanity check that the amount of gas consumed matches what we expect from the public inputs
@@ -5203,7 +5227,7 @@ std::vector<Row> AvmTraceBuilder::finalize(bool apply_end_gas_assertions)
      * BYTECODE TRACE INCLUSION
      **********************************************************************************************/
 
-    bytecode_trace_builder.build_bytecode_hash_columns();
+    // The bytecode hash columns were built with the gadgets above.
     // Should not have to resize in the future, but for now we do
     if (bytecode_trace_builder.total_bytecode_length() > main_trace_size) {
         main_trace_size = bytecode_trace_builder.total_bytecode_length();
@@ -5236,7 +5260,7 @@ std::vector<Row> AvmTraceBuilder::finalize(bool apply_end_gas_assertions)
      * RANGE CHECKS AND SELECTORS INCLUSION
      **********************************************************************************************/
     // HOOBOY THIS IS A DOOZY, we gotta extract the range check builder from the cmp which is in the alu
-    auto cmp_range_check_entries = alu_trace_builder.cmp_builder.range_check_builder;
+    auto const& cmp_range_check_entries = alu_trace_builder.cmp_builder.range_check_builder;
     range_check_builder.combine_range_builders(cmp_range_check_entries);
     // Add the range check counts to the main trace
     auto range_entries = range_check_builder.finalize();
@@ -5249,64 +5273,71 @@ std::vector<Row> AvmTraceBuilder::finalize(bool apply_end_gas_assertions)
             : finalize_rng_chks_for_testing(
                   main_trace, alu_trace_builder, mem_trace_builder, range_check_builder, gas_trace_builder);
 
-    for (size_t i = 0; i < new_trace_size; i++) {
-        auto& r = main_trace.at(i);
-
-        if (r.main_tag_err == FF(1)) {
-            r.main_op_err = FF(1); // Consolidation of errors into main_op_err
-        }
-
-        if ((r.main_sel_op_add == FF(1) || r.main_sel_op_sub == FF(1) || r.main_sel_op_mul == FF(1) ||
-             r.main_sel_op_eq == FF(1) || r.main_sel_op_not == FF(1) || r.main_sel_op_lt == FF(1) ||
-             r.main_sel_op_lte == FF(1) || r.main_sel_op_cast == FF(1) || r.main_sel_op_shr == FF(1) ||
-             r.main_sel_op_shl == FF(1) || r.main_sel_op_div == FF(1)) &&
-            r.main_op_err == FF(0)) {
-            r.main_sel_alu = FF(1); // From error consolidation, this is set only if tag_err == 0.
-        }
-
-        if (r.main_sel_op_internal_call == FF(1) || r.main_sel_op_internal_return == FF(1)) {
-            r.main_space_id = INTERNAL_CALL_SPACE_ID;
-        } else {
-            r.main_space_id = r.main_call_ptr;
-        };
+    // Every row only reads the lookup counts of the builders, so the rows are processed in parallel.
+    parallel_for_heuristic(
+        new_trace_size,
+        [&](size_t i) {
+            auto& r = main_trace.at(i);
 
-        r.main_clk = i >= old_trace_size ? r.main_clk : FF(i);
-        auto counter = i >= old_trace_size ? static_cast<uint32_t>(r.main_clk) : static_cast<uint32_t>(i);
-        r.incl_main_tag_err_counts = mem_trace_builder.m_tag_err_lookup_counts[static_cast<uint32_t>(counter)];
+            if (r.main_tag_err == FF(1)) {
+                r.main_op_err = FF(1); // Consolidation of errors into main_op_err
+            }
 
-        if (counter <= UINT8_MAX) {
-            auto counter_u8 = static_cast<uint8_t>(counter);
-            r.lookup_pow_2_0_counts = alu_trace_builder.u8_pow_2_counters[0][counter_u8];
-            r.lookup_pow_2_1_counts = alu_trace_builder.u8_pow_2_counters[1][counter_u8];
-            r.lookup_mem_rng_chk_2_counts = mem_trace_builder.mem_rng_chk_u8_counts[counter_u8];
-            r.main_sel_rng_8 = FF(1);
-            r.lookup_rng_chk_pow_2_counts = range_check_builder.powers_of_2_counts[counter_u8];
+            if ((r.main_sel_op_add == FF(1) || r.main_sel_op_sub == FF(1) || r.main_sel_op_mul == FF(1) ||
+                 r.main_sel_op_eq == FF(1) || r.main_sel_op_not == FF(1) || r.main_sel_op_lt == FF(1) ||
+                 r.main_sel_op_lte == FF(1) || r.main_sel_op_cast == FF(1) || r.main_sel_op_shr == FF(1) ||
+                 r.main_sel_op_shl == FF(1) || r.main_sel_op_div == FF(1)) &&
+                r.main_op_err == FF(0)) {
+                r.main_sel_alu = FF(1); // From error consolidation, this is set only if tag_err == 0.
+            }
 
-            // Also merge the powers of 2 table.
-            merge_into(r, FixedPowersTable::get().at(counter));
-        }
+            if (r.main_sel_op_internal_call == FF(1) || r.main_sel_op_internal_return == FF(1)) {
+                r.main_space_id = INTERNAL_CALL_SPACE_ID;
+            } else {
+                r.main_space_id = r.main_call_ptr;
+            };
+
+            r.main_clk = i >= old_trace_size ? r.main_clk : FF(i);
+            auto counter = i >= old_trace_size ? static_cast<uint32_t>(r.main_clk) : static_cast<uint32_t>(i);
+            // Looked up without inserting, as the rows are processed concurrently
+            auto const tag_err_count = mem_trace_builder.m_tag_err_lookup_counts.find(counter);
+            r.incl_main_tag_err_counts =
+                tag_err_count == mem_trace_builder.m_tag_err_lookup_counts.end() ? 0 : tag_err_count->second;
+
+            if (counter <= UINT8_MAX) {
+                auto counter_u8 = static_cast<uint8_t>(counter);
+                r.lookup_pow_2_0_counts = alu_trace_builder.u8_pow_2_counters[0][counter_u8];
+                r.lookup_pow_2_1_counts = alu_trace_builder.u8_pow_2_counters[1][counter_u8];
+                r.lookup_mem_rng_chk_2_counts = mem_trace_builder.mem_rng_chk_u8_counts[counter_u8];
+                r.main_sel_rng_8 = FF(1);
+                r.lookup_rng_chk_pow_2_counts = range_check_builder.powers_of_2_counts[counter_u8];
+
+                // Also merge the powers of 2 table.
+                merge_into(r, FixedPowersTable::get().at(counter));
+            }
 
-        if (counter <= UINT16_MAX) {
-            // We add to the clk here in case our trace is smaller than our range checks
-            // These are here for now until remove fully clean out the other lookups
-            r.lookup_rng_chk_0_counts = range_check_builder.u16_range_chk_counters[0][uint16_t(counter)];
-            r.lookup_rng_chk_1_counts = range_check_builder.u16_range_chk_counters[1][uint16_t(counter)];
-            r.lookup_rng_chk_2_counts = range_check_builder.u16_range_chk_counters[2][uint16_t(counter)];
-            r.lookup_rng_chk_3_counts = range_check_builder.u16_range_chk_counters[3][uint16_t(counter)];
-            r.lookup_rng_chk_4_counts = range_check_builder.u16_range_chk_counters[4][uint16_t(counter)];
-            r.lookup_rng_chk_5_counts = range_check_builder.u16_range_chk_counters[5][uint16_t(counter)];
-            r.lookup_rng_chk_6_counts = range_check_builder.u16_range_chk_counters[6][uint16_t(counter)];
-            r.lookup_rng_chk_7_counts = range_check_builder.u16_range_chk_counters[7][uint16_t(counter)];
-            r.lookup_rng_chk_diff_counts = range_check_builder.dyn_diff_counts[uint16_t(counter)];
-            r.lookup_mem_rng_chk_0_counts = mem_trace_builder.mem_rng_chk_u16_0_counts[uint16_t(counter)];
-            r.lookup_mem_rng_chk_1_counts = mem_trace_builder.mem_rng_chk_u16_1_counts[uint16_t(counter)];
-            r.lookup_l2_gas_rng_chk_0_counts = gas_trace_builder.rem_gas_rng_check_counts[0][uint16_t(counter)];
-            r.lookup_l2_gas_rng_chk_1_counts = gas_trace_builder.rem_gas_rng_check_counts[1][uint16_t(counter)];
-            r.lookup_da_gas_rng_chk_0_counts = gas_trace_builder.rem_gas_rng_check_counts[2][uint16_t(counter)];
-            r.lookup_da_gas_rng_chk_1_counts = gas_trace_builder.rem_gas_rng_check_counts[3][uint16_t(counter)];
-            r.main_sel_rng_16 = FF(1);
-        }
-    }
+            if (counter <= UINT16_MAX) {
+                // We add to the clk here in case our trace is smaller than our range checks
+                // These are here for now until remove fully clean out the other lookups
+                r.lookup_rng_chk_0_counts = range_check_builder.u16_range_chk_counters[0][uint16_t(counter)];
+                r.lookup_rng_chk_1_counts = range_check_builder.u16_range_chk_counters[1][uint16_t(counter)];
+                r.lookup_rng_chk_2_counts = range_check_builder.u16_range_chk_counters[2][uint16_t(counter)];
+                r.lookup_rng_chk_3_counts = range_check_builder.u16_range_chk_counters[3][uint16_t(counter)];
+                r.lookup_rng_chk_4_counts = range_check_builder.u16_range_chk_counters[4][uint16_t(counter)];
+                r.lookup_rng_chk_5_counts = range_check_builder.u16_range_chk_counters[5][uint16_t(counter)];
+                r.lookup_rng_chk_6_counts = range_check_builder.u16_range_chk_counters[6][uint16_t(counter)];
+                r.lookup_rng_chk_7_counts = range_check_builder.u16_range_chk_counters[7][uint16_t(counter)];
+                r.lookup_rng_chk_diff_counts = range_check_builder.dyn_diff_counts[uint16_t(counter)];
+                r.lookup_mem_rng_chk_0_counts = mem_trace_builder.mem_rng_chk_u16_0_counts[uint16_t(counter)];
+                r.lookup_mem_rng_chk_1_counts = mem_trace_builder.mem_rng_chk_u16_1_counts[uint16_t(counter)];
+                r.lookup_l2_gas_rng_chk_0_counts = gas_trace_builder.rem_gas_rng_check_counts[0][uint16_t(counter)];
+                r.lookup_l2_gas_rng_chk_1_counts = gas_trace_builder.rem_gas_rng_check_counts[1][uint16_t(counter)];
+                r.lookup_da_gas_rng_chk_0_counts = gas_trace_builder.rem_gas_rng_check_counts[2][uint16_t(counter)];
+                r.lookup_da_gas_rng_chk_1_counts = gas_trace_builder.rem_gas_rng_check_counts[3][uint16_t(counter)];
+                r.main_sel_rng_16 = FF(1);
+            }
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 24);
     // In case the range entries are larger than the main trace, we need to resize the main trace
     // Normally this would happen at the start of finalize, but we cannot finalize the range checks until after gas
     // :(
@@ -5,6 +5,7 @@
 #include "barretenberg/vm/avm/trace/binary_trace.hpp"
 #include "barretenberg/vm/avm/trace/bytecode_trace.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/deserialization.hpp"
 #include "barretenberg/vm/avm/trace/execution_hints.hpp"
 #include "barretenberg/vm/avm/trace/gadgets/conversion_trace.hpp"
 #include "barretenberg/vm/avm/trace/gadgets/ecc.hpp"
@@ -20,6 +21,7 @@
 #include "barretenberg/vm/avm/trace/public_inputs.hpp"
 #include "barretenberg/vm/constants.hpp"
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace bb::avm_trace {
@@ -232,8 +234,11 @@ class AvmTraceBuilder {
 
     void checkpoint_non_revertible_state();
     void rollback_to_non_revertible_checkpoint();
-    std::vector<uint8_t> get_bytecode(const FF contract_address, bool check_membership = false);
+    const std::vector<uint8_t>& get_bytecode(const FF contract_address, bool check_membership = false);
+    const DecodedBytecode& get_decoded_bytecode(const FF contract_address, bool check_membership = false);
     std::unordered_set<FF> bytecode_membership_cache;
+    // Bytecode decoded on first use, a contract called repeatedly is only decoded once
+    std::unordered_map<FF, DecodedBytecode> decoded_bytecode_cache;
     void insert_private_state(const std::vector<FF>& siloed_nullifiers, const std::vector<FF>& unique_note_hashes);
     void insert_private_revertible_state(const std::vector<FF>& siloed_nullifiers,
                                          const std::vector<FF>& siloed_note_hashes);
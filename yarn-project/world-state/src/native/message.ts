@@ -129,6 +129,21 @@ export interface DBStats {
   totalUsedSize: bigint;
 }
 
+export interface CacheStats {
+  /** The name of the cached DB */
+  name: string;
+  /** The configured capacity of the cache in bytes */
+  capacity: bigint;
+  /** The number of items currently cached */
+  numItems: bigint;
+  /** The number of bytes currently used by the cache */
+  totalUsedSize: bigint;
+  /** The number of reads served from the cache */
+  hits: bigint;
+  /** The number of reads that missed the cache */
+  misses: bigint;
+}
+
 export interface TreeDBStats {
   /** The configured max size of the DB mapping file (effectively the max possible size of the DB) */
   mapSize: bigint;
@@ -142,6 +157,10 @@ export interface TreeDBStats {
   leafIndicesDBStats: DBStats;
   /** Stats for the 'block indices' DB */
   blockIndicesDBStats: DBStats;
+  /** Stats for the cache of committed nodes */
+  nodesCacheStats: CacheStats;
+  /** Stats for the cache of committed leaf pre-images */
+  leafPreimagesCacheStats: CacheStats;
 }
 
 export interface WorldStateMeta {
@@ -184,6 +203,17 @@ export function buildEmptyDBStats() {
   } as DBStats;
 }
 
+export function buildEmptyCacheStats() {
+  return {
+    name: '',
+    capacity: 0n,
+    numItems: 0n,
+    totalUsedSize: 0n,
+    hits: 0n,
+    misses: 0n,
+  } as CacheStats;
+}
+
 export function buildEmptyTreeDBStats() {
   return {
     mapSize: 0n,
@@ -193,6 +223,8 @@ export function buildEmptyTreeDBStats() {
     leafKeysDBStats: buildEmptyDBStats(),
     leafPreimagesDBStats: buildEmptyDBStats(),
     blockIndicesDBStats: buildEmptyDBStats(),
+    nodesCacheStats: buildEmptyCacheStats(),
+    leafPreimagesCacheStats: buildEmptyCacheStats(),
   } as TreeDBStats;
 }
 
@@ -261,6 +293,15 @@ export function sanitiseDBStats(stats: DBStats) {
   return stats;
 }
 
+export function sanitiseCacheStats(stats: CacheStats) {
+  stats.capacity = BigInt(stats.capacity);
+  stats.numItems = BigInt(stats.numItems);
+  stats.totalUsedSize = BigInt(stats.totalUsedSize);
+  stats.hits = BigInt(stats.hits);
+  stats.misses = BigInt(stats.misses);
+  return stats;
+}
+
 export function sanitiseMeta(meta: TreeMeta) {
   meta.committedSize = BigInt(meta.committedSize);
   meta.finalisedBlockHeight = BigInt(meta.finalisedBlockHeight);
@@ -277,6 +318,8 @@ export function sanitiseTreeDBStats(stats: TreeDBStats) {
   stats.leafPreimagesDBStats = sanitiseDBStats(stats.leafPreimagesDBStats);
   stats.blockIndicesDBStats = sanitiseDBStats(stats.blockIndicesDBStats);
   stats.nodesDBStats = sanitiseDBStats(stats.nodesDBStats);
+  stats.nodesCacheStats = sanitiseCacheStats(stats.nodesCacheStats);
+  stats.leafPreimagesCacheStats = sanitiseCacheStats(stats.leafPreimagesCacheStats);
   stats.mapSize = BigInt(stats.mapSize);
   return stats;
 }